@@ -42,6 +42,16 @@ MACRO (MYSQL_USE_BUNDLED_LZ4)
   INCLUDE_DIRECTORIES(BEFORE SYSTEM ${CMAKE_SOURCE_DIR}/extra/lz4)
 
   IF (MYSQL_SOURCE_DIR AND MYSQL_BUILD_DIR)
+    # headers are needed to use the LZ4 frame API
+    FILE(GLOB_RECURSE LZ4_INCLUDE_FILE ${MYSQL_SOURCE_DIR}/extra/lz4/*/lib/lz4frame.h)
+
+    IF (NOT LZ4_INCLUDE_FILE)
+      MESSAGE(FATAL_ERROR "Could not find \"lz4frame.h\"")
+    ENDIF()
+
+    GET_FILENAME_COMPONENT(LZ4_INCLUDE_DIR ${LZ4_INCLUDE_FILE} DIRECTORY)
+    INCLUDE_DIRECTORIES(BEFORE SYSTEM ${LZ4_INCLUDE_DIR})
+
     IF (WIN32)
       find_file(LZ4_LIBRARY NAMES "lz4_lib.lib" PATHS "${MYSQL_BUILD_DIR}/${CMAKE_BUILD_TYPE}" "${MYSQL_BUILD_DIR}/utilities/${CMAKE_BUILD_TYPE}" "${MYSQL_BUILD_DIR}/archive_output_directory/${CMAKE_BUILD_TYPE}" NO_DEFAULT_PATH)
     ELSE()
@@ -26,12 +26,15 @@
 #include "modules/adminapi/cluster/status.h"
 
 #include <algorithm>
+#include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "modules/adminapi/cluster_set/cluster_set_impl.h"
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/common_status.h"
+#include "modules/adminapi/common/instance_pool.h"
 #include "modules/adminapi/common/metadata_storage.h"
 #include "modules/adminapi/common/parallel_applier_options.h"
 #include "modules/adminapi/common/server_features.h"
@@ -39,6 +42,7 @@
 #include "mysqlshdk/libs/mysql/clone.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
 #include "mysqlshdk/libs/mysql/repl_config.h"
+#include "mysqlshdk/libs/mysql/replication.h"
 #include "mysqlshdk/libs/utils/debug.h"
 
 namespace mysqlsh {
@@ -113,6 +117,29 @@ inline bool set_ts(shcore::Dictionary_t dict, const std::string &prop,
   return false;
 }
 
+/**
+ * State of a member, as queried from its session.
+ */
+struct Member_probe {
+  std::shared_ptr<Instance> instance;
+  // join timestamp of a RECOVERING member, from the metadata
+  std::string join_time;
+
+  shcore::Dictionary_t member = shcore::make_dict();
+  mysqlshdk::gr::Member minfo;
+  mysqlshdk::gr::Member_state self_state = mysqlshdk::gr::Member_state::MISSING;
+
+  std::optional<bool> super_read_only;
+  std::optional<bool> offline_mode;
+  std::vector<std::string> fence_sysvars;
+  bool auto_rejoin = false;
+
+  mysqlshdk::mysql::Replication_channel applier_channel;
+  mysqlshdk::mysql::Replication_channel recovery_channel;
+
+  Parallel_applier_options parallel_applier_options;
+};
+
 }  // namespace
 
 Status::Status(const Cluster_impl &cluster, std::optional<uint64_t> extended)
@@ -122,13 +149,28 @@ Status::~Status() = default;
 
 void Status::connect_to_members() {
   auto ipool = current_ipool();
+  std::vector<std::shared_ptr<Instance>> sessions(m_instances.size());
+  std::vector<std::string> errors(m_instances.size());
+
+  // unreachable members no longer delay each other, each one waits for its own
+  // connect timeout
+  probe_members_in_parallel(
+      m_instances.size(), [this, &ipool, &sessions, &errors](std::size_t i) {
+        try {
+          sessions[i] = ipool->connect_unchecked_endpoint(
+              m_instances[i].endpoint, false, false);
+        } catch (const shcore::Error &e) {
+          errors[i] = e.format();
+        }
+      });
 
-  for (const auto &inst : m_instances) {
-    try {
-      m_member_sessions[inst.endpoint] =
-          ipool->connect_unchecked_endpoint(inst.endpoint);
-    } catch (const shcore::Error &e) {
-      m_member_connect_errors[inst.endpoint] = e.format();
+  for (std::size_t i = 0; i < m_instances.size(); ++i) {
+    const auto &endpoint = m_instances[i].endpoint;
+
+    if (sessions[i]) {
+      m_member_sessions[endpoint] = std::move(sessions[i]);
+    } else {
+      m_member_connect_errors[endpoint] = std::move(errors[i]);
     }
   }
 }
@@ -468,14 +510,14 @@ void Status::collect_basic_local_status(shcore::Dictionary_t dict,
   std::string sql;
 
   if (version >= Version(8, 0, 0)) {
-    if (m_cluster.is_cluster_set_member()) {
+    if (m_cluster_set_member) {
       // PRIMARY of PC has no relevant replication lag info
       // PRIMARY of RC shows lag from clusterset_replication channel
       // SECONDARY members show replication from gr_applier channel
       std::string channel_name;
 
       if (is_primary) {
-        if (!m_cluster.is_primary_cluster()) {
+        if (!m_primary_cluster) {
           channel_name = k_clusterset_async_channel_name;
         }
       } else {
@@ -1367,6 +1409,8 @@ shcore::Dictionary_t Status::get_topology(
   };
 
   std::vector<Instance_metadata_info> instances;
+  // endpoints of the members which are not in the metadata
+  std::vector<std::string> unmanaged;
 
   // add placeholders for unmanaged members
   for (const auto &m : member_info) {
@@ -1413,19 +1457,36 @@ shcore::Dictionary_t Status::get_topology(
       log_debug("Instance %s with uuid=%s found in group but not in MD",
                 mdi.md.address.c_str(), m.uuid.c_str());
 
-      auto group_instance = m_cluster.get_cluster_server();
+      unmanaged.emplace_back(mdi.md.endpoint);
+      instances.emplace_back(std::move(mdi));
+    }
+  }
 
-      mysqlshdk::db::Connection_options opts(mdi.md.endpoint);
-      mysqlshdk::db::Connection_options group_session_copts(
-          group_instance->get_connection_options());
-      opts.set_login_options_from(group_session_copts);
-      try {
-        m_member_sessions[mdi.md.endpoint] = Instance::connect(opts);
-      } catch (const shcore::Error &e) {
-        m_member_connect_errors[mdi.md.endpoint] = e.format();
-      }
+  if (!unmanaged.empty()) {
+    mysqlshdk::db::Connection_options group_session_copts(
+        m_cluster.get_cluster_server()->get_connection_options());
+    std::vector<std::shared_ptr<Instance>> sessions(unmanaged.size());
+    std::vector<std::string> errors(unmanaged.size());
 
-      instances.emplace_back(std::move(mdi));
+    probe_members_in_parallel(
+        unmanaged.size(),
+        [&unmanaged, &group_session_copts, &sessions, &errors](std::size_t i) {
+          mysqlshdk::db::Connection_options opts(unmanaged[i]);
+          opts.set_login_options_from(group_session_copts);
+
+          try {
+            sessions[i] = Instance::connect(opts);
+          } catch (const shcore::Error &e) {
+            errors[i] = e.format();
+          }
+        });
+
+    for (std::size_t i = 0; i < unmanaged.size(); ++i) {
+      if (sessions[i]) {
+        m_member_sessions[unmanaged[i]] = std::move(sessions[i]);
+      } else {
+        m_member_connect_errors[unmanaged[i]] = std::move(errors[i]);
+      }
     }
   }
   // look for instances in MD but not in group
@@ -1469,23 +1530,48 @@ shcore::Dictionary_t Status::get_topology(
   auto mismatched_recovery_accounts =
       m_cluster.get_mismatched_recovery_accounts();
 
-  for (const auto &inst : instances) {
-    shcore::Dictionary_t member = shcore::make_dict();
-    mysqlshdk::gr::Member minfo(get_member(inst.actual_server_uuid));
-    mysqlshdk::gr::Member_state self_state =
-        mysqlshdk::gr::Member_state::MISSING;
+  std::vector<Member_probe> probes(instances.size());
+
+  for (std::size_t i = 0; i < instances.size(); ++i) {
+    const auto &inst = instances[i];
+    auto &probe = probes[i];
 
-    auto &instance = m_member_sessions[inst.md.endpoint];
+    probe.minfo = get_member(inst.actual_server_uuid);
+
+    if (const auto s = m_member_sessions.find(inst.md.endpoint);
+        s != m_member_sessions.end()) {
+      probe.instance = s->second;
+    }
 
-    std::optional<bool> super_read_only;
-    std::optional<bool> offline_mode;
-    std::vector<std::string> fence_sysvars;
-    bool auto_rejoin = false;
+    // metadata cannot be queried by the probes, get the join timestamp now
+    if (probe.instance && m_extended.has_value() &&
+        probe.minfo.state == Member_state::RECOVERING) {
+      shcore::Value join_time;
+      m_cluster.get_metadata_storage()->query_instance_attribute(
+          probe.instance->get_uuid(), k_instance_attribute_join_time,
+          &join_time);
 
-    Replication_channel applier_channel;
-    Replication_channel recovery_channel;
+      if (join_time.type == shcore::String) {
+        probe.join_time = join_time.as_string();
+      }
+    }
+  }
 
-    Parallel_applier_options parallel_applier_options;
+  // query the members in parallel, results are merged in the order of the
+  // instances, so that the output does not depend on the response times
+  probe_members_in_parallel(probes.size(), [this, &probes](std::size_t i) {
+    auto &probe = probes[i];
+    const auto &instance = probe.instance;
+    const auto &member = probe.member;
+    auto &minfo = probe.minfo;
+    auto &self_state = probe.self_state;
+    auto &super_read_only = probe.super_read_only;
+    auto &offline_mode = probe.offline_mode;
+    auto &fence_sysvars = probe.fence_sysvars;
+    auto &auto_rejoin = probe.auto_rejoin;
+    auto &applier_channel = probe.applier_channel;
+    auto &recovery_channel = probe.recovery_channel;
+    auto &parallel_applier_options = probe.parallel_applier_options;
 
     if (instance) {
       // Get the current parallel-applier options
@@ -1527,14 +1613,9 @@ shcore::Dictionary_t Status::get_topology(
         shcore::Value recovery_info;
         if (minfo.state == Member_state::RECOVERING) {
           std::string status;
-          // Get the join timestamp from the Metadata
-          shcore::Value join_time;
-          m_cluster.get_metadata_storage()->query_instance_attribute(
-              instance->get_uuid(), k_instance_attribute_join_time, &join_time);
-
-          std::tie(status, recovery_info) = recovery_status(
-              *instance,
-              join_time.type == shcore::String ? join_time.as_string() : "");
+
+          std::tie(status, recovery_info) =
+              recovery_status(*instance, probe.join_time);
           if (!status.empty()) {
             (*member)["recoveryStatusText"] = shcore::Value(status);
           }
@@ -1587,14 +1668,29 @@ shcore::Dictionary_t Status::get_topology(
           }
         }
       }
-
-    } else {
+    }
+  });
+
+  for (std::size_t i = 0; i < instances.size(); ++i) {
+    const auto &inst = instances[i];
+    const auto &probe = probes[i];
+    const auto &instance = probe.instance;
+    const auto &member = probe.member;
+    const auto &minfo = probe.minfo;
+    const auto self_state = probe.self_state;
+    const auto &super_read_only = probe.super_read_only;
+    const auto &offline_mode = probe.offline_mode;
+    const auto &applier_channel = probe.applier_channel;
+    const auto &recovery_channel = probe.recovery_channel;
+    const auto &parallel_applier_options = probe.parallel_applier_options;
+
+    if (!instance) {
       (*member)["shellConnectError"] =
           shcore::Value(m_member_connect_errors[inst.md.endpoint]);
     }
     feed_metadata_info(member, inst.md);
     feed_member_info(member, minfo, offline_mode, super_read_only,
-                     fence_sysvars, self_state, auto_rejoin);
+                     probe.fence_sysvars, self_state, probe.auto_rejoin);
 
     {
       shcore::Array_t issues = instance_diagnostics(
@@ -1890,6 +1986,10 @@ void Status::prepare() {
 
   m_instances = m_cluster.get_instances();
 
+  // metadata of the cluster is cached here, members are queried in parallel
+  m_cluster_set_member = m_cluster.is_cluster_set_member();
+  m_primary_cluster = m_cluster_set_member && m_cluster.is_primary_cluster();
+
   // Always connect to members to be able to get an accurate mode, based on
   // their super_ready_only value.
   connect_to_members();
@@ -106,6 +106,8 @@ class Status : public Command_interface {
       m_member_connect_errors;
 
   bool m_no_quorum = false;
+  bool m_cluster_set_member = false;
+  bool m_primary_cluster = false;
   std::optional<int64_t> m_cluster_transaction_size_limit = -1;
 
   void connect_to_members();
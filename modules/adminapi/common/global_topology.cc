@@ -596,15 +596,29 @@ void Server_global_topology::check_server(Instance_id id, bool /*deep*/) {
 
   log_debug("Scanning state of replicaset %s", server->label.c_str());
 
+  std::vector<Instance *> members;
+
+  for (auto &member : server->m_members) {
+    members.emplace_back(&member);
+  }
+
+  check_members(members);
+}
+
+void Server_global_topology::check_members(
+    const std::vector<Instance *> &members) {
   // Note: ipool methods that require metadata should not be called here
   auto ipool = current_ipool();
 
-  for (auto &member : server->m_members) {
+  // each probe updates only the state of its own member
+  probe_members_in_parallel(members.size(), [&](std::size_t i) {
+    auto &member = *members[i];
+
     log_debug("Connecting to %s", member.label.c_str());
     Scoped_instance minstance;
     try {
-      minstance =
-          Scoped_instance(ipool->connect_unchecked_endpoint(member.endpoint));
+      minstance = Scoped_instance(
+          ipool->connect_unchecked_endpoint(member.endpoint, false, false));
     } catch (shcore::Exception &e) {
       log_warning("Could not connect to %s: %s", member.label.c_str(),
                   e.format().c_str());
@@ -614,7 +628,7 @@ void Server_global_topology::check_server(Instance_id id, bool /*deep*/) {
       } else {
         throw;
       }
-      continue;
+      return;
     }
 
     // Load state of the member
@@ -626,14 +640,23 @@ void Server_global_topology::check_server(Instance_id id, bool /*deep*/) {
       member.connect_errno = e.code();
       member.connect_error = e.what();
     }
-  }
+  });
 }
 
-void Server_global_topology::check_servers(bool deep) {
+void Server_global_topology::check_servers(bool /*deep*/) {
+  // members of all the servers are scanned at the same time
+  std::vector<Instance *> members;
+
   for (Server &g : m_servers) {
-    check_server(g.instance_id, deep);
+    log_debug("Scanning state of replicaset %s", g.label.c_str());
+
+    for (auto &member : g.m_members) {
+      members.emplace_back(&member);
+    }
   }
 
+  check_members(members);
+
   // resolve cross-references across groups
   for (Server &s : m_servers) {
     for (Instance &i : s.m_members) {
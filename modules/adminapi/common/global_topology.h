@@ -32,6 +32,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "modules/adminapi/common/cluster_types.h"
 #include "modules/adminapi/common/health_enums.h"
@@ -278,6 +279,9 @@ class Server_global_topology : public Global_topology {
   void load_server_state(Server *server, mysqlsh::dba::Instance *conn,
                          bool deep);
 
+  // connects to the given members in parallel and loads their state
+  void check_members(const std::vector<Instance *> &members);
+
   Server &add_server(const Cluster_metadata &cluster,
                      const Instance_metadata &instance);
 
@@ -587,20 +587,25 @@ std::shared_ptr<Instance> Instance_pool::adopt(
 
 // Connect to the specified instance without doing any checks
 std::shared_ptr<Instance> Instance_pool::connect_unchecked(
-    const mysqlshdk::db::Connection_options &opts) {
+    const mysqlshdk::db::Connection_options &opts, bool allow_password_prompt) {
   DBUG_TRACE;
-  for (auto &inst : m_pool) {
-    if (!inst.leased && inst.instance->get_connection_options() == opts) {
-      inst.leased = true;
-      return inst.instance;
+  {
+    std::lock_guard<std::mutex> lock(m_pool_mutex);
+
+    for (auto &inst : m_pool) {
+      if (!inst.leased && inst.instance->get_connection_options() == opts) {
+        inst.leased = true;
+        return inst.instance;
+      }
     }
   }
 
-  return Instance::connect(opts, m_allow_password_prompt);
+  return Instance::connect(opts,
+                           m_allow_password_prompt && allow_password_prompt);
 }
 
 std::shared_ptr<Instance> Instance_pool::connect_unchecked_endpoint(
-    const std::string &endpoint, bool allow_url) {
+    const std::string &endpoint, bool allow_url, bool allow_password_prompt) {
   DBUG_TRACE;
   mysqlshdk::db::Connection_options opts(endpoint);
 
@@ -621,7 +626,7 @@ std::shared_ptr<Instance> Instance_pool::connect_unchecked_endpoint(
   }
 
   try {
-    return connect_unchecked(opts);
+    return connect_unchecked(opts, allow_password_prompt);
   }
   CATCH_AND_THROW_CONNECTION_ERROR(endpoint)
 }
@@ -631,13 +636,17 @@ std::shared_ptr<Instance> Instance_pool::connect_unchecked_uuid(
   DBUG_TRACE;
   Auth_options auth = m_default_auth_opts;
 
-  for (auto &inst : m_pool) {
-    Auth_options iauth;
-    iauth.get(inst.instance->get_connection_options());
+  {
+    std::lock_guard<std::mutex> lock(m_pool_mutex);
 
-    if (!inst.leased && inst.instance->get_uuid() == uuid && iauth == auth) {
-      inst.leased = true;
-      return inst.instance;
+    for (auto &inst : m_pool) {
+      Auth_options iauth;
+      iauth.get(inst.instance->get_connection_options());
+
+      if (!inst.leased && inst.instance->get_uuid() == uuid && iauth == auth) {
+        inst.leased = true;
+        return inst.instance;
+      }
     }
   }
 
@@ -1129,12 +1138,16 @@ std::shared_ptr<Instance> Instance_pool::add_leased_instance(
   Pool_entry entry;
   entry.instance = instance;
   entry.leased = true;
+
+  std::lock_guard<std::mutex> lock(m_pool_mutex);
   m_pool.emplace_back(entry);
   return instance;
 }
 
 void Instance_pool::return_instance(Instance *instance) {
   DBUG_TRACE;
+  std::lock_guard<std::mutex> lock(m_pool_mutex);
+
   for (auto i = m_pool.begin(); i != m_pool.end(); ++i) {
     if (i->instance.get() == instance) {
       if (!i->leased) throw std::logic_error("Returning unleased instance");
@@ -1146,6 +1159,8 @@ void Instance_pool::return_instance(Instance *instance) {
 
 std::shared_ptr<Instance> Instance_pool::forget_instance(Instance *instance) {
   DBUG_TRACE;
+  std::lock_guard<std::mutex> lock(m_pool_mutex);
+
   for (auto i = m_pool.begin(); i != m_pool.end(); ++i) {
     if (i->instance.get() == instance) {
       auto ptr = i->instance;
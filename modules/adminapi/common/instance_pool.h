@@ -28,6 +28,7 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -254,15 +255,19 @@ class Instance_pool final {
   // The caller is still responsible for calling release() on it.
   std::shared_ptr<Instance> adopt(const std::shared_ptr<Instance> &instance);
 
-  // Connect to the specified instance without doing any checks
+  // Connect to the specified instance without doing any checks, if
+  // allow_password_prompt is false, user is never prompted for a password (i.e.
+  // when connecting from a worker thread)
   std::shared_ptr<Instance> connect_unchecked(
-      const mysqlshdk::db::Connection_options &opts);
+      const mysqlshdk::db::Connection_options &opts,
+      bool allow_password_prompt = true);
 
   // Same as above, but by uuid
   std::shared_ptr<Instance> connect_unchecked_uuid(const std::string &uuid);
 
   std::shared_ptr<Instance> connect_unchecked_endpoint(
-      const std::string &endpoint, bool allow_url = false);
+      const std::string &endpoint, bool allow_url = false,
+      bool allow_password_prompt = true);
 
   // Connect to the node. If node is a group, picks any member from it.
   std::shared_ptr<Instance> connect_unchecked(const topology::Node *node);
@@ -322,6 +327,8 @@ class Instance_pool final {
   void set_auth_opts(const Auth_options &auth,
                      mysqlshdk::db::Connection_options *opts);
 
+  // guards m_pool, sessions can be acquired and returned by multiple threads
+  std::mutex m_pool_mutex;
   std::list<Pool_entry> m_pool;
   Auth_options m_default_auth_opts;
   struct Metadata_cache;
@@ -374,6 +381,32 @@ class Scoped_instance_pool final {
 
 std::shared_ptr<Instance_pool> current_ipool();
 
+/**
+ * Maximum number of threads used to query the members of a topology at the
+ * same time.
+ */
+inline constexpr std::size_t k_max_parallel_member_probes = 16;
+
+/**
+ * Calls fn(i) for each i in [0, count) using a bounded pool of threads, which
+ * are initialized to be able to connect to the servers.
+ *
+ * Each call should only use its own sessions and store its results in a slot
+ * reserved for its index, results are then merged by the caller in the same
+ * order as the items, so that the output does not depend on the order in which
+ * the members have responded. The only methods of the instance pool which can
+ * be used by fn are connect_unchecked() and connect_unchecked_endpoint(), with
+ * allow_password_prompt set to false.
+ */
+template <class F>
+void probe_members_in_parallel(std::size_t count, F &&fn) {
+  mysqlshdk::utils::parallel_for(count, k_max_parallel_member_probes,
+                                 [&fn](std::size_t i) {
+                                   mysqlsh::Mysql_thread thdinit;
+                                   fn(i);
+                                 });
+}
+
 template <class InputIter>
 std::list<shcore::Dictionary_t> execute_in_parallel(
     InputIter begin, InputIter end,
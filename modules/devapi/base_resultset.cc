@@ -411,3 +411,192 @@ void Row::add_item(const std::string &key, shcore::Value value) {
   // row.property
   if (shcore::is_valid_identifier(key) && !has_member(key)) add_property(key);
 }
+
+shcore::Array_t ShellBaseResult::fetch_columns(size_t max_rows) const {
+  auto ret_val = shcore::make_array();
+
+  auto result = get_result();
+  update_column_cache();
+
+  if (result && m_columns) {
+    auto buffers = mysqlshdk::db::fetch_columns(result, max_rows);
+
+    assert(buffers.size() == m_columns->size());
+    ret_val->reserve(buffers.size());
+
+    for (size_t i = 0; i < buffers.size(); ++i) {
+      ret_val->emplace_back(shcore::Value::wrap(
+          new ColumnBuffer(m_columns->at(i), std::move(buffers[i]))));
+    }
+  }
+
+  return ret_val;
+}
+
+shcore::Value ShellBaseResult::fetch_batch(int64_t size) const {
+  if (size <= 0) {
+    throw shcore::Exception::argument_error(
+        "The batch size must be greater than 0.");
+  }
+
+  auto columns = fetch_columns(static_cast<size_t>(size));
+
+  if (columns->empty() || 0 == columns->front().as_object()->length()) {
+    return shcore::Value::Null();
+  }
+
+  return shcore::Value(std::move(columns));
+}
+
+REGISTER_HELP_CLASS(ColumnBuffer, shellapi);
+REGISTER_HELP_CLASS_TEXT(COLUMNBUFFER, R"*(
+Holds the values of a column of a result.
+
+The values are decoded directly into a contiguous memory buffer, without
+creating an object for each of them:
+
+@li Integer columns are stored as signed 64-bit integers, format 'q'.
+@li Unsigned integer and bit columns are stored as unsigned 64-bit integers,
+format 'Q'.
+@li Float and double columns are stored as doubles, format 'd'.
+@li Values of all other columns are stored as strings, one after another,
+format 'B'. The offsets property holds the position of each of the values.
+
+In Python, the values can be accessed without copying them through the buffer
+protocol, i.e. memoryview(buffer). In both languages, the values can also be
+accessed by their index, NULL values are returned as null.
+)*");
+
+REGISTER_HELP_PROPERTY(column, ColumnBuffer);
+REGISTER_HELP(COLUMNBUFFER_COLUMN_BRIEF,
+              "The Column object with the metadata of the column.");
+
+REGISTER_HELP_PROPERTY(length, ColumnBuffer);
+REGISTER_HELP(COLUMNBUFFER_LENGTH_BRIEF,
+              "Returns number of values in the ColumnBuffer.");
+
+REGISTER_HELP_PROPERTY(nullCount, ColumnBuffer);
+REGISTER_HELP(COLUMNBUFFER_NULLCOUNT_BRIEF,
+              "Returns number of NULL values in the ColumnBuffer.");
+
+REGISTER_HELP_PROPERTY(format, ColumnBuffer);
+REGISTER_HELP(COLUMNBUFFER_FORMAT_BRIEF,
+              "Format of the items exposed through the buffer protocol, using "
+              "the syntax of the Python's struct module.");
+
+REGISTER_HELP_PROPERTY(offsets, ColumnBuffer);
+REGISTER_HELP(COLUMNBUFFER_OFFSETS_BRIEF,
+              "Bytes holding length + 1 signed 64-bit offsets of the values "
+              "stored as strings, null for other columns.");
+
+REGISTER_HELP_PROPERTY(validity, ColumnBuffer);
+REGISTER_HELP(COLUMNBUFFER_VALIDITY_BRIEF,
+              "Bytes holding a bitmap with a bit set for each value which is "
+              "not NULL, least significant bit first.");
+
+ColumnBuffer::ColumnBuffer(shcore::Value column,
+                           mysqlshdk::db::Column_buffer &&buffer)
+    : m_column(std::move(column)), m_buffer(std::move(buffer)) {
+  add_property("column");
+  add_property("length");
+  add_property("nullCount");
+  add_property("format");
+  add_property("offsets");
+  add_property("validity");
+}
+
+bool ColumnBuffer::operator==(const Object_bridge &other) const {
+  return this == &other;
+}
+
+shcore::Value ColumnBuffer::get_member(const std::string &prop) const {
+  using Layout = mysqlshdk::db::Column_buffer::Layout;
+
+  if (prop == "column") return m_column;
+  if (prop == "length") {
+    return shcore::Value(static_cast<uint64_t>(m_buffer.size()));
+  }
+
+  if (prop == "nullCount") {
+    return shcore::Value(static_cast<uint64_t>(m_buffer.null_count()));
+  }
+
+  if (prop == "format") return shcore::Value(buffer().format);
+
+  if (prop == "offsets") {
+    if (Layout::Binary != m_buffer.layout()) return shcore::Value::Null();
+
+    const auto &offsets = m_buffer.offsets();
+    return shcore::Value(reinterpret_cast<const char *>(offsets.data()),
+                         offsets.size() * sizeof(int64_t), true);
+  }
+
+  if (prop == "validity") {
+    const auto &validity = m_buffer.validity();
+    return shcore::Value(reinterpret_cast<const char *>(validity.data()),
+                         validity.size(), true);
+  }
+
+  return shcore::Cpp_object_bridge::get_member(prop);
+}
+
+shcore::Value ColumnBuffer::get_member(size_t index) const {
+  using Layout = mysqlshdk::db::Column_buffer::Layout;
+
+  if (index >= m_buffer.size() || m_buffer.is_null(index)) {
+    return shcore::Value::Null();
+  }
+
+  switch (m_buffer.layout()) {
+    case Layout::Int64:
+      return shcore::Value(m_buffer.get_int(index));
+
+    case Layout::UInt64:
+      return shcore::Value(m_buffer.get_uint(index));
+
+    case Layout::Double:
+      return shcore::Value(m_buffer.get_double(index));
+
+    case Layout::Binary:
+      return shcore::Value(std::string(m_buffer.get_string(index)),
+                           mysqlshdk::db::Type::Bytes == m_buffer.type());
+  }
+
+  return shcore::Value::Null();
+}
+
+shcore::Object_bridge::Buffer ColumnBuffer::buffer() const {
+  using Layout = mysqlshdk::db::Column_buffer::Layout;
+
+  // the buffer protocol does not allow null pointers
+  static constexpr uint64_t k_empty = 0;
+
+  Buffer buffer;
+  buffer.data = m_buffer.data_size() ? m_buffer.data() : &k_empty;
+
+  switch (m_buffer.layout()) {
+    case Layout::Int64:
+      buffer.format = "q";
+      break;
+
+    case Layout::UInt64:
+      buffer.format = "Q";
+      break;
+
+    case Layout::Double:
+      buffer.format = "d";
+      break;
+
+    case Layout::Binary:
+      buffer.format = "B";
+      break;
+  }
+
+  if (Layout::Binary != m_buffer.layout()) {
+    buffer.item_size = sizeof(uint64_t);
+  }
+
+  buffer.length = m_buffer.data_size() / buffer.item_size;
+
+  return buffer;
+}
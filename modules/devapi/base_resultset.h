@@ -36,6 +36,7 @@
 #include "db/column.h"
 #include "db/row.h"
 #include "modules/mod_common.h"
+#include "mysqlshdk/libs/db/column_buffer.h"
 #include "mysqlshdk/libs/db/result.h"
 #include "scripting/types.h"
 #include "scripting/types_cpp.h"
@@ -61,6 +62,17 @@ class ShellBaseResult : public shcore::Cpp_object_bridge {
 
   shcore::Dictionary_t fetch_one_object() const;
 
+  /**
+   * Fetches up to max_rows rows (all remaining rows if 0), decoding them into
+   * a ColumnBuffer per each of the columns.
+   */
+  shcore::Array_t fetch_columns(size_t max_rows) const;
+
+  /**
+   * Same as fetch_columns(), returns null once all rows were fetched.
+   */
+  shcore::Value fetch_batch(int64_t size) const;
+
   void dump();
 
   virtual bool has_data() const = 0;
@@ -329,6 +341,50 @@ class SHCORE_PUBLIC Row : public shcore::Cpp_object_bridge {
 
   shcore::Dictionary_t as_object();
 };
+
+/**
+ * \ingroup ShellAPI
+ * $(COLUMNBUFFER_BRIEF)
+ *
+ * $(COLUMNBUFFER)
+ */
+class SHCORE_PUBLIC ColumnBuffer : public shcore::Cpp_object_bridge {
+ public:
+#if DOXYGEN_JS
+  Column column;      //!< $(COLUMNBUFFER_COLUMN_BRIEF)
+  Integer length;     //!< $(COLUMNBUFFER_LENGTH_BRIEF)
+  Integer nullCount;  //!< $(COLUMNBUFFER_NULLCOUNT_BRIEF)
+  String format;      //!< $(COLUMNBUFFER_FORMAT_BRIEF)
+  Bytes offsets;      //!< $(COLUMNBUFFER_OFFSETS_BRIEF)
+  Bytes validity;     //!< $(COLUMNBUFFER_VALIDITY_BRIEF)
+#elif DOXYGEN_PY
+  Column column;   //!< $(COLUMNBUFFER_COLUMN_BRIEF)
+  int length;      //!< $(COLUMNBUFFER_LENGTH_BRIEF)
+  int null_count;  //!< $(COLUMNBUFFER_NULLCOUNT_BRIEF)
+  str format;      //!< $(COLUMNBUFFER_FORMAT_BRIEF)
+  bytes offsets;   //!< $(COLUMNBUFFER_OFFSETS_BRIEF)
+  bytes validity;  //!< $(COLUMNBUFFER_VALIDITY_BRIEF)
+#endif
+
+  ColumnBuffer(shcore::Value column, mysqlshdk::db::Column_buffer &&buffer);
+
+  std::string class_name() const override { return "ColumnBuffer"; }
+
+  bool operator==(const Object_bridge &other) const override;
+
+  shcore::Value get_member(const std::string &prop) const override;
+  shcore::Value get_member(size_t index) const override;
+
+  size_t length() const override { return m_buffer.size(); }
+  bool is_indexed() const override { return true; }
+
+  bool is_buffer() const override { return true; }
+  Buffer buffer() const override;
+
+ private:
+  shcore::Value m_column;
+  mysqlshdk::db::Column_buffer m_buffer;
+};
 }  // namespace mysqlsh
 
 #endif  // MODULES_DEVAPI_BASE_RESULTSET_H_
@@ -172,6 +172,28 @@ std::shared_ptr<mysqlshdk::db::mysqlx::Result> Crud_definition::safe_exec(
   return std::static_pointer_cast<mysqlshdk::db::mysqlx::Result>(result);
 }
 
+Batch_statement Crud_definition::batch_statement() {
+  // statements executed in a batch are not prepared, as this would require
+  // additional round trips
+  m_batched = true;
+  shcore::Scoped_callback reset([this]() { m_batched = false; });
+
+  Batch_statement statement;
+
+  statement.message = pipelined_message();
+  statement.wrap_result =
+      [this](std::shared_ptr<mysqlshdk::db::mysqlx::Result> result) {
+        return wrap_result(std::move(result));
+      };
+
+  return statement;
+}
+
+shcore::Value Crud_definition::wrap_result(
+    std::shared_ptr<mysqlshdk::db::mysqlx::Result> result) {
+  return shcore::Value::wrap(std::make_shared<Result>(std::move(result)));
+}
+
 std::shared_ptr<Session> Crud_definition::session() {
   if (_owner) {
     return std::static_pointer_cast<Session>(_owner->session());
@@ -30,6 +30,7 @@
 #define MODULES_DEVAPI_CRUD_DEFINITION_H_
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -71,6 +72,12 @@ class Crud_definition : public Dynamic_object {
   virtual shcore::Value execute(const shcore::Argument_list &args) = 0;
   Crud_definition &bind(const std::string &name, shcore::Value value);
 
+  /**
+   * Prepares this operation to be executed by Session::execute_batch(),
+   * consumes the bound values just like execute() does.
+   */
+  Batch_statement batch_statement();
+
  protected:
   std::shared_ptr<mysqlshdk::db::mysqlx::Result> safe_exec(
       std::function<std::shared_ptr<mysqlshdk::db::IResult>()> func);
@@ -111,9 +118,19 @@ class Crud_definition : public Dynamic_object {
   virtual void update_limits(){};
   void reset_prepared_statement();
   bool use_prepared() {
-    return allow_prepared_statements() && m_execution_count;
+    return !m_batched && allow_prepared_statements() && m_execution_count;
   }
 
+  /**
+   * Message which executes this operation, not set if there's nothing to be
+   * executed.
+   */
+  virtual std::optional<mysqlshdk::db::mysqlx::Pipelined_message>
+  pipelined_message() = 0;
+
+  virtual shcore::Value wrap_result(
+      std::shared_ptr<mysqlshdk::db::mysqlx::Result> result);
+
   virtual shcore::Value this_object() { return shcore::Value(); }
   shcore::Value limit(const shcore::Argument_list &args,
                       Dynamic_object::Allowed_function_mask limit_func_id,
@@ -164,6 +181,9 @@ class Crud_definition : public Dynamic_object {
 
  private:
   void validate_placeholders();
+
+  // set while the message of a batched statement is being created
+  bool m_batched = false;
 };
 }  // namespace mysqlx
 }  // namespace mysqlsh
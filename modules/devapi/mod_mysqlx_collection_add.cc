@@ -54,11 +54,16 @@ CollectionAdd::CollectionAdd(std::shared_ptr<Collection> owner)
   message_.mutable_collection()->set_name(owner->name());
   message_.set_data_model(Mysqlx::Crud::DOCUMENT);
 
+  auto bind_id = F::bind;
   // Exposes the methods available for chaining
   add_method("add", std::bind(&CollectionAdd::add, this, _1), "data");
+  add_method("bind", std::bind(&CollectionAdd::bind_, this, _1, bind_id),
+             "data");
 
   // Registers the dynamic function behavior
   register_dynamic_function(F::add, F::execute, K_DISABLE_NONE, K_ALLOW_REUSE);
+  // bind() is enabled by add() once the documents use placeholders
+  register_dynamic_function(F::bind, K_ENABLE_NONE, F::add, K_ALLOW_REUSE);
 
   // Initial function update
   enable_function(F::add);
@@ -180,6 +185,7 @@ shcore::Value CollectionAdd::add(const shcore::Argument_list &args) {
         }
         // Updates the exposed functions (since a document has been added)
         update_functions(F::add);
+        if (!_placeholders.empty()) enable_function(F::bind);
         reset_prepared_statement();
       }
       CATCH_AND_TRANSLATE_CRUD_EXCEPTION(get_function_name("add").c_str());
@@ -239,6 +245,78 @@ void CollectionAdd::add_one_document(shcore::Value doc,
   message_.mutable_row()->Add()->mutable_field()->AddAllocated(docx.release());
 }
 
+shcore::Value CollectionAdd::this_object() {
+  return shcore::Value(
+      std::static_pointer_cast<Object_bridge>(shared_from_this()));
+}
+
+REGISTER_HELP_FUNCTION(bind, CollectionAdd);
+REGISTER_HELP(COLLECTIONADD_BIND_BRIEF,
+              "Binds a value to a specific placeholder used on this "
+              "CollectionAdd object.");
+REGISTER_HELP(COLLECTIONADD_BIND_PARAM,
+              "@param name The name of the placeholder to which the value "
+              "will be bound.");
+REGISTER_HELP(COLLECTIONADD_BIND_PARAM1,
+              "@param value The value to be bound on the placeholder.");
+REGISTER_HELP(COLLECTIONADD_BIND_RETURNS, "@returns This CollectionAdd object.");
+REGISTER_HELP(
+    COLLECTIONADD_BIND_DETAIL,
+    "Binds the given value to the placeholder with the specified name.");
+REGISTER_HELP(COLLECTIONADD_BIND_DETAIL1,
+              "An error will be raised if the placeholder indicated by name "
+              "does not exist.");
+REGISTER_HELP(COLLECTIONADD_BIND_DETAIL2,
+              "This function must be called once for each used placeholder or "
+              "an error will be raised when the execute() method is called.");
+REGISTER_HELP(COLLECTIONADD_BIND_DETAIL3,
+              "This function is available only if any of the added documents "
+              "uses a placeholder, i.e. mysqlx.expr(\":name\").");
+
+/**
+ * $(COLLECTIONADD_BIND_BRIEF)
+ *
+ * $(COLLECTIONADD_BIND_PARAM)
+ *
+ * $(COLLECTIONADD_BIND_PARAM1)
+ *
+ * $(COLLECTIONADD_BIND_RETURNS)
+ *
+ * $(COLLECTIONADD_BIND_DETAIL)
+ *
+ * $(COLLECTIONADD_BIND_DETAIL1)
+ *
+ * $(COLLECTIONADD_BIND_DETAIL2)
+ *
+ * $(COLLECTIONADD_BIND_DETAIL3)
+ *
+ * #### Method Chaining
+ *
+ * This function can be invoked multiple times after add(), if a placeholder was
+ * used, and after execute().
+ *
+ * After this function invocation, the following functions can be invoked:
+ */
+#if DOXYGEN_JS
+/**
+ * - bind(String name, Value value)
+ */
+#elif DOXYGEN_PY
+/**
+ * - bind(str name, Value value)
+ */
+#endif
+/**
+ * - execute()
+ */
+//@{
+#if DOXYGEN_JS
+CollectionAdd CollectionAdd::bind(String name, Value value) {}
+#elif DOXYGEN_PY
+CollectionAdd CollectionAdd::bind(str name, Value value) {}
+#endif
+//@}
+
 REGISTER_HELP_FUNCTION(execute, CollectionAdd);
 REGISTER_HELP(COLLECTIONADD_EXECUTE_BRIEF,
               "Executes the add operation, the documents are added to the "
@@ -331,8 +409,10 @@ shcore::Value CollectionAdd::execute(bool upsert) {
 
   std::shared_ptr<mysqlx::Result> result;
   if (!message_.mutable_row()->empty()) {
-    result = std::make_shared<mysqlx::Result>(safe_exec(
-        [this]() { return session()->session()->execute_crud(message_); }));
+    result = std::make_shared<mysqlx::Result>(safe_exec([this]() {
+      insert_bound_values(message_.mutable_args());
+      return session()->session()->execute_crud(message_);
+    }));
   } else {
     result = std::make_shared<mysqlx::Result>(nullptr);
   }
@@ -341,5 +421,19 @@ shcore::Value CollectionAdd::execute(bool upsert) {
                 : shcore::Value::Null();
 }
 
+std::optional<mysqlshdk::db::mysqlx::Pipelined_message>
+CollectionAdd::pipelined_message() {
+  if (message_.row().empty()) return {};
+  insert_bound_values(message_.mutable_args());
+  return message_;
+}
+
+void CollectionAdd::set_prepared_stmt() {
+  m_prep_stmt.mutable_stmt()->set_type(
+      Mysqlx::Prepare::Prepare_OneOfMessage_Type_INSERT);
+  message_.clear_args();
+  *m_prep_stmt.mutable_stmt()->mutable_insert() = message_;
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
@@ -30,6 +30,7 @@
 #define MODULES_DEVAPI_MOD_MYSQLX_COLLECTION_ADD_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 #include "modules/devapi/collection_crud_definition.h"
@@ -64,24 +65,30 @@ class CollectionAdd : public Collection_crud_definition,
 #if DOXYGEN_JS
   CollectionAdd add(DocDefinition document[, DocDefinition document, ...]);
   CollectionAdd add(List documents);
+  CollectionAdd bind(String name, Value value);
   Result execute();
 #elif DOXYGEN_PY
   CollectionAdd add(DocDefinition document[, DocDefinition document, ...]);
   CollectionAdd add(list documents);
+  CollectionAdd bind(str name, Value value);
   Result execute();
 #endif
 
  private:
   friend class Collection;
   void add_one_document(shcore::Value doc, const std::string &error_context);
-  bool allow_prepared_statements() override { return false; }
+  void set_prepared_stmt() override;
+  shcore::Value this_object() override;
 
   std::vector<std::string> last_document_ids_;
   Mysqlx::Crud::Insert message_;
+  std::optional<mysqlshdk::db::mysqlx::Pipelined_message> pipelined_message()
+      override;
 
   struct F {
     static constexpr Allowed_function_mask add = 1 << 0;
     static constexpr Allowed_function_mask execute = 1 << 1;
+    static constexpr Allowed_function_mask bind = 1 << 2;
   };
 
   Allowed_function_mask function_name_to_bitmask(
@@ -92,6 +99,9 @@ class CollectionAdd : public Collection_crud_definition,
     if ("execute" == s) {
       return F::execute;
     }
+    if ("bind" == s) {
+      return F::bind;
+    }
     if ("help" == s) {
       return enabled_functions_;
     }
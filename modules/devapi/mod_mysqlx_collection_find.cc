@@ -1443,5 +1443,17 @@ std::unique_ptr<DocResult> CollectionFind::execute() {
 }
 #endif
 
+std::optional<mysqlshdk::db::mysqlx::Pipelined_message>
+CollectionFind::pipelined_message() {
+  update_limits();
+  insert_bound_values(message_.mutable_args());
+  return message_;
+}
+
+shcore::Value CollectionFind::wrap_result(
+    std::shared_ptr<mysqlshdk::db::mysqlx::Result> result) {
+  return shcore::Value::wrap(std::make_shared<DocResult>(std::move(result)));
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
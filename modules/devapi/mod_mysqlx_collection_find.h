@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include "modules/devapi/collection_crud_definition.h"
 
@@ -112,6 +113,10 @@ class CollectionFind : public Collection_crud_definition,
   void set_lock_contention(const shcore::Argument_list &args);
   void set_prepared_stmt() override;
   void update_limits() override { set_limits_on_message(&message_); }
+  std::optional<mysqlshdk::db::mysqlx::Pipelined_message> pipelined_message()
+      override;
+  shcore::Value wrap_result(
+      std::shared_ptr<mysqlshdk::db::mysqlx::Result> result) override;
   shcore::Value this_object() override;
 
   struct F {
@@ -1681,5 +1681,12 @@ shcore::Value CollectionModify::execute() {
 }
 #endif
 
+std::optional<mysqlshdk::db::mysqlx::Pipelined_message>
+CollectionModify::pipelined_message() {
+  update_limits();
+  insert_bound_values(message_.mutable_args());
+  return message_;
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
@@ -527,5 +527,12 @@ shcore::Value CollectionRemove::execute() {
 }
 #endif
 
+std::optional<mysqlshdk::db::mysqlx::Pipelined_message>
+CollectionRemove::pipelined_message() {
+  update_limits();
+  insert_bound_values(message_.mutable_args());
+  return message_;
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include "modules/devapi/collection_crud_definition.h"
 
@@ -78,6 +79,8 @@ class CollectionRemove : public Collection_crud_definition,
   shcore::Value execute(const shcore::Argument_list &args) override;
   void set_prepared_stmt() override;
   void update_limits() override { set_limits_on_message(&message_); }
+  std::optional<mysqlshdk::db::mysqlx::Pipelined_message> pipelined_message()
+      override;
   shcore::Value this_object() override;
 #if !defined DOXYGEN_JS && !defined DOXYGEN_PY
   shcore::Value execute();
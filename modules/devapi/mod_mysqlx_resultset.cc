@@ -551,6 +551,8 @@ RowResult::RowResult(std::shared_ptr<mysqlshdk::db::mysqlx::Result> result)
   expose("fetchOne", &RowResult::fetch_one);
   expose("fetchAll", &RowResult::fetch_all);
   expose("fetchOneObject", &RowResult::_fetch_one_object);
+  expose("fetchColumns", &RowResult::_fetch_columns);
+  expose("fetchBatch", &RowResult::_fetch_batch, "size");
 }
 
 shcore::Value RowResult::get_member(const std::string &prop) const {
@@ -735,6 +737,59 @@ shcore::Array_t RowResult::fetch_all() const {
   return array;
 }
 
+// Documentation of fetchColumns function
+REGISTER_HELP_FUNCTION(fetchColumns, RowResult);
+REGISTER_HELP_FUNCTION_TEXT(ROWRESULT_FETCHCOLUMNS, R"*(
+Returns a list of ColumnBuffer objects holding the values of every unread row,
+one for each of the columns of the result.
+
+@returns A List of ColumnBuffer objects.
+
+The values are decoded directly into a buffer per column, without creating a Row
+object for each of the records, which is considerably faster for big results.
+In Python, the buffers can be accessed without copying them using memoryview().
+)*");
+/**
+ * $(ROWRESULT_FETCHCOLUMNS_BRIEF)
+ *
+ * $(ROWRESULT_FETCHCOLUMNS)
+ */
+#if DOXYGEN_JS
+List RowResult::fetchColumns() {}
+#elif DOXYGEN_PY
+list RowResult::fetch_columns() {}
+#endif
+shcore::Array_t RowResult::_fetch_columns() const {
+  return ShellBaseResult::fetch_columns(0);
+}
+
+// Documentation of fetchBatch function
+REGISTER_HELP_FUNCTION(fetchBatch, RowResult);
+REGISTER_HELP_FUNCTION_TEXT(ROWRESULT_FETCHBATCH, R"*(
+Returns a list of ColumnBuffer objects holding the values of up to size unread
+rows, one for each of the columns of the result.
+
+@param size The maximum number of rows to be fetched.
+
+@returns A List of ColumnBuffer objects or null if there are no more rows.
+
+This function can be used to process a big result in fixed size chunks, see
+<<<fetchColumns>>>() for more details.
+)*");
+/**
+ * $(ROWRESULT_FETCHBATCH_BRIEF)
+ *
+ * $(ROWRESULT_FETCHBATCH)
+ */
+#if DOXYGEN_JS
+List RowResult::fetchBatch(Integer size) {}
+#elif DOXYGEN_PY
+list RowResult::fetch_batch(int size) {}
+#endif
+shcore::Value RowResult::_fetch_batch(int64_t size) const {
+  return ShellBaseResult::fetch_batch(size);
+}
+
 void RowResult::append_json(shcore::JSON_dumper &dumper) const {
   bool create_object = (dumper.deep_level() == 0);
 
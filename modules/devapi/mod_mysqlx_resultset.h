@@ -194,6 +194,8 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
   std::shared_ptr<mysqlsh::Row> fetch_one() const;
   shcore::Array_t fetch_all() const;
   shcore::Dictionary_t _fetch_one_object();
+  shcore::Array_t _fetch_columns() const;
+  shcore::Value _fetch_batch(int64_t size) const;
   shcore::Value get_member(const std::string &prop) const override;
 
   std::string class_name() const override { return "RowResult"; }
@@ -206,6 +208,8 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
   Row fetchOne();
   Dictionary fetchOneObject();
   List fetchAll();
+  List fetchColumns();
+  List fetchBatch(Integer size);
 
   Integer columnCount;  //!< Same as getColumnCount()
   List columnNames;     //!< Same as getColumnNames()
@@ -218,6 +222,8 @@ class SHCORE_PUBLIC RowResult : public BaseResult {
   Row fetch_one();
   dict fetch_one_object();
   list fetch_all();
+  list fetch_columns();
+  list fetch_batch(int size);
 
   int column_count;   //!< Same as get_column_count()
   list column_names;  //!< Same as get_column_names()
@@ -34,6 +34,7 @@
 #include <string>
 #include <vector>
 
+#include "modules/devapi/crud_definition.h"
 #include "modules/devapi/mod_mysqlx_constants.h"
 #include "modules/devapi/mod_mysqlx_expression.h"
 #include "modules/devapi/mod_mysqlx_schema.h"
@@ -144,6 +145,7 @@ void Session::init() {
   expose("quoteName", &Session::quote_name, "id");
 
   expose("runSql", &Session::run_sql, "query", "?args");
+  expose("executeBatch", &Session::execute_batch, "statements");
 
   expose("_getSocketFd", &Session::_get_socket_fd);
   expose("_fetchNotice", &Session::_fetch_notice);
@@ -435,6 +437,138 @@ Schema Session::getDefaultSchema() {}
 Schema Session::get_default_schema() {}
 #endif
 
+REGISTER_HELP_FUNCTION(executeBatch, Session);
+REGISTER_HELP_FUNCTION_TEXT(SESSION_EXECUTEBATCH, R"*(
+Executes the given statements using a single round trip to the server.
+
+@param statements List of CRUD operations and SqlExecute objects, created
+using this session.
+
+@returns A list with the results of the statements.
+
+All the statements are sent to the server at once, without waiting for the
+results, and then the results are read in the same order. This avoids the
+network latency of executing each statement separately.
+
+The statements are executed exactly as if their execute() function was
+called, except for the following:
+@li Prepared statements are not used.
+@li All the rows of each result are read before the function returns.
+@li Only the first result of a SQL statement is available.
+
+If one of the statements fails, the statements which follow it are not
+executed, and an error which contains the position of the failed statement
+is thrown.
+
+@throw LogicError if there's no open session.
+@throw ArgumentError if the list contains an object which is not a CRUD
+operation nor a SqlExecute object.
+@throw LogicError if any of the statements cannot be executed yet.
+)*");
+/**
+ * $(SESSION_EXECUTEBATCH_BRIEF)
+ *
+ * $(SESSION_EXECUTEBATCH)
+ *
+ * JavaScript Example
+ * \code{.js}
+ * var results = session.executeBatch([
+ *   collection.add({name: "Alice"}),
+ *   collection.modify("name = :name").set("age", 30).bind("name", "Alice"),
+ *   session.sql("SELECT COUNT(*) FROM mydb.students")]);
+ * \endcode
+ */
+#if DOXYGEN_JS
+List Session::executeBatch(List statements) {}
+#elif DOXYGEN_PY
+list Session::execute_batch(list statements) {}
+#endif
+shcore::Array_t Session::execute_batch(const shcore::Array_t &statements) {
+  if (!_session || !_session->is_open())
+    throw Exception::logic_error("Not connected.");
+
+  auto ret_val = shcore::make_array();
+
+  if (!statements || statements->empty()) return ret_val;
+
+  // all statements are validated first, creating the messages consumes the
+  // bound values
+  for (std::size_t i = 0; i < statements->size(); ++i) {
+    const auto &statement = (*statements)[i];
+
+    if (statement.get_type() != shcore::Object ||
+        (!statement.as_object<Crud_definition>() &&
+         !statement.as_object<SqlExecute>())) {
+      throw Exception::argument_error(shcore::str_format(
+          "Statement #%zu is expected to be a CRUD operation or a SqlExecute "
+          "object",
+          i + 1));
+    }
+
+    // execute() is available only once the statement is complete
+    if (!statement.as_object()->has_member("execute")) {
+      throw Exception::logic_error(shcore::str_format(
+          "Statement #%zu is not ready to be executed", i + 1));
+    }
+  }
+
+  std::vector<Batch_statement> batch;
+  std::vector<mysqlshdk::db::mysqlx::Pipelined_message> messages;
+  // index of the statement which corresponds to each of the messages
+  std::vector<std::size_t> indexes;
+
+  batch.reserve(statements->size());
+
+  for (const auto &statement : *statements) {
+    if (const auto crud = statement.as_object<Crud_definition>()) {
+      batch.emplace_back(crud->batch_statement());
+    } else {
+      batch.emplace_back(statement.as_object<SqlExecute>()->batch_statement());
+    }
+
+    if (batch.back().message.has_value()) {
+      messages.emplace_back(std::move(*batch.back().message));
+      indexes.emplace_back(batch.size() - 1);
+    }
+  }
+
+  std::vector<std::shared_ptr<mysqlshdk::db::IResult>> results;
+
+  if (!messages.empty()) {
+    Interruptible intr(this);
+    std::size_t failed = messages.size();
+
+    try {
+      results = _session->execute_pipelined(messages, &failed);
+    } catch (const mysqlshdk::db::Error &error) {
+      std::string message = error.what();
+
+      if (failed < messages.size()) {
+        message = shcore::str_format("Statement #%zu: %s",
+                                     indexes[failed] + 1, message.c_str());
+      }
+
+      throw shcore::Exception::mysql_error_with_code_and_state(
+          message, error.code(), error.sqlstate());
+    }
+  }
+
+  auto result = results.begin();
+
+  for (const auto &statement : batch) {
+    std::shared_ptr<mysqlshdk::db::mysqlx::Result> r;
+
+    // message was moved, but it's still set
+    if (statement.message.has_value()) {
+      r = std::static_pointer_cast<mysqlshdk::db::mysqlx::Result>(*result++);
+    }
+
+    ret_val->emplace_back(statement.wrap_result(std::move(r)));
+  }
+
+  return ret_val;
+}
+
 REGISTER_HELP_PROPERTY(uri, Session);
 REGISTER_HELP(SESSION_URI_BRIEF, "Retrieves the URI for the current session.");
 REGISTER_HELP_FUNCTION(getUri, Session);
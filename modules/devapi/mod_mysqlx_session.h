@@ -26,8 +26,10 @@
 #ifndef MODULES_DEVAPI_MOD_MYSQLX_SESSION_H_
 #define MODULES_DEVAPI_MOD_MYSQLX_SESSION_H_
 
+#include <functional>
 #include <list>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 #include "db/mysqlx/mysqlxclient_clean.h"
@@ -48,6 +50,18 @@ namespace mysqlx {
 
 class Schema;
 class SqlExecute;
+
+/**
+ * Statement which is executed by Session::execute_batch().
+ */
+struct Batch_statement {
+  // not set if there's nothing to be sent to the server
+  std::optional<mysqlshdk::db::mysqlx::Pipelined_message> message;
+  // creates the object which holds the result of the statement
+  std::function<shcore::Value(std::shared_ptr<mysqlshdk::db::mysqlx::Result>)>
+      wrap_result;
+};
+
 /**
  * \ingroup XDevAPI
  * @brief $(SESSION_BRIEF)
@@ -102,6 +116,7 @@ class SHCORE_PUBLIC Session : public ShellBaseSession,
   Undefined releaseSavepoint(String name);
   Undefined rollbackTo(String name);
   SqlResult runSql(String query, Array args);
+  List executeBatch(List statements);
 
  private:
 #elif DOXYGEN_PY
@@ -132,6 +147,7 @@ class SHCORE_PUBLIC Session : public ShellBaseSession,
   None release_savepoint(str name);
   None rollback_to(str name);
   SqlResult run_sql(str query, list args);
+  list execute_batch(list statements);
 
  private:
 #endif
@@ -173,6 +189,7 @@ class SHCORE_PUBLIC Session : public ShellBaseSession,
   std::shared_ptr<SqlExecute> sql(const std::string &statement);
   std::shared_ptr<SqlResult> run_sql(const std::string sql,
                                      const shcore::Array_t &args = {});
+  shcore::Array_t execute_batch(const shcore::Array_t &statements);
   std::string quote_name(const std::string &id);
 
   std::string set_savepoint(const std::string &name = "");
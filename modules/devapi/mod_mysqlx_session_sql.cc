@@ -243,5 +243,30 @@ std::shared_ptr<SqlResult> SqlExecute::execute_sql(
   return result;
 }
 
+Batch_statement SqlExecute::batch_statement() {
+  Batch_statement statement;
+  Mysqlx::Sql::StmtExecute stmt;
+
+  stmt.set_stmt(_sql);
+  stmt.set_namespace_("sql");
+
+  try {
+    insert_bound_values(_parameters, stmt.mutable_args());
+    _parameters->clear();
+  } catch (...) {
+    _parameters->clear();
+    throw;
+  }
+
+  statement.message = std::move(stmt);
+  statement.wrap_result =
+      [](std::shared_ptr<mysqlshdk::db::mysqlx::Result> result) {
+        return shcore::Value::wrap(
+            std::make_shared<SqlResult>(std::move(result)));
+      };
+
+  return statement;
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
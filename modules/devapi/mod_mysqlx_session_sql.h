@@ -38,6 +38,7 @@
 namespace mysqlsh {
 namespace mysqlx {
 class Session;
+struct Batch_statement;
 /**
  * \ingroup XDevAPI
  * $(SQLEXECUTE_BRIEF)
@@ -67,6 +68,12 @@ class SqlExecute : public Dynamic_object,
   }
   std::shared_ptr<SqlResult> execute();
 
+  /**
+   * Prepares this statement to be executed by Session::execute_batch(),
+   * consumes the bound values just like execute() does.
+   */
+  Batch_statement batch_statement();
+
  private:
   std::weak_ptr<Session> _session;
   std::string _sql;
@@ -530,3 +530,10 @@ void TableDelete::set_prepared_stmt() {
   update_limits();
   *m_prep_stmt.mutable_stmt()->mutable_delete_() = message_;
 }
+
+std::optional<mysqlshdk::db::mysqlx::Pipelined_message>
+TableDelete::pipelined_message() {
+  update_limits();
+  insert_bound_values(message_.mutable_args());
+  return message_;
+}
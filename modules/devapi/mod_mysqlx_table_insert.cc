@@ -59,9 +59,13 @@ TableInsert::TableInsert(std::shared_ptr<Table> owner)
   message_.mutable_collection()->set_schema(owner->schema()->name());
   message_.mutable_collection()->set_name(owner->name());
   message_.set_data_model(Mysqlx::Crud::TABLE);
+  auto bind_id = F::bind;
+
   // The values function should not be enabled if values were already given
   add_method("insert", std::bind(&TableInsert::insert, this, _1), "data");
   add_method("values", std::bind(&TableInsert::values, this, _1), "data");
+  add_method("bind", std::bind(&TableInsert::bind_, this, _1, bind_id),
+             "data");
 
   // Registers the dynamic function behavior
   register_dynamic_function(F::insert, F::values,
@@ -72,6 +76,8 @@ TableInsert::TableInsert(std::shared_ptr<Table> owner)
                             F::insert | F::insertFields);
   register_dynamic_function(F::values, F::execute, K_DISABLE_NONE,
                             K_ALLOW_REUSE);
+  // bind() is enabled once the values use placeholders
+  register_dynamic_function(F::bind, K_ENABLE_NONE, F::values, K_ALLOW_REUSE);
 
   // Initial function update
   enable_function(F::insert);
@@ -258,6 +264,7 @@ shcore::Value TableInsert::insert(const shcore::Argument_list &args) {
 
   // Updates the exposed functions
   update_functions(version);
+  if (!_placeholders.empty()) enable_function(F::bind);
   reset_prepared_statement();
 
   return Value(std::static_pointer_cast<Object_bridge>(shared_from_this()));
@@ -338,6 +345,7 @@ shcore::Value TableInsert::values(const shcore::Argument_list &args) {
     }
     // Updates the exposed functions
     update_functions(F::values);
+    if (!_placeholders.empty()) enable_function(F::bind);
     reset_prepared_statement();
   }
   CATCH_AND_TRANSLATE_CRUD_EXCEPTION(get_function_name("values"));
@@ -346,6 +354,73 @@ shcore::Value TableInsert::values(const shcore::Argument_list &args) {
   return Value(std::static_pointer_cast<Object_bridge>(shared_from_this()));
 }
 
+REGISTER_HELP_FUNCTION(bind, TableInsert);
+REGISTER_HELP(TABLEINSERT_BIND_BRIEF,
+              "Binds a value to a specific placeholder used on this "
+              "TableInsert object.");
+REGISTER_HELP(TABLEINSERT_BIND_PARAM,
+              "@param name The name of the placeholder to which the value "
+              "will be bound.");
+REGISTER_HELP(TABLEINSERT_BIND_PARAM1,
+              "@param value The value to be bound on the placeholder.");
+REGISTER_HELP(TABLEINSERT_BIND_RETURNS, "@returns This TableInsert object.");
+REGISTER_HELP(
+    TABLEINSERT_BIND_DETAIL,
+    "Binds the given value to the placeholder with the specified name.");
+REGISTER_HELP(TABLEINSERT_BIND_DETAIL1,
+              "An error will be raised if the placeholder indicated by name "
+              "does not exist.");
+REGISTER_HELP(TABLEINSERT_BIND_DETAIL2,
+              "This function must be called once for each used placeholder or "
+              "an error will be raised when the execute() method is called.");
+REGISTER_HELP(TABLEINSERT_BIND_DETAIL3,
+              "This function is available only if any of the inserted values "
+              "uses a placeholder, i.e. mysqlx.expr(\":name\").");
+
+/**
+ * $(TABLEINSERT_BIND_BRIEF)
+ *
+ * $(TABLEINSERT_BIND_PARAM)
+ *
+ * $(TABLEINSERT_BIND_PARAM1)
+ *
+ * $(TABLEINSERT_BIND_RETURNS)
+ *
+ * $(TABLEINSERT_BIND_DETAIL)
+ *
+ * $(TABLEINSERT_BIND_DETAIL1)
+ *
+ * $(TABLEINSERT_BIND_DETAIL2)
+ *
+ * $(TABLEINSERT_BIND_DETAIL3)
+ *
+ * #### Method Chaining
+ *
+ * This function can be invoked multiple times after values(), if a placeholder
+ * was used, and after execute().
+ *
+ * After this function invocation, the following functions can be invoked:
+ */
+#if DOXYGEN_JS
+/**
+ * - bind(String name, Value value)
+ */
+#elif DOXYGEN_PY
+/**
+ * - bind(str name, Value value)
+ */
+#endif
+/**
+ * - execute()
+ */
+//@{
+#if DOXYGEN_JS
+TableInsert TableInsert::bind(String name, Value value) {}
+#elif DOXYGEN_PY
+TableInsert TableInsert::bind(str name, Value value) {}
+#endif
+//@}
+
 REGISTER_HELP_FUNCTION(execute, TableInsert);
 REGISTER_HELP(TABLEINSERT_EXECUTE_BRIEF, "Executes the insert operation.");
 REGISTER_HELP(TABLEINSERT_EXECUTE_RETURNS,
@@ -404,8 +479,10 @@ shcore::Value TableInsert::execute(const shcore::Argument_list &args) {
   std::shared_ptr<mysqlsh::mysqlx::Result> result;
   try {
     if (message_.mutable_row()->size()) {
-      result = std::make_shared<mysqlsh::mysqlx::Result>(safe_exec(
-          [this]() { return session()->session()->execute_crud(message_); }));
+      result = std::make_shared<mysqlsh::mysqlx::Result>(safe_exec([this]() {
+        insert_bound_values(message_.mutable_args());
+        return session()->session()->execute_crud(message_);
+      }));
     } else {
       result = std::make_shared<mysqlsh::mysqlx::Result>(nullptr);
     }
@@ -416,5 +493,23 @@ shcore::Value TableInsert::execute(const shcore::Argument_list &args) {
                 : shcore::Value::Null();
 }
 
+std::optional<mysqlshdk::db::mysqlx::Pipelined_message>
+TableInsert::pipelined_message() {
+  if (message_.row().empty()) return {};
+  insert_bound_values(message_.mutable_args());
+  return message_;
+}
+
+void TableInsert::set_prepared_stmt() {
+  m_prep_stmt.mutable_stmt()->set_type(
+      Mysqlx::Prepare::Prepare_OneOfMessage_Type_INSERT);
+  message_.clear_args();
+  *m_prep_stmt.mutable_stmt()->mutable_insert() = message_;
+}
+
+shcore::Value TableInsert::this_object() {
+  return Value(std::static_pointer_cast<Object_bridge>(shared_from_this()));
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
@@ -30,6 +30,7 @@
 #define MODULES_DEVAPI_MOD_MYSQLX_TABLE_INSERT_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 #include "modules/devapi/table_crud_definition.h"
 
@@ -50,6 +51,7 @@ class TableInsert : public Table_crud_definition,
   TableInsert insert(String column[, String column, ...]);
   TableInsert insert(JSON columns);
   TableInsert values(Value value[, Value value, ...]);
+  TableInsert bind(String name, Value value);
   Result execute();
 #elif DOXYGEN_PY
   TableInsert insert();
@@ -57,6 +59,7 @@ class TableInsert : public Table_crud_definition,
   TableInsert insert(str column[, str column, ...]);
   TableInsert insert(JSON columns);
   TableInsert values(Value value[, Value value, ...]);
+  TableInsert bind(str name, Value value);
   Result execute();
 #endif
   explicit TableInsert(std::shared_ptr<Table> owner);
@@ -68,8 +71,10 @@ class TableInsert : public Table_crud_definition,
 
  private:
   Mysqlx::Crud::Insert message_;
-
-  bool allow_prepared_statements() override { return false; }
+  std::optional<mysqlshdk::db::mysqlx::Pipelined_message> pipelined_message()
+      override;
+  void set_prepared_stmt() override;
+  shcore::Value this_object() override;
 
   struct F {
     static constexpr Allowed_function_mask insert = 1 << 0;
@@ -77,6 +82,7 @@ class TableInsert : public Table_crud_definition,
     static constexpr Allowed_function_mask execute = 1 << 2;
     static constexpr Allowed_function_mask insertFields = 1 << 3;
     static constexpr Allowed_function_mask insertFieldsAndValues = 1 << 4;
+    static constexpr Allowed_function_mask bind = 1 << 5;
   };
 
   Allowed_function_mask function_name_to_bitmask(
@@ -96,6 +102,9 @@ class TableInsert : public Table_crud_definition,
     if ("insertFieldsAndValues" == s) {
       return F::insertFieldsAndValues;
     }
+    if ("bind" == s) {
+      return F::bind;
+    }
     if ("help" == s) {
       return enabled_functions_;
     }
@@ -1263,5 +1263,17 @@ void TableSelect::set_prepared_stmt() {
   *m_prep_stmt.mutable_stmt()->mutable_find() = message_;
 }
 
+std::optional<mysqlshdk::db::mysqlx::Pipelined_message>
+TableSelect::pipelined_message() {
+  update_limits();
+  insert_bound_values(message_.mutable_args());
+  return message_;
+}
+
+shcore::Value TableSelect::wrap_result(
+    std::shared_ptr<mysqlshdk::db::mysqlx::Result> result) {
+  return shcore::Value::wrap(std::make_shared<RowResult>(std::move(result)));
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
@@ -30,6 +30,7 @@
 #define MODULES_DEVAPI_MOD_MYSQLX_TABLE_SELECT_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 #include "modules/devapi/table_crud_definition.h"
 
@@ -100,6 +101,10 @@ class TableSelect : public Table_crud_definition,
   Mysqlx::Crud::Find message_;
   void set_prepared_stmt() override;
   void update_limits() override { set_limits_on_message(&message_); }
+  std::optional<mysqlshdk::db::mysqlx::Pipelined_message> pipelined_message()
+      override;
+  shcore::Value wrap_result(
+      std::shared_ptr<mysqlshdk::db::mysqlx::Result> result) override;
   void set_lock_contention(const shcore::Argument_list &args);
 
   shcore::Value this_object() override;
@@ -648,3 +648,10 @@ void TableUpdate::set_prepared_stmt() {
   update_limits();
   *m_prep_stmt.mutable_stmt()->mutable_update() = message_;
 }
+
+std::optional<mysqlshdk::db::mysqlx::Pipelined_message>
+TableUpdate::pipelined_message() {
+  update_limits();
+  insert_bound_values(message_.mutable_args());
+  return message_;
+}
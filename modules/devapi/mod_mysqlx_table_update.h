@@ -30,6 +30,7 @@
 #define MODULES_DEVAPI_MOD_MYSQLX_TABLE_UPDATE_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 #include "modules/devapi/table_crud_definition.h"
 
@@ -86,6 +87,8 @@ class TableUpdate : public Table_crud_definition,
 
   void set_prepared_stmt() override;
   void update_limits() override { set_limits_on_message(&message_); }
+  std::optional<mysqlshdk::db::mysqlx::Pipelined_message> pipelined_message()
+      override;
   shcore::Value this_object() override;
 
   struct F {
@@ -71,6 +71,8 @@ ClassicResult::ClassicResult(
   expose("fetchOne", &ClassicResult::fetch_one);
   expose("fetchOneObject", &ClassicResult::_fetch_one_object);
   expose("fetchAll", &ClassicResult::fetch_all);
+  expose("fetchColumns", &ClassicResult::_fetch_columns);
+  expose("fetchBatch", &ClassicResult::_fetch_batch, "size");
   expose("nextDataSet", &ClassicResult::next_data_set);
   expose("nextResult", &ClassicResult::next_result);
   expose("hasData", &ClassicResult::has_data);
@@ -227,6 +229,59 @@ shcore::Array_t ClassicResult::fetch_all() const {
   return array;
 }
 
+// Documentation of the fetchColumns function
+REGISTER_HELP_FUNCTION(fetchColumns, ClassicResult);
+REGISTER_HELP_FUNCTION_TEXT(CLASSICRESULT_FETCHCOLUMNS, R"*(
+Returns a list of ColumnBuffer objects holding the values of every record left
+on the result, one for each of the columns of the result.
+
+@returns A List of ColumnBuffer objects.
+
+The values are decoded directly into a buffer per column, without creating a Row
+object for each of the records, which is considerably faster for big results.
+In Python, the buffers can be accessed without copying them using memoryview().
+)*");
+/**
+ * $(CLASSICRESULT_FETCHCOLUMNS_BRIEF)
+ *
+ * $(CLASSICRESULT_FETCHCOLUMNS)
+ */
+#if DOXYGEN_JS
+List ClassicResult::fetchColumns() {}
+#elif DOXYGEN_PY
+list ClassicResult::fetch_columns() {}
+#endif
+shcore::Array_t ClassicResult::_fetch_columns() const {
+  return ShellBaseResult::fetch_columns(0);
+}
+
+// Documentation of the fetchBatch function
+REGISTER_HELP_FUNCTION(fetchBatch, ClassicResult);
+REGISTER_HELP_FUNCTION_TEXT(CLASSICRESULT_FETCHBATCH, R"*(
+Returns a list of ColumnBuffer objects holding the values of up to size records
+left on the result, one for each of the columns of the result.
+
+@param size The maximum number of records to be fetched.
+
+@returns A List of ColumnBuffer objects or null if there are no more records.
+
+This function can be used to process a big result in fixed size chunks, see
+<<<fetchColumns>>>() for more details.
+)*");
+/**
+ * $(CLASSICRESULT_FETCHBATCH_BRIEF)
+ *
+ * $(CLASSICRESULT_FETCHBATCH)
+ */
+#if DOXYGEN_JS
+List ClassicResult::fetchBatch(Integer size) {}
+#elif DOXYGEN_PY
+list ClassicResult::fetch_batch(int size) {}
+#endif
+shcore::Value ClassicResult::_fetch_batch(int64_t size) const {
+  return ShellBaseResult::fetch_batch(size);
+}
+
 // Documentation of getAffectedRowCount function
 REGISTER_HELP_PROPERTY(affectedRowCount, ClassicResult);
 REGISTER_HELP(CLASSICRESULT_AFFECTEDROWCOUNT_BRIEF,
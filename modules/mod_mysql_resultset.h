@@ -78,6 +78,8 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
   Row fetchOne();
   Dictionary fetchOneObject();
   List fetchAll();
+  List fetchColumns();
+  List fetchBatch(Integer size);
   Integer getAffectedItemsCount();
   Integer getAffectedRowCount();
   Integer getColumnCount();
@@ -120,6 +122,8 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
   Row fetch_one();
   dict fetch_one_object();
   list fetch_all();
+  list fetch_columns();
+  list fetch_batch(int size);
   int get_affected_items_count();
   int get_affected_row_count();
   int get_column_count();
@@ -146,6 +150,8 @@ class SHCORE_PUBLIC ClassicResult : public ShellBaseResult {
   std::shared_ptr<Row> fetch_one() const;
   shcore::Dictionary_t _fetch_one_object();
   shcore::Array_t fetch_all() const;
+  shcore::Array_t _fetch_columns() const;
+  shcore::Value _fetch_batch(int64_t size) const;
   bool next_data_set();
   bool next_result();
 
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/copy/copy.h"
+
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <thread>
+
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+#include "modules/util/load/dump_loader.h"
+
+namespace mysqlsh {
+namespace copy {
+namespace detail {
+
+namespace {
+
+// dump is produced by this process, there's no need to wait long for new data
+constexpr uint64_t k_dump_poll_interval_ms = 100;
+
+// number of chunks each of the dumper threads can have in memory
+constexpr uint64_t k_chunks_per_thread = 2;
+
+bool is_transient(const std::string &name) {
+  // metadata, DDL and index files are read more than once, or are needed
+  // before the data is loaded
+  return !shcore::str_endswith(name, ".json", ".sql", ".idx");
+}
+
+}  // namespace
+
+Load_dump_options load_options(
+    const dump::Dump_options &dump_options,
+    const Copy_load_options &copy_options, bool dry_run,
+    const std::shared_ptr<mysqlshdk::db::ISession> &target) {
+  auto dict = shcore::make_dict();
+
+  for (const auto &option : *copy_options.load_options()) {
+    dict->emplace(option.first, option.second);
+  }
+
+  dict->emplace("threads", static_cast<uint64_t>(dump_options.threads()));
+  dict->emplace("showProgress", dump_options.show_progress());
+  dict->emplace("loadDdl", dump_options.dump_ddl());
+  dict->emplace("loadData", dump_options.dump_data());
+  dict->emplace("loadUsers", dump_options.dump_users());
+  dict->emplace("dryRun", dry_run);
+  // progress of a copy cannot be resumed
+  dict->emplace("progressFile", "");
+  // loader waits until dumper writes all the files, or fails
+  dict->emplace("waitDumpTimeout",
+                static_cast<double>(std::numeric_limits<uint32_t>::max()));
+
+  Load_dump_options options;
+  Load_dump_options::options().unpack(dict, &options);
+
+  options.set_session(target, "");
+  options.set_dump_poll_interval_ms(k_dump_poll_interval_ms);
+  options.validate();
+
+  return options;
+}
+
+mysqlshdk::storage::backend::Memory_storage_ptr create_storage(
+    const dump::Dump_options &options) {
+  return std::make_shared<mysqlshdk::storage::backend::Memory_storage>(
+      options.threads() * options.bytes_per_chunk() * k_chunks_per_thread,
+      is_transient);
+}
+
+void copy(dump::Dumper *dumper, const Load_dump_options &options,
+          const mysqlshdk::storage::backend::Memory_storage_ptr &storage) {
+  std::exception_ptr dumper_exception;
+  std::atomic<bool> dumper_failed{false};
+  std::atomic<bool> dumper_finished{false};
+
+  auto dumper_thread = mysqlsh::spawn_scoped_thread([&]() {
+    mysqlsh::Mysql_thread mysql_thread;
+
+    try {
+      dumper->run();
+    } catch (...) {
+      dumper_exception = std::current_exception();
+      dumper_failed = true;
+      // wake up the loader
+      storage->interrupt();
+    }
+
+    dumper_finished = true;
+  });
+
+  const auto interrupt_dumper = [&]() {
+    if (!dumper_finished) {
+      dumper->interrupt();
+    }
+  };
+
+  const auto wait_for_dumper = [&]() {
+    if (dumper_thread.joinable()) {
+      dumper_thread.join();
+    }
+  };
+
+  shcore::on_leave_scope join_dumper{wait_for_dumper};
+
+  Load_dump_options load_options = options;
+  load_options.set_storage_config(
+      std::make_shared<mysqlshdk::storage::backend::Memory_storage_config>(
+          storage));
+
+  Dump_loader loader{load_options};
+
+  shcore::Interrupt_handler intr_handler([&interrupt_dumper, &loader]() {
+    current_console()->print_warning("Interrupted by user. Canceling...");
+    interrupt_dumper();
+    loader.interrupt();
+    return false;
+  });
+
+  try {
+    // loader expects that the main metadata file already exists
+    if (storage->wait_for("@.json")) {
+      current_console()->print_info(load_options.target_import_info());
+      loader.run();
+    }
+  } catch (...) {
+    const auto dumper_first = dumper_failed.load();
+
+    interrupt_dumper();
+    // wake up the dumper if it's waiting for memory
+    storage->interrupt();
+    wait_for_dumper();
+
+    if (dumper_first && dumper_exception) {
+      std::rethrow_exception(dumper_exception);
+    }
+
+    throw;
+  }
+
+  wait_for_dumper();
+
+  log_info("Peak memory used by the data files: %zu bytes, limit: %zu bytes",
+           storage->peak_transient_memory_used(), storage->memory_limit());
+
+  if (dumper_exception) {
+    std::rethrow_exception(dumper_exception);
+  }
+}
+
+}  // namespace detail
+}  // namespace copy
+}  // namespace mysqlsh
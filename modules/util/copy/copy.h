@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COPY_COPY_H_
+#define MODULES_UTIL_COPY_COPY_H_
+
+#include <memory>
+
+#include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/storage/backend/memory_storage.h"
+
+#include "modules/util/copy/copy_options.h"
+#include "modules/util/dump/dump_instance.h"
+#include "modules/util/dump/dump_options.h"
+#include "modules/util/dump/dump_schemas.h"
+#include "modules/util/dump/dump_tables.h"
+#include "modules/util/dump/dumper.h"
+#include "modules/util/load/load_dump_options.h"
+
+namespace mysqlsh {
+namespace copy {
+
+namespace detail {
+
+Load_dump_options load_options(
+    const dump::Dump_options &dump_options,
+    const Copy_load_options &copy_options, bool dry_run,
+    const std::shared_ptr<mysqlshdk::db::ISession> &target);
+
+mysqlshdk::storage::backend::Memory_storage_ptr create_storage(
+    const dump::Dump_options &options);
+
+void copy(dump::Dumper *dumper, const Load_dump_options &options,
+          const mysqlshdk::storage::backend::Memory_storage_ptr &storage);
+
+}  // namespace detail
+
+/**
+ * Copies data from the source instance (session of the dump options) to the
+ * target instance.
+ *
+ * The dumper writes the files to the memory, loader reads them from there.
+ * The dumper is throttled if the loader is not able to keep up.
+ */
+template <typename Dumper, typename T>
+void copy(const std::shared_ptr<mysqlshdk::db::ISession> &target,
+          Copy_options<T> *options) {
+  // validates the target, needs to be initialized before options are modified
+  const auto load_options = detail::load_options(
+      *options, options->load_options(), options->is_copy_dry_run(), target);
+  const auto storage = detail::create_storage(*options);
+
+  options->set_storage(storage);
+
+  Dumper dumper{*options};
+
+  detail::copy(&dumper, load_options, storage);
+}
+
+inline void copy_instance(
+    const std::shared_ptr<mysqlshdk::db::ISession> &target,
+    Copy_instance_options *options) {
+  copy<dump::Dump_instance>(target, options);
+}
+
+inline void copy_schemas(
+    const std::shared_ptr<mysqlshdk::db::ISession> &target,
+    Copy_schemas_options *options) {
+  copy<dump::Dump_schemas>(target, options);
+}
+
+inline void copy_tables(const std::shared_ptr<mysqlshdk::db::ISession> &target,
+                        Copy_tables_options *options) {
+  copy<dump::Dump_tables>(target, options);
+}
+
+}  // namespace copy
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COPY_COPY_H_
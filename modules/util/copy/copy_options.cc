@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/copy/copy_options.h"
+
+#include <utility>
+
+#include "mysqlshdk/include/scripting/type_info/custom.h"
+#include "mysqlshdk/include/scripting/type_info/generic.h"
+
+namespace mysqlsh {
+namespace copy {
+
+const shcore::Option_pack_def<Copy_load_options> &Copy_load_options::options() {
+  static const auto opts =
+      shcore::Option_pack_def<Copy_load_options>()
+          .optional("analyzeTables",
+                    &Copy_load_options::set_option<std::string>)
+          .optional("deferTableIndexes",
+                    &Copy_load_options::set_option<std::string>)
+          .optional("handleGrantErrors",
+                    &Copy_load_options::set_option<std::string>)
+          .optional("ignoreExistingObjects",
+                    &Copy_load_options::set_option<bool>)
+          .optional("ignoreVersion", &Copy_load_options::set_option<bool>)
+          .optional("loadIndexes", &Copy_load_options::set_option<bool>)
+          .optional("maxBytesPerTransaction",
+                    &Copy_load_options::set_option<std::string>)
+          .optional("schema", &Copy_load_options::set_option<std::string>)
+          .optional("sessionInitSql", &Copy_load_options::set_list_option)
+          .optional("skipBinlog", &Copy_load_options::set_option<bool>)
+          .optional("updateGtidSet",
+                    &Copy_load_options::set_option<std::string>);
+
+  return opts;
+}
+
+void Copy_load_options::set_list_option(const std::string &option,
+                                        const std::vector<std::string> &value) {
+  auto array = shcore::make_array();
+
+  for (const auto &item : value) {
+    array->emplace_back(item);
+  }
+
+  m_load_options->emplace(option, std::move(array));
+}
+
+}  // namespace copy
+}  // namespace mysqlsh
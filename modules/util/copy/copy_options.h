@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COPY_COPY_OPTIONS_H_
+#define MODULES_UTIL_COPY_COPY_OPTIONS_H_
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/libs/storage/backend/memory_storage.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+#include "modules/util/dump/dump_instance_options.h"
+#include "modules/util/dump/dump_schemas_options.h"
+#include "modules/util/dump/dump_tables_options.h"
+
+namespace mysqlsh {
+namespace copy {
+
+/**
+ * Options of the target instance, these are passed to the loader.
+ */
+class Copy_load_options final {
+ public:
+  Copy_load_options() = default;
+
+  Copy_load_options(const Copy_load_options &) = default;
+  Copy_load_options(Copy_load_options &&) = default;
+
+  Copy_load_options &operator=(const Copy_load_options &) = default;
+  Copy_load_options &operator=(Copy_load_options &&) = default;
+
+  ~Copy_load_options() = default;
+
+  static const shcore::Option_pack_def<Copy_load_options> &options();
+
+  /**
+   * Options in the format accepted by the util.loadDump().
+   */
+  const shcore::Dictionary_t &load_options() const { return m_load_options; }
+
+ private:
+  template <typename T>
+  void set_option(const std::string &option, const T &value) {
+    m_load_options->emplace(option, value);
+  }
+
+  void set_list_option(const std::string &option,
+                       const std::vector<std::string> &value);
+
+  shcore::Dictionary_t m_load_options = shcore::make_dict();
+};
+
+template <typename T>
+class Copy_options : public T {
+ public:
+  Copy_options() {
+    // data is not stored anywhere, compressing it is usually a waste of CPU
+    this->set_compression(mysqlshdk::storage::Compression::NONE);
+  }
+
+  Copy_options(const Copy_options &) = default;
+  Copy_options(Copy_options &&) = default;
+
+  Copy_options &operator=(const Copy_options &) = default;
+  Copy_options &operator=(Copy_options &&) = default;
+
+  ~Copy_options() override = default;
+
+  static const shcore::Option_pack_def<Copy_options> &options() {
+    static const auto opts =
+        shcore::Option_pack_def<Copy_options>()
+            .template include<T>()
+            .include(&Copy_options::m_load_options)
+            .on_done(&Copy_options::on_unpacked_options)
+            .on_log(&Copy_options::on_log_options);
+
+    return opts;
+  }
+
+  const Copy_load_options &load_options() const { return m_load_options; }
+
+  /**
+   * In the dry run mode, the dumper writes only the metadata and DDL files,
+   * without acquiring any locks, and the loader runs in the dry run mode
+   * against them.
+   */
+  bool is_copy_dry_run() const { return T::is_dry_run(); }
+
+  bool is_dry_run() const override { return false; }
+
+  /**
+   * Data files are held in memory, each one needs to be bounded, even if
+   * chunking is disabled.
+   */
+  bool split_unchunked_tables() const override { return true; }
+
+  bool dump_data() const override {
+    return !is_copy_dry_run() && T::dump_data();
+  }
+
+  bool consistent_dump() const override {
+    return !is_copy_dry_run() && T::consistent_dump();
+  }
+
+  /**
+   * Redirects the dump to the given storage, progress is going to be reported
+   * by the loader.
+   */
+  void set_storage(
+      const mysqlshdk::storage::backend::Memory_storage_ptr &storage) {
+    this->set_storage_config(
+        std::make_shared<mysqlshdk::storage::backend::Memory_storage_config>(
+            storage));
+    this->set_show_progress(false);
+  }
+
+ private:
+  void on_unpacked_options() {
+    if (this->storage_config() && this->storage_config()->valid()) {
+      throw std::invalid_argument(
+          "The storage options cannot be used when copying data between "
+          "instances.");
+    }
+  }
+
+  void on_log_options(const char *msg) const {
+    log_info("Copy options: %s", msg);
+  }
+
+  Copy_load_options m_load_options;
+};
+
+using Copy_instance_options = Copy_options<dump::Dump_instance_options>;
+using Copy_schemas_options = Copy_options<dump::Dump_schemas_options>;
+using Copy_tables_options = Copy_options<dump::Dump_tables_options>;
+
+}  // namespace copy
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COPY_COPY_OPTIONS_H_
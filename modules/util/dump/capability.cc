@@ -36,6 +36,8 @@ namespace {
 using mysqlshdk::utils::Version;
 
 const std::string k_partition_awareness_capability = "partition_awareness";
+const std::string k_multi_member_gzip_capability = "multi_member_gzip";
+const std::string k_lz4_compression_capability = "lz4_compression";
 
 }  // namespace
 
@@ -43,6 +45,12 @@ std::string id(Capability capability) {
   switch (capability) {
     case Capability::PARTITION_AWARENESS:
       return k_partition_awareness_capability;
+
+    case Capability::MULTI_MEMBER_GZIP:
+      return k_multi_member_gzip_capability;
+
+    case Capability::LZ4_COMPRESSION:
+      return k_lz4_compression_capability;
   }
 
   throw std::logic_error("Should not happen");
@@ -53,6 +61,14 @@ std::string description(Capability capability) {
     case Capability::PARTITION_AWARENESS:
       return "Partition awareness - dumper treats each partition as a separate "
              "table, improving both dump and load times.";
+
+    case Capability::MULTI_MEMBER_GZIP:
+      return "Multi-member gzip - data files are compressed in parallel, as a "
+             "sequence of independent gzip members.";
+
+    case Capability::LZ4_COMPRESSION:
+      return "LZ4 compression - data files are compressed using the LZ4 frame "
+             "format.";
   }
 
   throw std::logic_error("Should not happen");
@@ -62,13 +78,19 @@ Version version_required(Capability capability) {
   switch (capability) {
     case Capability::PARTITION_AWARENESS:
       return Version(8, 0, 27);
+
+    case Capability::MULTI_MEMBER_GZIP:
+    case Capability::LZ4_COMPRESSION:
+      return Version(8, 0, 42);
   }
 
   throw std::logic_error("Should not happen");
 }
 
 bool is_supported(const std::string &id) {
-  if (k_partition_awareness_capability == id) {
+  if (k_partition_awareness_capability == id ||
+      k_multi_member_gzip_capability == id ||
+      k_lz4_compression_capability == id) {
     return true;
   } else {
     return false;
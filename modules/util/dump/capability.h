@@ -35,6 +35,8 @@ namespace dump {
 
 enum class Capability {
   PARTITION_AWARENESS,
+  MULTI_MEMBER_GZIP,
+  LZ4_COMPRESSION,
 };
 
 namespace capability {
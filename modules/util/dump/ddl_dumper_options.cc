@@ -65,12 +65,19 @@ const shcore::Option_pack_def<Ddl_dumper_options>
           .include<Dump_options>()
           .optional("chunking", &Ddl_dumper_options::m_split)
           .optional("bytesPerChunk", &Ddl_dumper_options::set_bytes_per_chunk)
+          .optional("adaptiveChunking",
+                    &Ddl_dumper_options::m_adaptive_chunking)
           .optional("threads", &Ddl_dumper_options::m_threads)
+          .optional("clientSideEncoding",
+                    &Ddl_dumper_options::m_client_side_encoding)
+          .optional("compressionThreads",
+                    &Ddl_dumper_options::set_compression_threads_option)
           .optional("triggers", &Ddl_dumper_options::m_dump_triggers)
           .optional("tzUtc", &Ddl_dumper_options::m_timezone_utc)
           .optional("ddlOnly", &Ddl_dumper_options::m_ddl_only)
           .optional("dataOnly", &Ddl_dumper_options::m_data_only)
           .optional("dryRun", &Ddl_dumper_options::m_dry_run)
+          .optional("metadataCache", &Ddl_dumper_options::m_metadata_cache)
           .optional("consistent", &Ddl_dumper_options::m_consistent_dump)
           .optional("skipConsistencyChecks",
                     &Ddl_dumper_options::m_skip_consistency_checks)
@@ -132,6 +139,20 @@ void Ddl_dumper_options::on_unpacked_options() {
         "The value of 'threads' option must be greater than 0.");
   }
 
+  if (m_adaptive_chunking && !split()) {
+    throw std::invalid_argument(
+        "The option 'adaptiveChunking' cannot be used if the 'chunking' "
+        "option is set to false.");
+  }
+
+  if (compression_threads() > 0 &&
+      mysqlshdk::storage::Compression::ZSTD != compression() &&
+      mysqlshdk::storage::Compression::GZIP != compression()) {
+    throw std::invalid_argument(
+        "The 'compressionThreads' option can only be used with the \"zstd\" "
+        "or \"gzip\" compression.");
+  }
+
   if (m_ddl_only && m_data_only) {
     throw std::invalid_argument(
         "The 'ddlOnly' and 'dataOnly' options cannot be both set to true.");
@@ -157,7 +178,7 @@ void Ddl_dumper_options::set_bytes_per_chunk(const std::string &value) {
         "The option 'bytesPerChunk' cannot be set to an empty string.");
   }
 
-  if (!split()) {
+  if (!split() && !split_unchunked_tables()) {
     throw std::invalid_argument(
         "The option 'bytesPerChunk' cannot be used if the 'chunking' "
         "option is set to false.");
@@ -166,5 +187,9 @@ void Ddl_dumper_options::set_bytes_per_chunk(const std::string &value) {
   m_bytes_per_chunk = expand_to_bytes(value);
 }
 
+void Ddl_dumper_options::set_compression_threads_option(uint64_t value) {
+  set_compression_threads(value);
+}
+
 }  // namespace dump
 }  // namespace mysqlsh
@@ -53,6 +53,14 @@ class Ddl_dumper_options : public Dump_options {
 
   uint64_t bytes_per_chunk() const override { return m_bytes_per_chunk; }
 
+  bool split_unchunked_tables() const override { return false; }
+
+  bool adaptive_chunking() const override { return m_adaptive_chunking; }
+
+  std::string metadata_cache() const override { return m_metadata_cache; }
+
+  bool client_side_encoding() const override { return m_client_side_encoding; }
+
   std::size_t threads() const override { return m_threads; }
 
   bool is_export_only() const override { return false; }
@@ -91,6 +99,7 @@ class Ddl_dumper_options : public Dump_options {
 
  private:
   void set_bytes_per_chunk(const std::string &value);
+  void set_compression_threads_option(uint64_t value);
   void set_ocimds(bool value);
   void set_compatibility_options(const std::vector<std::string> &options);
 
@@ -102,6 +111,7 @@ class Ddl_dumper_options : public Dump_options {
 
   bool m_split = true;
   uint64_t m_bytes_per_chunk;
+  bool m_adaptive_chunking = false;
   uint64_t m_threads = 4;
 
   bool m_dump_triggers = true;
@@ -111,6 +121,8 @@ class Ddl_dumper_options : public Dump_options {
   bool m_dry_run = false;
   bool m_consistent_dump = true;
   bool m_skip_consistency_checks = false;
+  std::string m_metadata_cache;
+  bool m_client_side_encoding = false;
 };
 
 }  // namespace dump
@@ -25,10 +25,274 @@
 
 #include "modules/util/dump/dialect_dump_writer.h"
 
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DIALECT_DUMP_WRITER_SSE2
+#include <emmintrin.h>
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+// AVX2 is not a part of the baseline, kernel is compiled for that target and
+// selected at runtime
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define DIALECT_DUMP_WRITER_AVX2
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define DIALECT_DUMP_WRITER_NEON
+#include <arm_neon.h>
+#endif
+
 namespace mysqlsh {
 namespace dump {
 namespace detail {
 
+namespace {
+
+/**
+ * Set of characters which need to be escaped, without duplicates.
+ */
+struct Escaped_chars {
+  char chars[16] = {};
+  std::size_t size = 0;
+  bool table[256] = {};
+
+  constexpr void add(char c) {
+    auto &escaped = table[static_cast<unsigned char>(c)];
+
+    if (!escaped) {
+      escaped = true;
+      chars[size++] = c;
+    }
+  }
+};
+
+template <class T>
+constexpr Escaped_chars escaped_chars() {
+  Escaped_chars result;
+
+  // characters written using the escape sequences
+  for (const auto c : {'\0', '\b', '\n', '\r', '\t', '\x1A'}) {
+    result.add(c);
+  }
+
+  result.add(T::fields_escaped_by[0]);
+  result.add(T::fields_terminated_by[0]);
+  result.add(T::lines_terminated_by[0]);
+
+  if constexpr (shcore::array_size(T::fields_enclosed_by) > 1) {
+    result.add(T::fields_enclosed_by[0]);
+  }
+
+  return result;
+}
+
+/**
+ * Characters escaped by the Dialect_dump_writer<T>, computed at compile time,
+ * so that the kernels are specialized for each of the dialects.
+ */
+template <class T>
+struct Escaped {
+  static constexpr Escaped_chars value = escaped_chars<T>();
+};
+
+template <class T>
+const char *find_escaped_scalar(const char *p, const char *end) {
+  for (; p < end; ++p) {
+    if (Escaped<T>::value.table[static_cast<unsigned char>(*p)]) {
+      return p;
+    }
+  }
+
+  return end;
+}
+
+#if defined(DIALECT_DUMP_WRITER_SSE2)
+
+inline std::size_t first_set_bit(uint32_t mask) {
+#ifdef _WIN32
+  unsigned long x = 0;
+  (void)_BitScanForward(&x, mask);
+  return x;
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+/**
+ * Compares each byte of the block with all the escaped characters, comparisons
+ * are unrolled at compile time.
+ */
+template <class T, std::size_t I = 0>
+inline __m128i match_sse2(__m128i block) {
+  constexpr auto &escaped = Escaped<T>::value;
+  const auto matches =
+      _mm_cmpeq_epi8(block, _mm_set1_epi8(escaped.chars[I]));
+
+  if constexpr (I + 1 < escaped.size) {
+    return _mm_or_si128(matches, match_sse2<T, I + 1>(block));
+  } else {
+    return matches;
+  }
+}
+
+template <class T>
+const char *find_escaped_sse2(const char *p, const char *end) {
+  while (end - p >= 16) {
+    const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+
+    if (const auto mask = static_cast<uint32_t>(
+            _mm_movemask_epi8(match_sse2<T>(block)))) {
+      return p + first_set_bit(mask);
+    }
+
+    p += 16;
+  }
+
+  return find_escaped_scalar<T>(p, end);
+}
+
+#endif  // DIALECT_DUMP_WRITER_SSE2
+
+#if defined(DIALECT_DUMP_WRITER_AVX2)
+
+template <class T, std::size_t I = 0>
+__attribute__((target("avx2"))) inline __m256i match_avx2(__m256i block) {
+  constexpr auto &escaped = Escaped<T>::value;
+  const auto matches =
+      _mm256_cmpeq_epi8(block, _mm256_set1_epi8(escaped.chars[I]));
+
+  if constexpr (I + 1 < escaped.size) {
+    return _mm256_or_si256(matches, match_avx2<T, I + 1>(block));
+  } else {
+    return matches;
+  }
+}
+
+template <class T>
+__attribute__((target("avx2"))) const char *find_escaped_avx2(
+    const char *p, const char *end) {
+  while (end - p >= 32) {
+    const auto block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+
+    if (const auto mask = static_cast<uint32_t>(
+            _mm256_movemask_epi8(match_avx2<T>(block)))) {
+      return p + __builtin_ctz(mask);
+    }
+
+    p += 32;
+  }
+
+  // less than 32 bytes left
+  return find_escaped_sse2<T>(p, end);
+}
+
+#endif  // DIALECT_DUMP_WRITER_AVX2
+
+#if defined(DIALECT_DUMP_WRITER_NEON)
+
+template <class T, std::size_t I = 0>
+inline uint8x16_t match_neon(uint8x16_t block) {
+  constexpr auto &escaped = Escaped<T>::value;
+  const auto matches =
+      vceqq_u8(block, vdupq_n_u8(static_cast<uint8_t>(escaped.chars[I])));
+
+  if constexpr (I + 1 < escaped.size) {
+    return vorrq_u8(matches, match_neon<T, I + 1>(block));
+  } else {
+    return matches;
+  }
+}
+
+template <class T>
+const char *find_escaped_neon(const char *p, const char *end) {
+  while (end - p >= 16) {
+    const auto matches =
+        match_neon<T>(vld1q_u8(reinterpret_cast<const uint8_t *>(p)));
+
+    // narrow the 128-bit result to a 64-bit mask with 4 bits per byte
+    const uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+
+    if (mask) {
+      return p + (__builtin_ctzll(mask) >> 2);
+    }
+
+    p += 16;
+  }
+
+  return find_escaped_scalar<T>(p, end);
+}
+
+#endif  // DIALECT_DUMP_WRITER_NEON
+
+}  // namespace
+
+const std::vector<Escape_kernel> &supported_escape_kernels() {
+  static const auto kernels = []() {
+    std::vector<Escape_kernel> result{Escape_kernel::SCALAR};
+
+#if defined(DIALECT_DUMP_WRITER_SSE2)
+    result.emplace_back(Escape_kernel::SSE2);
+#endif  // DIALECT_DUMP_WRITER_SSE2
+
+#if defined(DIALECT_DUMP_WRITER_AVX2)
+    if (__builtin_cpu_supports("avx2")) {
+      result.emplace_back(Escape_kernel::AVX2);
+    }
+#endif  // DIALECT_DUMP_WRITER_AVX2
+
+#if defined(DIALECT_DUMP_WRITER_NEON)
+    result.emplace_back(Escape_kernel::NEON);
+#endif  // DIALECT_DUMP_WRITER_NEON
+
+    return result;
+  }();
+
+  return kernels;
+}
+
+template <class T>
+Escape_finder escape_finder(Escape_kernel kernel) {
+  switch (kernel) {
+    case Escape_kernel::SCALAR:
+      return find_escaped_scalar<T>;
+
+#if defined(DIALECT_DUMP_WRITER_SSE2)
+    case Escape_kernel::SSE2:
+      return find_escaped_sse2<T>;
+#endif  // DIALECT_DUMP_WRITER_SSE2
+
+#if defined(DIALECT_DUMP_WRITER_AVX2)
+    case Escape_kernel::AVX2:
+      if (__builtin_cpu_supports("avx2")) {
+        return find_escaped_avx2<T>;
+      }
+      break;
+#endif  // DIALECT_DUMP_WRITER_AVX2
+
+#if defined(DIALECT_DUMP_WRITER_NEON)
+    case Escape_kernel::NEON:
+      return find_escaped_neon<T>;
+#endif  // DIALECT_DUMP_WRITER_NEON
+
+    default:
+      break;
+  }
+
+  throw std::invalid_argument("Escape kernel is not supported");
+}
+
+// only dialects which set FIELDS ESCAPED BY
+template Escape_finder escape_finder<default_traits>(Escape_kernel);
+template Escape_finder escape_finder<csv_traits>(Escape_kernel);
+template Escape_finder escape_finder<tsv_traits>(Escape_kernel);
+template Escape_finder escape_finder<csv_unix_traits>(Escape_kernel);
+
 constexpr char default_traits::lines_terminated_by[];
 constexpr char default_traits::fields_escaped_by[];
 constexpr char default_traits::fields_terminated_by[];
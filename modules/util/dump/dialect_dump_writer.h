@@ -82,6 +82,45 @@ struct csv_unix_traits : public dialect_traits {
   static constexpr bool fields_optionally_enclosed = false;
 };
 
+/**
+ * Implementations of the search for characters which need to be escaped.
+ */
+enum class Escape_kernel {
+  SCALAR,
+  SSE2,
+  AVX2,
+  NEON,
+};
+
+/**
+ * Returns pointer to the first character in [begin, end) which needs to be
+ * escaped, or end if there's none.
+ */
+using Escape_finder = const char *(*)(const char *begin, const char *end);
+
+/**
+ * Kernels which are supported by the current CPU, the fastest one is the last.
+ */
+const std::vector<Escape_kernel> &supported_escape_kernels();
+
+/**
+ * Provides the search for characters escaped by the Dialect_dump_writer<T>,
+ * using the given kernel.
+ *
+ * @throws std::invalid_argument if kernel is not supported
+ */
+template <class T>
+Escape_finder escape_finder(Escape_kernel kernel);
+
+/**
+ * Provides the search for characters escaped by the Dialect_dump_writer<T>,
+ * using the fastest kernel supported by the current CPU.
+ */
+template <class T>
+Escape_finder escape_finder() {
+  return escape_finder<T>(supported_escape_kernels().back());
+}
+
 /**
  * This class provides a bit more optimized implementation of Text_dump_writer
  * and intends to only handle dialects supported by import/export utilities. If
@@ -102,6 +141,10 @@ class Dialect_dump_writer : public Dump_writer {
                   "Field terminator needs to be 1 character long");
     static_assert(s_fields_enclosed_by_length <= 1,
                   "FIELDS ENCLOSED BY is a single character (can be not set)");
+
+    if constexpr (1 == s_fields_escaped_by_length) {
+      m_find_escaped = escape_finder<T>();
+    }
   }
 
   Dialect_dump_writer(const Dialect_dump_writer &) = delete;
@@ -115,8 +158,8 @@ class Dialect_dump_writer : public Dump_writer {
  private:
   void store_preamble(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Encoding_type> &pre_encoded_columns) override {
-    read_metadata(metadata, pre_encoded_columns);
+      const std::vector<Encoding_type> &encoded_columns) override {
+    read_metadata(metadata, encoded_columns);
 
     // no preamble
   }
@@ -134,7 +177,7 @@ class Dialect_dump_writer : public Dump_writer {
   }
 
   void read_metadata(const std::vector<mysqlshdk::db::Column> &metadata,
-                     const std::vector<Encoding_type> &pre_encoded_columns) {
+                     const std::vector<Encoding_type> &encoded_columns) {
     m_num_fields = static_cast<uint32_t>(metadata.size());
 
     m_is_string_type.clear();
@@ -155,7 +198,10 @@ class Dialect_dump_writer : public Dump_writer {
 
     for (uint32_t i = 0; i < m_num_fields; ++i) {
       const auto type = metadata[i].get_type();
-      const auto is_string = mysqlshdk::db::is_string_type(type);
+      // values encoded by the writer are stored as strings, just like the ones
+      // encoded by the server
+      const auto is_string = mysqlshdk::db::is_string_type(type) ||
+                             encoded_by_writer(encoded_columns, i);
 
       m_is_string_type[i] = is_string;
       // bit fields are transferred in binary format, should not be inspected
@@ -167,11 +213,16 @@ class Dialect_dump_writer : public Dump_writer {
       m_needs_escape[i] = Escape_type::FULL;
       if (m_is_number_type[i]) {
         m_needs_escape[i] = Escape_type::NONE;
-      } else if (pre_encoded_columns.size() == metadata.size()) {
-        if (pre_encoded_columns[i] == Encoding_type::BASE64)
+      } else if (encoded_columns.size() == metadata.size()) {
+        if (encoded_columns[i] == Encoding_type::BASE64)
           m_needs_escape[i] = Escape_type::BASE64;
-        else if (pre_encoded_columns[i] == Encoding_type::HEX)
+        else if (encoded_columns[i] == Encoding_type::HEX)
           m_needs_escape[i] = Escape_type::NONE;
+        // none of the dialects escapes characters used by the encodings
+        else if (encoded_columns[i] == Encoding_type::ENCODE_BASE64)
+          m_needs_escape[i] = Escape_type::ENCODE_BASE64;
+        else if (encoded_columns[i] == Encoding_type::ENCODE_HEX)
+          m_needs_escape[i] = Escape_type::ENCODE_HEX;
       }
 
       if (!T::fields_optionally_enclosed || is_string) {
@@ -219,6 +270,12 @@ class Dialect_dump_writer : public Dump_writer {
         case Escape_type::NONE:
           store_field<0>(data, length);
           break;
+        case Escape_type::ENCODE_BASE64:
+          buffer()->append_base64(data, length);
+          break;
+        case Escape_type::ENCODE_HEX:
+          buffer()->append_hex(data, length);
+          break;
       }
       quote_field(idx);
     }
@@ -245,71 +302,51 @@ class Dialect_dump_writer : public Dump_writer {
     buffer()->will_write(2 * length);
     const auto end = data + length;
 
-    for (auto p = data; p != end; ++p) {
-      const auto c = *p;
-      char to_write = 0;
-
-      // note: this doesn't produce output consistent with SELECT .. INTO
-      // OUTFILE (i.e. tabs are escaped), but LOAD DATA INFILE handles
-      // this correctly and escaping i.e. carriage return characters helps
-      // with readability
+    for (auto p = data;;) {
+      // characters which do not need to be escaped are copied in bulk
+      const auto next = m_find_escaped(p, end);
+      buffer()->append(p, next - p);
 
-      switch (c) {
-        case '\0':
-          to_write = '0';
-          break;
-
-        case '\b':
-          to_write = 'b';
-          break;
+      if (end == next) {
+        break;
+      }
 
-        case '\n':
-          to_write = 'n';
-          break;
+      buffer()->append(T::fields_escaped_by[0]);
+      buffer()->append(escaped(*next));
+      p = next + 1;
+    }
+  }
 
-        case '\r':
-          to_write = 'r';
-          break;
+  static inline char escaped(char c) {
+    // note: this doesn't produce output consistent with SELECT .. INTO
+    // OUTFILE (i.e. tabs are escaped), but LOAD DATA INFILE handles
+    // this correctly and escaping i.e. carriage return characters helps
+    // with readability
 
-        case '\t':
-          to_write = 't';
-          break;
+    switch (c) {
+      case '\0':
+        return '0';
 
-        case 0x1A:  // ASCII 26
-          to_write = 'Z';
-          break;
+      case '\b':
+        return 'b';
 
-        default:
-          if (c == T::fields_escaped_by[0] || c == T::fields_terminated_by[0] ||
-              c == T::lines_terminated_by[0] || should_escape(c)) {
-            to_write = c;
-          }
-          break;
-      }
+      case '\n':
+        return 'n';
 
-      if (0 != to_write) {
-        buffer()->append(T::fields_escaped_by[0]);
-        buffer()->append(to_write);
-      } else {
-        buffer()->append(c);
-      }
-    }
-  }
+      case '\r':
+        return 'r';
 
-  inline bool should_escape(char c) {
-    return should_escape<s_fields_enclosed_by_length>(c);
-  }
+      case '\t':
+        return 't';
 
-  template <int N, std::enable_if_t<0 == N, int> = 0>
-  inline bool should_escape(char) {
-    // FIELDS ENCLOSED BY character is not specified, nothing to do
-    return false;
-  }
+      case 0x1A:  // ASCII 26
+        return 'Z';
 
-  template <int N, std::enable_if_t<1 == N, int> = 0>
-  inline bool should_escape(char c) {
-    // FIELDS ENCLOSED BY character is specified, escape it
-    return c == T::fields_enclosed_by[0];
+      default:
+        // FIELDS ESCAPED BY, FIELDS TERMINATED BY, first character of LINES
+        // TERMINATED BY and FIELDS ENCLOSED BY (if set) are written as is
+        return c;
+    }
   }
 
   inline void quote_field(uint32_t idx) {
@@ -383,6 +420,8 @@ class Dialect_dump_writer : public Dump_writer {
   std::vector<int> m_is_number_type;
 
   std::vector<Escape_type> m_needs_escape;
+
+  Escape_finder m_find_escaped = nullptr;
 };
 
 }  // namespace detail
@@ -85,6 +85,8 @@ class Dump_options {
 
   mysqlshdk::storage::Compression compression() const { return m_compression; }
 
+  uint64_t compression_threads() const { return m_compression_threads; }
+
   const std::shared_ptr<mysqlshdk::db::ISession> &session() const {
     return m_session;
   }
@@ -121,6 +123,18 @@ class Dump_options {
 
   virtual uint64_t bytes_per_chunk() const = 0;
 
+  /**
+   * If set, data of the tables which are not chunked is still written to
+   * multiple files of roughly bytes_per_chunk() bytes.
+   */
+  virtual bool split_unchunked_tables() const = 0;
+
+  virtual bool adaptive_chunking() const = 0;
+
+  virtual std::string metadata_cache() const = 0;
+
+  virtual bool client_side_encoding() const = 0;
+
   virtual std::size_t threads() const = 0;
 
   virtual bool is_export_only() const = 0;
@@ -156,6 +170,12 @@ class Dump_options {
     m_compression = compression;
   }
 
+  void set_compression_threads(uint64_t threads) {
+    m_compression_threads = threads;
+  }
+
+  void set_show_progress(bool show) { m_show_progress = show; }
+
   void set_mds_compatibility(
       const std::optional<mysqlshdk::utils::Version> &mds) {
     m_mds = mds;
@@ -232,6 +252,7 @@ class Dump_options {
   bool m_show_progress;
   mysqlshdk::storage::Compression m_compression =
       mysqlshdk::storage::Compression::ZSTD;
+  uint64_t m_compression_threads = 0;
   mysqlshdk::storage::Config_ptr m_storage_config;
 
   std::string m_character_set = "utf8mb4";
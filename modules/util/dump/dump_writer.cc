@@ -30,6 +30,7 @@
 #include <utility>
 
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_encoding.h"
 #include "mysqlshdk/libs/utils/utils_net.h"
 
 #include "modules/util/dump/dump_errors.h"
@@ -44,6 +45,11 @@ namespace {
 
 constexpr uint64_t k_write_idx_every = 1024 * 1024;  // bytes
 
+// rows are encoded into a buffer, which is written to the output file once it
+// holds at least this many bytes, this greatly reduces the number of calls to
+// (possibly compressed) IFile::write() when dumping narrow tables
+constexpr std::size_t k_write_block_size = 2 * 1024 * 1024;  // bytes
+
 }  // namespace
 
 Dump_write_result &Dump_write_result::operator+=(const Dump_write_result &rhs) {
@@ -73,6 +79,11 @@ void Dump_writer::Buffer::clear() noexcept {
   m_fixed_length_remaining = m_fixed_length;
 }
 
+void Dump_writer::Buffer::start_row() {
+  m_fixed_length_remaining = m_fixed_length;
+  will_write(0);
+}
+
 void Dump_writer::Buffer::set_fixed_length(std::size_t fixed_length) {
   will_write(fixed_length);
 
@@ -132,7 +143,25 @@ void Dump_writer::Buffer::write_base64_data(const char *data,
   }
 }
 
-Dump_writer::Dump_writer() : m_buffer(std::make_unique<Buffer>()) {}
+void Dump_writer::Buffer::append_base64(const char *data, std::size_t length) {
+  will_write(shcore::base64_encoded_length(length));
+
+  const auto written = shcore::encode_base64(data, length, m_ptr);
+  m_ptr += written;
+  m_length += written;
+}
+
+void Dump_writer::Buffer::append_hex(const char *data, std::size_t length) {
+  will_write(2 * length);
+
+  const auto written = shcore::encode_hex(data, length, m_ptr);
+  m_ptr += written;
+  m_length += written;
+}
+
+Dump_writer::Dump_writer()
+    : m_buffer(std::make_unique<Buffer>()),
+      m_write_block_size(k_write_block_size) {}
 
 Dump_writer::~Dump_writer() {
   try {
@@ -168,60 +197,82 @@ void Dump_writer::close() {
 
 Dump_write_result Dump_writer::write_preamble(
     const std::vector<mysqlshdk::db::Column> &metadata,
-    const std::vector<Encoding_type> &pre_encoded_columns) {
+    const std::vector<Encoding_type> &encoded_columns) {
   buffer()->clear();
-  store_preamble(metadata, pre_encoded_columns);
+  store_preamble(metadata, encoded_columns);
   return write_buffer("preamble");
 }
 
 Dump_write_result Dump_writer::write_row(const mysqlshdk::db::IRow *row) {
-  buffer()->clear();
+  const auto offset = buffer()->length();
+
+  buffer()->start_row();
   store_row(row);
-  auto result = write_buffer("row", true);
+
+  Dump_write_result result;
+
+  result.write_data(buffer()->length() - offset);
+  result.write_row();
 
   m_bytes_written += result.data_bytes();
   m_bytes_written_per_idx += result.data_bytes();
 
   if (m_index && m_bytes_written_per_idx >= k_write_idx_every) {
+    // offsets refer to the data stream, row does not have to be flushed yet
     write_index();
     // make sure offsets are written when close to the k_write_idx_every
     m_bytes_written_per_idx %= k_write_idx_every;
   }
 
+  if (buffer()->length() >= m_write_block_size) {
+    result.write_bytes(flush_buffer("row"));
+  }
+
   return result;
 }
 
 Dump_write_result Dump_writer::write_postamble() {
-  buffer()->clear();
+  // postamble follows any rows which are still buffered
+  const auto offset = buffer()->length();
+
   store_postamble();
-  return write_buffer("postamble");
-}
 
-Dump_write_result Dump_writer::write_buffer(const char *context,
-                                            bool row) const {
-  assert(m_output);
+  Dump_write_result result;
+
+  result.write_data(buffer()->length() - offset);
+  result.write_bytes(flush_buffer("postamble"));
 
+  return result;
+}
+
+Dump_write_result Dump_writer::write_buffer(const char *context) const {
   Dump_write_result result;
 
   result.write_data(buffer()->length());
+  result.write_bytes(flush_buffer(context));
 
-  if (row) {
-    result.write_row();
-  }
+  return result;
+}
+
+uint64_t Dump_writer::flush_buffer(const char *context) const {
+  assert(m_output);
 
-  if (result.data_bytes() > 0) {
-    const auto bytes_written =
-        m_output->write(buffer()->data(), result.data_bytes());
+  const auto length = buffer()->length();
+  uint64_t result = 0;
+
+  if (length > 0) {
+    const auto bytes_written = m_output->write(buffer()->data(), length);
 
     if (bytes_written < 0) {
       THROW_ERROR(SHERR_DUMP_DW_WRITE_FAILED, context,
                   m_output->full_path().masked().c_str());
     }
 
-    result.write_bytes(m_compressed ? m_compressed->latest_io_size()
-                                    : bytes_written);
+    result = m_compressed ? m_compressed->latest_io_size() : bytes_written;
   }
 
+  buffer()->clear();
+
   return result;
 }
 
@@ -40,7 +40,7 @@
 namespace mysqlsh {
 namespace dump {
 
-enum class Escape_type { NONE, FULL, BASE64 };
+enum class Escape_type { NONE, FULL, BASE64, ENCODE_BASE64, ENCODE_HEX };
 
 class Dump_write_result final {
  public:
@@ -78,7 +78,12 @@ class Dump_write_result final {
 
 class Dump_writer {
  public:
-  enum class Encoding_type { NONE, BASE64, HEX };
+  /**
+   * Encoding of the values of a column:
+   *  - BASE64, HEX - values were encoded by the server,
+   *  - ENCODE_BASE64, ENCODE_HEX - raw values are encoded by the writer.
+   */
+  enum class Encoding_type { NONE, BASE64, HEX, ENCODE_BASE64, ENCODE_HEX };
 
   Dump_writer();
 
@@ -100,7 +105,7 @@ class Dump_writer {
 
   Dump_write_result write_preamble(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Encoding_type> &pre_encoded_columns = {});
+      const std::vector<Encoding_type> &encoded_columns = {});
 
   Dump_write_result write_row(const mysqlshdk::db::IRow *row);
 
@@ -146,8 +151,24 @@ class Dump_writer {
 
     void write_base64_data(const char *data, std::size_t length);
 
+    /**
+     * Encodes the data using base64 (without line breaks) and appends it.
+     */
+    void append_base64(const char *data, std::size_t length);
+
+    /**
+     * Encodes the data using hexadecimal digits and appends it.
+     */
+    void append_hex(const char *data, std::size_t length);
+
     void clear() noexcept;
 
+    /**
+     * Prepares the buffer for the next row, data of the previous rows is
+     * preserved.
+     */
+    void start_row();
+
     void set_fixed_length(std::size_t fixed_length);
 
     void will_write(std::size_t bytes);
@@ -165,16 +186,33 @@ class Dump_writer {
 
   inline Buffer *buffer() const noexcept { return m_buffer.get(); }
 
+  /**
+   * Checks if values of the given column are encoded by the writer.
+   */
+  static inline bool encoded_by_writer(
+      const std::vector<Encoding_type> &encoded_columns, uint32_t idx) {
+    return idx < encoded_columns.size() &&
+           (Encoding_type::ENCODE_BASE64 == encoded_columns[idx] ||
+            Encoding_type::ENCODE_HEX == encoded_columns[idx]);
+  }
+
  private:
   virtual void store_preamble(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Encoding_type> &pre_encoded_columns) = 0;
+      const std::vector<Encoding_type> &encoded_columns) = 0;
 
   virtual void store_row(const mysqlshdk::db::IRow *row) = 0;
 
   virtual void store_postamble() = 0;
 
-  Dump_write_result write_buffer(const char *context, bool row = false) const;
+  Dump_write_result write_buffer(const char *context) const;
+
+  /**
+   * Writes all buffered data to the output file and clears the buffer.
+   *
+   * @returns Number of bytes written to the output file.
+   */
+  uint64_t flush_buffer(const char *context) const;
 
   void write_index();
 
@@ -189,6 +227,13 @@ class Dump_writer {
   uint64_t m_bytes_written = 0;
 
   uint64_t m_bytes_written_per_idx = 0;
+
+  // buffered rows are written out once they occupy at least this many bytes
+  std::size_t m_write_block_size;
+
+#ifdef FRIEND_TEST
+  FRIEND_TEST(Dump_writer_test, batched_rows);
+#endif  // FRIEND_TEST
 };
 
 }  // namespace dump
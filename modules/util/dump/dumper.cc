@@ -26,11 +26,15 @@
 #include "modules/util/dump/dumper.h"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -49,6 +53,8 @@
 #include "mysqlshdk/libs/mysql/binlog_utils.h"
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/compression/gz_file.h"
+#include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/utils.h"
 #include "mysqlshdk/libs/textui/textui.h"
@@ -74,6 +80,7 @@
 #include "modules/util/dump/dump_errors.h"
 #include "modules/util/dump/dump_manifest.h"
 #include "modules/util/dump/indexes.h"
+#include "modules/util/dump/instance_cache_snapshot.h"
 #include "modules/util/dump/schema_dumper.h"
 #include "modules/util/dump/text_dump_writer.h"
 #include "modules/util/upgrade_check.h"
@@ -93,6 +100,9 @@ namespace {
 static constexpr const int k_mysql_server_net_write_timeout = 30 * 60;
 static constexpr const int k_mysql_server_wait_timeout = 365 * 24 * 60 * 60;
 
+// zstd compressed files are split into frames of this size
+static constexpr const std::size_t k_zstd_frame_size = 16 * 1024 * 1024;
+
 FI_DEFINE(dumper, [](const mysqlshdk::utils::FI::Args &args) {
   throw std::runtime_error(args.get_string("msg"));
 });
@@ -376,6 +386,67 @@ class Dumper::Synchronize_workers final {
   uint16_t m_count = 0;
 };
 
+/**
+ * Tasks fetching the metadata, executed by the main thread and by the worker
+ * threads. Each thread claims the next task which was not yet started, so all
+ * tasks are executed even if some of the worker threads do not join.
+ */
+class Dumper::Metadata_tasks final {
+ public:
+  Metadata_tasks() = delete;
+
+  explicit Metadata_tasks(std::vector<Instance_cache_builder::Task> &&tasks)
+      : m_tasks(std::move(tasks)), m_exceptions(m_tasks.size()) {}
+
+  Metadata_tasks(const Metadata_tasks &) = delete;
+  Metadata_tasks(Metadata_tasks &&) = delete;
+
+  Metadata_tasks &operator=(const Metadata_tasks &) = delete;
+  Metadata_tasks &operator=(Metadata_tasks &&) = delete;
+
+  ~Metadata_tasks() = default;
+
+  inline std::size_t size() const { return m_tasks.size(); }
+
+  void execute(const std::shared_ptr<mysqlshdk::db::ISession> &session) {
+    for (auto idx = m_next++; idx < m_tasks.size(); idx = m_next++) {
+      try {
+        m_tasks[idx](session);
+      } catch (...) {
+        m_exceptions[idx] = std::current_exception();
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_finished;
+      }
+      m_condition.notify_one();
+    }
+  }
+
+  void wait_for_all() {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_condition.wait(lock,
+                       [this]() { return m_finished >= m_tasks.size(); });
+    }
+
+    for (const auto &exception : m_exceptions) {
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+  }
+
+ private:
+  std::vector<Instance_cache_builder::Task> m_tasks;
+  std::vector<std::exception_ptr> m_exceptions;
+  std::atomic<std::size_t> m_next{0};
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::size_t m_finished = 0;
+};
+
 class Dumper::Dump_writer_controller {
  public:
   using Create_file = std::function<std::unique_ptr<mysqlshdk::storage::IFile>(
@@ -409,7 +480,7 @@ class Dumper::Dump_writer_controller {
 
   virtual Dump_write_result start_writing(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Dump_writer::Encoding_type> &pre_encoded_columns) {
+      const std::vector<Dump_writer::Encoding_type> &encoded_columns) {
     assert(m_output);
 
     m_writer->set_output_file(m_output);
@@ -425,7 +496,7 @@ class Dumper::Dump_writer_controller {
     m_writer->open();
 
     return update_stats(
-        m_writer->write_preamble(metadata, pre_encoded_columns));
+        m_writer->write_preamble(metadata, encoded_columns));
   }
 
   virtual Dump_write_result write_row(const mysqlshdk::db::IRow *row) {
@@ -545,7 +616,7 @@ class Dumper::Default_writer_controller : public Dump_writer_controller {
 
   Dump_write_result start_writing(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Dump_writer::Encoding_type> &pre_encoded_columns)
+      const std::vector<Dump_writer::Encoding_type> &encoded_columns)
       override {
     auto filename = output_filename();
 
@@ -556,7 +627,7 @@ class Dumper::Default_writer_controller : public Dump_writer_controller {
     m_output = m_create_file(filename);
     set_output(m_output.get());
 
-    return Dump_writer_controller::start_writing(metadata, pre_encoded_columns);
+    return Dump_writer_controller::start_writing(metadata, encoded_columns);
   }
 
   Dump_write_result finish_writing() override {
@@ -610,10 +681,10 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
 
   Dump_write_result start_writing(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Dump_writer::Encoding_type> &pre_encoded_columns)
+      const std::vector<Dump_writer::Encoding_type> &encoded_columns)
       override {
     m_metadata = metadata;
-    m_pre_encoded_columns = pre_encoded_columns;
+    m_encoded_columns = encoded_columns;
 
     return {};
   }
@@ -660,7 +731,7 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
     m_controller = m_create_controller(common::get_table_data_filename(
         output_filename(), m_extension, m_index++, last_chunk));
     return update_stats(
-        m_controller->start_writing(m_metadata, m_pre_encoded_columns));
+        m_controller->start_writing(m_metadata, m_encoded_columns));
   }
 
   Dump_write_result finalize_controller() {
@@ -677,7 +748,7 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
   std::size_t m_index = 0;
   std::unique_ptr<Dump_writer_controller> m_controller;
   std::vector<mysqlshdk::db::Column> m_metadata;
-  std::vector<Dump_writer::Encoding_type> m_pre_encoded_columns;
+  std::vector<Dump_writer::Encoding_type> m_encoded_columns;
   std::unordered_map<std::string, Dump_write_result> m_file_stats;
 };
 
@@ -786,21 +857,32 @@ class Dumper::Table_worker final {
 
   std::string prepare_query(
       const Table_data_task &table,
-      std::vector<Dump_writer::Encoding_type> *out_pre_encoded_columns) const {
+      std::vector<Dump_writer::Encoding_type> *out_encoded_columns) const {
     const auto base64 = m_dumper->m_options.use_base64();
+    const auto client_side = m_dumper->m_options.client_side_encoding();
     std::string query = "SELECT SQL_NO_CACHE ";
 
     for (const auto &column : table.info->columns) {
-      if (column->csv_unsafe) {
+      // HEX() encodes BIT values as numbers, without the leading zeros, these
+      // values are short and are always encoded by the server
+      if (column->csv_unsafe && client_side &&
+          mysqlshdk::db::Type::Bit != column->type) {
+        // raw values are fetched and encoded by the writer
+        query += column->quoted_name;
+
+        out_encoded_columns->push_back(
+            base64 ? Dump_writer::Encoding_type::ENCODE_BASE64
+                   : Dump_writer::Encoding_type::ENCODE_HEX);
+      } else if (column->csv_unsafe) {
         query += (base64 ? "TO_BASE64(" : "HEX(") + column->quoted_name + ")";
 
-        out_pre_encoded_columns->push_back(
+        out_encoded_columns->push_back(
             base64 ? Dump_writer::Encoding_type::BASE64
                    : Dump_writer::Encoding_type::HEX);
       } else {
         query += column->quoted_name;
 
-        out_pre_encoded_columns->push_back(Dump_writer::Encoding_type::NONE);
+        out_encoded_columns->push_back(Dump_writer::Encoding_type::NONE);
       }
 
       query += ",";
@@ -830,26 +912,31 @@ class Dumper::Table_worker final {
     return query;
   }
 
-  void dump_table_data(const Table_data_task &table) {
-    log_debug("%sDumping %s (%s) using condition: %s", m_log_id.c_str(),
-              table.task_name.c_str(), table.id.c_str(), table.where.c_str());
-
-    mysqlshdk::utils::Duration duration;
-    duration.start();
-
-    std::vector<Dump_writer::Encoding_type> pre_encoded_columns;
-    const auto full_query = prepare_query(table, &pre_encoded_columns);
-    const auto controller = table.controller.get();
+  /**
+   * Writes rows selected by the given task using the given controller.
+   *
+   * @param start_writing Whether this is the first query written by the
+   *        controller.
+   *
+   * @returns false if dump was interrupted
+   */
+  bool write_rows(const Table_data_task &table,
+                  Dump_writer_controller *controller,
+                  mysqlshdk::utils::Rate_limit *rate_limit,
+                  bool start_writing) {
+    std::vector<Dump_writer::Encoding_type> encoded_columns;
+    const auto full_query = prepare_query(table, &encoded_columns);
 
     try {
-      mysqlshdk::utils::Rate_limit rate_limit{m_dumper->m_options.max_rate()};
       const auto result = query(full_query);
 
-      controller->start_writing(result->get_metadata(), pre_encoded_columns);
+      if (start_writing) {
+        controller->start_writing(result->get_metadata(), encoded_columns);
+      }
 
       while (const auto row = result->fetch_one()) {
         if (m_dumper->m_worker_interrupt) {
-          return;
+          return false;
         }
 
         controller->write_row(row);
@@ -860,8 +947,8 @@ class Dumper::Table_worker final {
 
           // we don't know how much data was read from the server, number of
           // bytes written to the dump file is a good approximation
-          if (rate_limit.enabled()) {
-            rate_limit.throttle(controller->progress_stats().data_bytes());
+          if (rate_limit->enabled()) {
+            rate_limit->throttle(controller->progress_stats().data_bytes());
           }
 
           controller->reset_progress();
@@ -874,14 +961,38 @@ class Dumper::Table_worker final {
       throw;
     }
 
+    return true;
+  }
+
+  void dump_table_data(const Table_data_task &table) {
+    log_debug("%sDumping %s (%s) using condition: %s", m_log_id.c_str(),
+              table.task_name.c_str(), table.id.c_str(), table.where.c_str());
+
+    mysqlshdk::utils::Duration duration;
+    duration.start();
+
+    const auto controller = table.controller.get();
+    mysqlshdk::utils::Rate_limit rate_limit{m_dumper->m_options.max_rate()};
+
+    if (!write_rows(table, controller, &rate_limit, true)) {
+      return;
+    }
+
+    finish_table_data(table, &duration);
+  }
+
+  void finish_table_data(const Table_data_task &table,
+                         mysqlshdk::utils::Duration *duration) {
+    const auto controller = table.controller.get();
+
     controller->finish_writing();
 
-    duration.finish();
+    duration->finish();
 
     log_info("%sDump of %s (%s) into '%s' took %f seconds, written %" PRIu64
              " rows (%" PRIu64 " bytes), longest row has %" PRIu64 " bytes",
              m_log_id.c_str(), table.task_name.c_str(), table.id.c_str(),
-             controller->output_filename().c_str(), duration.seconds_elapsed(),
+             controller->output_filename().c_str(), duration->seconds_elapsed(),
              controller->total_stats().rows_written(),
              controller->total_stats().data_bytes(), controller->longest_row());
 
@@ -963,19 +1074,31 @@ class Dumper::Table_worker final {
       data_task.where = "(" + where + ")";
     }
 
-    if (0 == idx && table.index.info && !table.index.is_pke) {
-      for (const auto &c : table.index.info->columns()) {
-        if (c->nullable) {
-          if (!data_task.where.empty()) {
-            data_task.where += "OR";
-          }
+    if (0 == idx) {
+      include_nulls(table, &data_task.where);
+    }
+
+    push_table_data_task(std::move(data_task));
+  }
+
+  /**
+   * Rows with NULL values in the index columns are not included in any of the
+   * ranges, they are added to the first chunk.
+   */
+  static void include_nulls(const Table_task &table, std::string *where) {
+    if (!table.index.info || table.index.is_pke) {
+      return;
+    }
 
-          data_task.where += "(" + c->quoted_name + " IS NULL)";
+    for (const auto &c : table.index.info->columns()) {
+      if (c->nullable) {
+        if (!where->empty()) {
+          *where += "OR";
         }
+
+        *where += "(" + c->quoted_name + " IS NULL)";
       }
     }
-
-    push_table_data_task(std::move(data_task));
   }
 
   void write_schema_metadata(const Schema_info &schema) const {
@@ -1003,14 +1126,21 @@ class Dumper::Table_worker final {
   void create_table_data_tasks(const Table_task &table) {
     auto ranges = create_ranged_tasks(table);
 
-    if (0 == ranges) {
-      create_and_push_whole_table_data_task(table);
-      ++ranges;
-    }
+    if (0 == ranges && m_dumper->m_options.split_unchunked_tables()) {
+      create_and_push_whole_table_data_in_chunks_task(table);
 
-    log_info("%sData dump for table %s will be written to %zu file%s",
-             m_log_id.c_str(), table.task_name.c_str(), ranges,
-             ranges > 1 ? "s" : "");
+      log_info("%sData dump for table %s will be written to multiple files",
+               m_log_id.c_str(), table.task_name.c_str());
+    } else {
+      if (0 == ranges) {
+        create_and_push_whole_table_data_task(table);
+        ++ranges;
+      }
+
+      log_info("%sData dump for table %s will be written to %zu file%s",
+               m_log_id.c_str(), table.task_name.c_str(), ranges,
+               ranges > 1 ? "s" : "");
+    }
 
     m_dumper->chunking_task_finished();
   }
@@ -1285,6 +1415,12 @@ class Dumper::Table_worker final {
             ? std::max(info.row_count / info.rows_per_chunk, UINT64_C(1))
             : info.row_count;
 
+    if constexpr (std::is_integral_v<T>) {
+      if (m_dumper->m_options.adaptive_chunking()) {
+        return chunk_integer_column_adaptive(info, min, max, estimated_chunks);
+      }
+    }
+
     using step_t = std20::remove_cvref_t<decltype(min)>;
     const auto index_range = distance(min, max);
     const auto row_count_accuracy = std::max(info.row_count / 10, UINT64_C(1));
@@ -1346,6 +1482,316 @@ class Dumper::Table_worker final {
     return ranges_count;
   }
 
+  /**
+   * State shared by all the chunks of a table which is dumped using the
+   * adaptive chunking.
+   */
+  struct Adaptive_table {
+    Table_task table;
+    Chunking_info info;
+
+    std::mutex mutex;
+    // number of ranges which are not fully written yet, plus one held by the
+    // chunker, the final chunk is written once this drops to zero
+    std::size_t pending = 1;
+    // index of the next chunk file
+    std::size_t next_index = 0;
+
+    // measured throughput of a single thread
+    uint64_t rows = 0;
+    uint64_t bytes = 0;
+    // number of values of the index column which were dumped
+    double values = 0;
+    double seconds = 0;
+  };
+
+  template <typename T>
+  struct Adaptive_range {
+    std::shared_ptr<Adaptive_table> table;
+    T begin;
+    T end;
+    bool include_nulls;
+  };
+
+  // desired duration of a single query executed when dumping a range
+  static constexpr double k_adaptive_query_time = 2.0;
+  // remaining part of a range is split if it's estimated to take longer
+  static constexpr double k_adaptive_split_time = 2 * k_adaptive_query_time;
+  // number of queries used to dump a range, if throughput is not known yet
+  static constexpr uint64_t k_adaptive_initial_queries = 8;
+
+  template <typename T>
+  std::size_t chunk_integer_column_adaptive(const Chunking_info &info,
+                                            const T &min, const T &max,
+                                            uint64_t estimated_chunks) {
+    log_info("%sChunking %s using integer algorithm with adaptive chunking",
+             m_log_id.c_str(), info.table->task_name.c_str());
+
+    auto state = std::make_shared<Adaptive_table>();
+    state->table = *info.table;
+    state->info = info;
+    state->info.table = &state->table;
+
+    // ranges are split while being dumped, there's no need to find their exact
+    // boundaries here
+    const auto step =
+        cast<T>(ensure_not_zero(distance(min, max) / estimated_chunks));
+    auto current = min;
+    std::size_t ranges_count = 0;
+    bool last_range = false;
+
+    while (!last_range) {
+      if (m_dumper->m_worker_interrupt) {
+        return ranges_count;
+      }
+
+      const auto begin = current;
+      current = (current > max - (step - 1) ? max : current + (step - 1));
+      last_range = (current >= max);
+
+      push_adaptive_range(
+          Adaptive_range<T>{state, begin, current, 0 == ranges_count});
+
+      ++ranges_count;
+      ++current;
+    }
+
+    release_adaptive_table(state);
+
+    // number of chunks is not known in advance, include the final one
+    return ranges_count + 1;
+  }
+
+  template <typename T>
+  void push_adaptive_range(Adaptive_range<T> &&range) {
+    {
+      std::lock_guard<std::mutex> lock(range.table->mutex);
+      ++range.table->pending;
+    }
+
+    std::string info = "dumping " + range.table->table.task_name;
+
+    m_dumper->m_worker_tasks.push(
+        {std::move(info),
+         [range = std::move(range)](Table_worker *worker) {
+           ++worker->m_dumper->m_num_threads_dumping;
+
+           worker->dump_adaptive_range(range);
+
+           --worker->m_dumper->m_num_threads_dumping;
+         }},
+        shcore::Queue_priority::LOW);
+  }
+
+  /**
+   * Dumps the given range using a series of queries, each one is expected to
+   * take roughly k_adaptive_query_time. If the range is estimated to take too
+   * long and there are idle workers, its unfinished end is handed over to
+   * them. Once chunk file reaches the requested size, a new file is started.
+   */
+  template <typename T>
+  void dump_adaptive_range(const Adaptive_range<T> &range) {
+    const auto state = range.table.get();
+    const auto bytes_per_chunk = m_dumper->m_options.bytes_per_chunk();
+    // leave some margin, so that the last queries are not too small
+    const auto chunk_full = bytes_per_chunk - bytes_per_chunk / 10;
+    mysqlshdk::utils::Rate_limit rate_limit{m_dumper->m_options.max_rate()};
+
+    Table_data_task data_task;
+    mysqlshdk::utils::Duration duration;
+    bool start_writing = false;
+    bool include_nulls = range.include_nulls;
+    auto begin = range.begin;
+    auto end = range.end;
+
+    log_debug("%sDumping %s using adaptive chunking, range: [%s, %s]",
+              m_log_id.c_str(), state->table.task_name.c_str(),
+              quote(begin).c_str(), quote(end).c_str());
+
+    while (true) {
+      if (!data_task.controller) {
+        data_task = start_adaptive_chunk(state);
+        duration.start();
+        start_writing = true;
+      }
+
+      const auto controller = data_task.controller.get();
+      const auto written = controller->total_stats();
+      const auto remaining = distance(begin, end);
+      const auto step = adaptive_step(
+          state, remaining,
+          bytes_per_chunk - std::min(written.data_bytes(), bytes_per_chunk));
+      const auto last_query = step >= remaining;
+      const auto query_end = last_query ? end : begin + cast<T>(step - 1);
+
+      data_task.where = "(" + between(state->info, begin, query_end) + ")";
+
+      if (include_nulls) {
+        Table_worker::include_nulls(state->table, &data_task.where);
+        include_nulls = false;
+      }
+
+      mysqlshdk::utils::Duration query_duration;
+      query_duration.start();
+
+      if (!write_rows(data_task, controller, &rate_limit, start_writing)) {
+        return;
+      }
+
+      query_duration.finish();
+      start_writing = false;
+
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->rows +=
+            controller->total_stats().rows_written() - written.rows_written();
+        state->bytes +=
+            controller->total_stats().data_bytes() - written.data_bytes();
+        state->values += static_cast<double>(last_query ? remaining : step);
+        state->seconds += query_duration.seconds_elapsed();
+      }
+
+      if (last_query || controller->total_stats().data_bytes() >= chunk_full) {
+        finish_table_data(data_task, &duration);
+        data_task.controller.reset();
+      }
+
+      if (last_query) {
+        break;
+      }
+
+      begin = query_end + 1;
+
+      if (has_idle_workers()) {
+        split_adaptive_range(range.table, begin, &end);
+      }
+    }
+
+    release_adaptive_table(range.table);
+  }
+
+  Table_data_task start_adaptive_chunk(Adaptive_table *state) {
+    std::size_t index;
+
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      index = state->next_index++;
+    }
+
+    auto data_task = create_table_data_task(
+        state->table, m_dumper->get_table_data_filename(state->table.basename,
+                                                        index, false));
+    data_task.id = "chunk " + std::to_string(index);
+
+    return data_task;
+  }
+
+  /**
+   * Number of values of the index column to be dumped by the next query.
+   */
+  static uint64_t adaptive_step(Adaptive_table *state, uint64_t remaining,
+                                uint64_t remaining_bytes) {
+    double step;
+
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+
+      if (state->values <= 0) {
+        return std::max(remaining / k_adaptive_initial_queries, UINT64_C(1));
+      }
+
+      // don't count on the queries being faster than 1ms
+      step = state->values / std::max(state->seconds, 0.001) *
+             k_adaptive_query_time;
+
+      if (state->bytes > 0) {
+        // don't exceed the size of a chunk
+        step = std::min(step, remaining_bytes / (state->bytes / state->values));
+      }
+    }
+
+    if (step >= static_cast<double>(remaining)) {
+      return remaining;
+    }
+
+    return std::max(static_cast<uint64_t>(step), UINT64_C(1));
+  }
+
+  bool has_idle_workers() const {
+    return 0 == m_dumper->m_worker_tasks.size() &&
+           m_dumper->m_num_threads_chunking + m_dumper->m_num_threads_dumping <
+               m_dumper->m_options.threads();
+  }
+
+  /**
+   * Hands over the second half of the [begin, end] range to the idle workers,
+   * if it's expected to take too long to dump it in this thread.
+   */
+  template <typename T>
+  void split_adaptive_range(const std::shared_ptr<Adaptive_table> &state,
+                            const T &begin, T *end) {
+    const auto remaining = distance(begin, *end);
+
+    if (remaining < 2) {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+
+      if (state->values <= 0 ||
+          remaining / state->values * state->seconds < k_adaptive_split_time) {
+        return;
+      }
+    }
+
+    const auto middle = begin + cast<T>(remaining / 2 - 1);
+
+    log_debug("%sSplitting range of %s: [%s, %s] is dumped by this thread, "
+              "[%s, %s] is going to be dumped by another one",
+              m_log_id.c_str(), state->table.task_name.c_str(),
+              quote(begin).c_str(), quote(middle).c_str(),
+              quote(middle + 1).c_str(), quote(*end).c_str());
+
+    push_adaptive_range(Adaptive_range<T>{state, middle + 1, *end, false});
+
+    *end = middle;
+  }
+
+  /**
+   * Called once a range is written, writes the final (empty) chunk once all
+   * the ranges are written.
+   */
+  void release_adaptive_table(const std::shared_ptr<Adaptive_table> &state) {
+    std::size_t index;
+
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+
+      if (0 != --state->pending) {
+        return;
+      }
+
+      index = state->next_index++;
+    }
+
+    log_info("%sAdaptive chunking of %s: %" PRIu64 " rows (%" PRIu64
+             " bytes) written to %zu files, single thread throughput: %.0f "
+             "rows/s, %.0f bytes/s",
+             m_log_id.c_str(), state->table.task_name.c_str(), state->rows,
+             state->bytes, index + 1,
+             state->rows / std::max(state->seconds, 0.001),
+             state->bytes / std::max(state->seconds, 0.001));
+
+    auto data_task = create_table_data_task(
+        state->table,
+        m_dumper->get_table_data_filename(state->table.basename, index, true));
+    data_task.id = "chunk " + std::to_string(index);
+    data_task.where = "FALSE";
+
+    dump_table_data(data_task);
+  }
+
   std::size_t chunk_integer_column(const Chunking_info &info, const Row &begin,
                                    const Row &end) {
     log_info("%sChunking %s using integer algorithm", m_log_id.c_str(),
@@ -1730,6 +2176,8 @@ Dumper::Dumper(const Dump_options &options)
     : m_options(options), m_progress_thread("Dump", options.show_progress()) {
   m_options.validate();
 
+  initialize_compression_options();
+
   if (m_options.use_single_file()) {
     {
       using mysqlshdk::storage::utils::get_scheme;
@@ -1754,7 +2202,7 @@ Dumper::Dumper(const Dump_options &options)
     using mysqlshdk::storage::make_file;
     m_output_file =
         make_file(make_file(m_options.output_url(), m_options.storage_config()),
-                  m_options.compression());
+                  m_options.compression(), m_compression_options);
     m_output_dir = m_output_file->parent();
 
     if (!m_output_dir->exists()) {
@@ -1912,8 +2360,7 @@ void Dumper::do_run() {
 
   shcore::Interrupt_handler intr_handler([this]() -> bool {
     current_console()->print_warning("Interrupted by user. Canceling...");
-    emergency_shutdown();
-    kill_query();
+    interrupt();
     return false;
   });
 
@@ -2485,6 +2932,36 @@ void Dumper::initialize_instance_cache() {
   auto builder = Instance_cache_builder(session(), m_options.filters(),
                                         std::move(m_cache));
 
+  if (!m_workers.empty()) {
+    // information_schema queries are split between the main session and the
+    // sessions of the worker threads, which are idle at this point
+    builder.executor(
+        [this](std::vector<Instance_cache_builder::Task> &&tasks) {
+          execute_metadata_tasks(std::move(tasks));
+        },
+        m_workers.size() + 1);
+  }
+
+  const auto snapshot_path = m_options.metadata_cache();
+
+  if (!snapshot_path.empty()) {
+    Instance_cache snapshot;
+
+    try {
+      if (!load_snapshot(snapshot_path, &snapshot)) {
+        log_info("Metadata cache '%s' does not exist, it will be created",
+                 snapshot_path.c_str());
+      }
+    } catch (const std::exception &e) {
+      current_console()->print_warning(
+          "Failed to load the metadata cache '" + snapshot_path +
+          "', it will be recreated: " + e.what());
+      snapshot = {};
+    }
+
+    builder.snapshot(std::move(snapshot));
+  }
+
   builder.metadata(m_options.included_partitions());
 
   if (dump_users()) {
@@ -2511,11 +2988,43 @@ void Dumper::initialize_instance_cache() {
 
   m_cache = builder.build();
 
+  if (!snapshot_path.empty()) {
+    try {
+      save_snapshot(m_cache, snapshot_path);
+    } catch (const std::exception &e) {
+      current_console()->print_warning("Failed to write the metadata cache '" +
+                                       snapshot_path + "': " + e.what());
+    }
+  }
+
   validate_schemas_list();
 
   print_object_stats();
 }
 
+void Dumper::execute_metadata_tasks(
+    std::vector<Instance_cache_builder::Task> &&tasks) {
+  if (tasks.empty()) {
+    return;
+  }
+
+  // worker threads may pick up their tasks after this method returns, state
+  // is shared to keep it alive
+  const auto metadata = std::make_shared<Metadata_tasks>(std::move(tasks));
+  const auto workers = std::min(m_workers.size(), metadata->size() - 1);
+
+  for (std::size_t i = 0; i < workers; ++i) {
+    m_worker_tasks.push({"fetching metadata",
+                         [metadata](Table_worker *worker) {
+                           metadata->execute(worker->m_session);
+                         }},
+                        shcore::Queue_priority::HIGH);
+  }
+
+  metadata->execute(session());
+  metadata->wait_for_all();
+}
+
 void Dumper::create_schema_tasks() {
   bool has_partitions = false;
 
@@ -3224,7 +3733,8 @@ std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
         m_writer_creator(),
         [this](const std::string &name) {
           return mysqlshdk::storage::make_file(make_file(name, true),
-                                               m_options.compression());
+                                               m_options.compression(),
+                                               m_compression_options);
         },
         [this](const std::string &name) { return make_file(name); }, filename,
         // We only use the .dumping extension in case of the local files. In
@@ -3628,7 +4138,9 @@ void Dumper::write_table_metadata(
   doc.AddMember(StringRef("includesDdl"), m_options.dump_ddl(), a);
 
   doc.AddMember(StringRef("extension"), refs(m_table_data_extension), a);
-  doc.AddMember(StringRef("chunking"), m_options.split(), a);
+  // the loader expects the chunked file names if data was split
+  doc.AddMember(StringRef("chunking"),
+                m_options.split() || m_options.split_unchunked_tables(), a);
   doc.AddMember(
       StringRef("compression"),
       {mysqlshdk::storage::to_string(m_options.compression()).c_str(), a}, a);
@@ -3743,6 +4255,11 @@ void Dumper::rethrow() const {
   }
 }
 
+void Dumper::interrupt() {
+  emergency_shutdown();
+  kill_query();
+}
+
 void Dumper::emergency_shutdown() {
   m_worker_interrupt = true;
 
@@ -3877,6 +4394,60 @@ std::string Dumper::get_basename(const std::string &basename) {
   }
 }
 
+void Dumper::initialize_compression_options() {
+  if (mysqlshdk::storage::Compression::LZ4 == m_options.compression()) {
+    // older loaders do not recognize the extension and load such files as
+    // uncompressed ones
+    m_used_capabilities.emplace(Capability::LZ4_COMPRESSION);
+  }
+
+  if (mysqlshdk::storage::Compression::ZSTD == m_options.compression()) {
+    // files hold an index of independently decompressable frames, so that a
+    // single file can be loaded in parallel
+    m_compression_options.frame_size = k_zstd_frame_size;
+  }
+
+  const auto threads = m_options.compression_threads();
+
+  if (0 == threads) {
+    return;
+  }
+
+  using mysqlshdk::storage::compression::Gz_thread_pool;
+  using mysqlshdk::storage::compression::Zstd_thread_pool;
+
+  const auto gzip =
+      mysqlshdk::storage::Compression::GZIP == m_options.compression();
+
+  if (!gzip && !Zstd_thread_pool::multithreading_supported()) {
+    current_console()->print_warning(
+        "The zstd library does not support multi-threaded compression, the "
+        "'compressionThreads' option is ignored.");
+    return;
+  }
+
+  // all files share the same pool of compression workers, each file gets its
+  // share of workers, so that the total number of jobs in flight (and memory
+  // used by the compression buffers) is bounded
+  const auto dump_threads = std::max<uint64_t>(m_options.threads(), 1);
+  m_compression_options.threads =
+      std::max<uint64_t>(1, (threads + dump_threads - 1) / dump_threads);
+
+  if (gzip) {
+    m_compression_options.gz_thread_pool =
+        std::make_shared<Gz_thread_pool>(threads);
+    // older loaders read just the first member of such files
+    m_used_capabilities.emplace(Capability::MULTI_MEMBER_GZIP);
+  } else {
+    m_compression_options.zstd_thread_pool =
+        std::make_shared<Zstd_thread_pool>(threads);
+  }
+
+  log_info("Using %" PRIu64
+           " %s compression threads, up to %zu workers per file",
+           threads, gzip ? "gzip" : "zstd", m_compression_options.threads);
+}
+
 bool Dumper::compressed() const {
   return mysqlshdk::storage::Compression::NONE != m_options.compression();
 }
@@ -39,10 +39,11 @@
 #include "mysqlshdk/libs/db/column.h"
 #include "mysqlshdk/libs/mysql/user_privileges.h"
 #include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
-#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
 #include "mysqlshdk/libs/utils/version.h"
 
 #include "modules/util/dump/capability.h"
@@ -71,6 +72,11 @@ class Dumper {
 
   void run();
 
+  /**
+   * Stops the dump, can be called from a different thread.
+   */
+  void interrupt();
+
  protected:
   static inline std::shared_ptr<mysqlshdk::db::IResult> query(
       const std::shared_ptr<mysqlshdk::db::ISession> &session,
@@ -165,6 +171,8 @@ class Dumper {
 
   class Synchronize_workers;
 
+  class Metadata_tasks;
+
   class Dump_info;
 
   class Memory_dumper;
@@ -216,6 +224,9 @@ class Dumper {
 
   void initialize_instance_cache();
 
+  void execute_metadata_tasks(
+      std::vector<Instance_cache_builder::Task> &&tasks);
+
   void create_schema_tasks();
 
   void validate_mds() const;
@@ -341,6 +352,8 @@ class Dumper {
 
   bool compressed() const;
 
+  void initialize_compression_options();
+
   void kill_query() const;
 
   std::string get_query_comment(const std::string &quoted_name,
@@ -392,6 +405,7 @@ class Dumper {
   std::vector<Schema_info> m_schema_infos;
   std::unordered_map<std::string, std::size_t> m_truncated_basenames;
   std::string m_table_data_extension;
+  mysqlshdk::storage::Compression_options m_compression_options;
 
   // status variables
   bool m_instance_locked = false;
@@ -435,7 +449,7 @@ class Dumper {
   // threads
   std::vector<std::thread> m_workers;
   std::vector<std::exception_ptr> m_worker_exceptions;
-  shcore::Synchronized_queue<Task_info> m_worker_tasks;
+  shcore::Work_stealing_queue<Task_info> m_worker_tasks;
   std::atomic<uint64_t> m_chunking_tasks;
   std::atomic<bool> m_main_thread_finished_producing_chunking_tasks;
   std::unique_ptr<Synchronize_workers> m_worker_synchronization;
@@ -67,6 +67,14 @@ class Export_table_options : public Dump_options {
 
   uint64_t bytes_per_chunk() const override { return 0; }
 
+  bool split_unchunked_tables() const override { return false; }
+
+  bool adaptive_chunking() const override { return false; }
+
+  std::string metadata_cache() const override { return {}; }
+
+  bool client_side_encoding() const override { return false; }
+
   std::size_t threads() const override { return 1; }
 
   bool dump_ddl() const override { return false; }
@@ -28,6 +28,7 @@
 #include <mysqld_error.h>
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <stdexcept>
 #include <utility>
@@ -97,6 +98,38 @@ void Instance_cache::Index::add_column(const Column *column) {
   m_columns_sql += column->quoted_name;
 }
 
+void Instance_cache::Table::set_columns(std::vector<Column> &&all) {
+  all_columns = std::move(all);
+  columns.clear();
+
+  for (const auto &column : all_columns) {
+    if (!column.generated) {
+      columns.emplace_back(&column);
+    }
+  }
+}
+
+void Instance_cache::Table::add_index(
+    const std::string &name, const std::vector<const Column *> &index_columns) {
+  Index new_index;
+  bool nullable = false;
+
+  for (const auto &column : index_columns) {
+    new_index.add_column(column);
+    nullable |= column->nullable;
+  }
+
+  const auto ptr = &indexes.emplace(name, std::move(new_index)).first->second;
+
+  if ("PRIMARY" == name) {
+    primary_key = ptr;
+  } else if (!nullable) {
+    primary_key_equivalents.emplace_back(ptr);
+  } else {
+    unique_keys.emplace_back(ptr);
+  }
+}
+
 struct Instance_cache_builder::Iterate_schema {
   std::string schema_column;
   std::vector<std::string> extra_columns;
@@ -303,6 +336,19 @@ Instance_cache_builder::Instance_cache_builder(
   }
 }
 
+Instance_cache_builder &Instance_cache_builder::executor(
+    Task_executor executor, std::size_t shards) {
+  m_executor = std::move(executor);
+  m_shards = std::max<std::size_t>(shards, 1);
+  return *this;
+}
+
+Instance_cache_builder &Instance_cache_builder::snapshot(
+    Instance_cache &&snapshot) {
+  m_snapshot = std::make_unique<Instance_cache>(std::move(snapshot));
+  return *this;
+}
+
 Instance_cache_builder &Instance_cache_builder::metadata(
     const Partition_filters &partitions) {
   fetch_metadata(partitions);
@@ -401,33 +447,21 @@ Instance_cache_builder &Instance_cache_builder::triggers() {
     info.where = trigger_filter(info, m_filters.triggers().included(),
                                 m_filters.triggers().excluded());
 
-    // schema -> table -> triggers
-    std::unordered_map<
-        std::string,
-        std::unordered_map<std::string, std::multimap<uint64_t, std::string>>>
-        triggers;
+    const auto all_shards = shards();
+    std::vector<uint64_t> counts(all_shards.size(), 0);
+    std::vector<Task> tasks;
 
-    iterate_tables(info, [&triggers, this](const std::string &schema_name,
-                                           const std::string &table_name,
-                                           Instance_cache::Table *,
-                                           const mysqlshdk::db::IRow *row) {
-      triggers[schema_name][table_name].emplace(
-          row->get_uint(3),
-          row->get_string(2));  // ACTION_ORDER, TRIGGER_NAME
-
-      ++m_cache.filtered.triggers;
-    });
-
-    for (auto &schema : triggers) {
-      auto &s = m_cache.schemas.at(schema.first);
+    for (std::size_t i = 0; i < all_shards.size(); ++i) {
+      tasks.emplace_back([this, &all_shards, &info, &counts,
+                          i](const Session &session) {
+        fetch_triggers(session, all_shards[i], info, &counts[i]);
+      });
+    }
 
-      for (auto &table : schema.second) {
-        auto &t = s.tables.at(table.first);
+    execute(std::move(tasks));
 
-        for (auto &trigger : table.second) {
-          t.triggers.emplace_back(std::move(trigger.second));
-        }
-      }
+    for (const auto c : counts) {
+      m_cache.filtered.triggers += c;
     }
 
     // the total number of triggers within the filtered tables
@@ -493,7 +527,8 @@ void Instance_cache_builder::filter_tables() {
       "AVG_ROW_LENGTH",  // can be NULL
       "ENGINE",          // can be NULL
       "CREATE_OPTIONS",  // can be NULL
-      "TABLE_COMMENT"    // can be NULL in 8.0
+      "TABLE_COMMENT",   // can be NULL in 8.0
+      "CREATE_TIME"      // can be NULL
   };
   info.table_name = "tables";
   info.where = table_filter(schema_column, table_column);
@@ -517,6 +552,7 @@ void Instance_cache_builder::filter_tables() {
         target.engine = row->get_string(5, "");           // ENGINE
         target.create_options = row->get_string(6, "");   // CREATE_OPTIONS
         target.comment = row->get_string(7, "");          // TABLE_COMMENT
+        target.create_time = row->get_as_string(8, "");   // CREATE_TIME
 
         if (is_table) {
           set_has_tables();
@@ -543,11 +579,74 @@ void Instance_cache_builder::fetch_metadata(
 
   fetch_ndbinfo();
   fetch_server_metadata();
-  fetch_view_metadata();
-  fetch_columns();
-  fetch_table_indexes();
-  fetch_table_histograms();
-  fetch_table_partitions(partitions);
+
+  // each task writes to different members of the cached objects, or to the
+  // objects from different schemas, tasks do not need to be synchronized
+  const auto all_shards = shards();
+  std::atomic<bool> histograms_fetched{true};
+  std::vector<Task> tasks;
+  Shard reused;
+
+  if (m_snapshot) {
+    for (const auto &shard : all_shards) {
+      tasks.emplace_back([this, &shard](const Session &session) {
+        fetch_checksums(session, shard);
+      });
+    }
+
+    {
+      Profiler checksums_profiler{"fetching checksums"};
+      execute(std::move(tasks));
+    }
+
+    tasks.clear();
+    reused = reuse_snapshot();
+  }
+
+  // columns and indexes of the reused schemas are already set
+  const auto column_shards = reused.empty() ? all_shards : shards(reused);
+
+  for (const auto &shard : column_shards) {
+    // indexes refer to columns, they have to be fetched in order
+    tasks.emplace_back([this, &shard](const Session &session) {
+      fetch_columns(session, shard);
+      fetch_table_indexes(session, shard);
+    });
+  }
+
+  for (const auto &shard : all_shards) {
+    tasks.emplace_back([this, &shard](const Session &session) {
+      fetch_view_metadata(session, shard);
+    });
+    tasks.emplace_back(
+        [this, &shard, &histograms_fetched](const Session &session) {
+          if (!fetch_table_histograms(session, shard)) {
+            histograms_fetched = false;
+          }
+        });
+    tasks.emplace_back([this, &shard, &partitions](const Session &session) {
+      fetch_table_partitions(session, shard, partitions);
+    });
+  }
+
+  {
+    Profiler executor_profiler{"executing metadata tasks"};
+    execute(std::move(tasks));
+  }
+
+  if (!histograms_fetched) {
+    current_console()->print_warning("Failed to fetch table histograms.");
+  }
+
+  if (has_tables() && m_cache.server_version.is_8_0) {
+    for (auto &schema : m_cache.schemas) {
+      for (auto &table : schema.second.tables) {
+        std::sort(
+            table.second.histograms.begin(), table.second.histograms.end(),
+            [](const auto &l, const auto &r) { return l.column < r.column; });
+      }
+    }
+  }
 }
 
 void Instance_cache_builder::fetch_version() {
@@ -599,7 +698,8 @@ void Instance_cache_builder::fetch_ndbinfo() {
   }
 }
 
-void Instance_cache_builder::fetch_view_metadata() {
+void Instance_cache_builder::fetch_view_metadata(const Session &session,
+                                                 const Shard &shard) {
   Profiler profiler{"fetching view metadata"};
 
   if (!has_views()) {
@@ -615,15 +715,16 @@ void Instance_cache_builder::fetch_view_metadata() {
   };
   info.table_name = "views";
 
-  iterate_views(info, [](const std::string &, const std::string &,
-                         Instance_cache::View *view,
-                         const mysqlshdk::db::IRow *row) {
+  iterate_views(session, shard, info,
+                [](const std::string &, const std::string &,
+                   Instance_cache::View *view, const mysqlshdk::db::IRow *row) {
     view->character_set_client = row->get_string(2);  // CHARACTER_SET_CLIENT
     view->collation_connection = row->get_string(3);  // COLLATION_CONNECTION
   });
 }
 
-void Instance_cache_builder::fetch_columns() {
+void Instance_cache_builder::fetch_columns(const Session &session,
+                                           const Shard &shard) {
   Profiler profiler{"fetching columns"};
 
   if (!has_tables() && !has_views()) {
@@ -677,7 +778,7 @@ void Instance_cache_builder::fetch_columns() {
   };
 
   iterate_tables_and_views(
-      info,
+      session, shard, info,
       [&table_columns, &create_column](
           const std::string &schema_name, const std::string &table_name,
           Instance_cache::Table *, const mysqlshdk::db::IRow *row) {
@@ -693,21 +794,22 @@ void Instance_cache_builder::fetch_columns() {
             create_column(row));
       });
 
-  for (auto &schema : table_columns) {
-    auto &s = m_cache.schemas.at(schema.first);
+  const auto to_vector = [](std::map<uint64_t, Instance_cache::Column> &&m) {
+    std::vector<Instance_cache::Column> columns;
+    columns.reserve(m.size());
 
-    for (auto &table : schema.second) {
-      auto &t = s.tables.at(table.first);
+    for (auto &column : m) {
+      columns.emplace_back(std::move(column.second));
+    }
 
-      t.all_columns.reserve(table.second.size());
+    return columns;
+  };
 
-      for (auto &column : table.second) {
-        t.all_columns.emplace_back(std::move(column.second));
+  for (auto &schema : table_columns) {
+    auto &s = m_cache.schemas.at(schema.first);
 
-        if (!t.all_columns.back().generated) {
-          t.columns.emplace_back(&t.all_columns.back());
-        }
-      }
+    for (auto &table : schema.second) {
+      s.tables.at(table.first).set_columns(to_vector(std::move(table.second)));
     }
   }
 
@@ -715,22 +817,13 @@ void Instance_cache_builder::fetch_columns() {
     auto &s = m_cache.schemas.at(schema.first);
 
     for (auto &view : schema.second) {
-      auto &v = s.views.at(view.first);
-
-      v.all_columns.reserve(view.second.size());
-
-      for (auto &column : view.second) {
-        v.all_columns.emplace_back(std::move(column.second));
-
-        if (!v.all_columns.back().generated) {
-          v.columns.emplace_back(&v.all_columns.back());
-        }
-      }
+      s.views.at(view.first).set_columns(to_vector(std::move(view.second)));
     }
   }
 }
 
-void Instance_cache_builder::fetch_table_indexes() {
+void Instance_cache_builder::fetch_table_indexes(const Session &session,
+                                                 const Shard &shard) {
   Profiler profiler{"fetching table indexes"};
 
   if (!has_tables()) {
@@ -748,9 +841,8 @@ void Instance_cache_builder::fetch_table_indexes() {
   info.table_name = "statistics";
   info.where = "COLUMN_NAME IS NOT NULL AND NON_UNIQUE=0";
 
-  constexpr std::string_view k_primary_index = "PRIMARY";
   struct Index_info {
-    std::vector<Instance_cache::Column *> columns;
+    std::vector<const Instance_cache::Column *> columns;
   };
   // schema -> table -> index name -> index info
   // indexes are ordered to ensure repeatability of the selection algorithm
@@ -760,7 +852,7 @@ void Instance_cache_builder::fetch_table_indexes() {
       indexes;
 
   iterate_tables(
-      info,
+      session, shard, info,
       [&indexes](const std::string &schema_name, const std::string &table_name,
                  Instance_cache::Table *t, const mysqlshdk::db::IRow *row) {
         // INDEX_NAME can be NULL in 8.0, as per output of 'SHOW COLUMNS', but
@@ -797,34 +889,18 @@ void Instance_cache_builder::fetch_table_indexes() {
       auto &t = m_cache.schemas.at(schema.first).tables.at(table.first);
 
       for (const auto &index : table.second) {
-        Instance_cache::Index new_index;
-        bool nullable = false;
-
-        for (const auto &column : index.second.columns) {
-          new_index.add_column(column);
-          nullable |= column->nullable;
-        }
-
-        auto ptr =
-            &t.indexes.emplace(index.first, std::move(new_index)).first->second;
-
-        if (k_primary_index == index.first) {
-          t.primary_key = ptr;
-        } else if (!nullable) {
-          t.primary_key_equivalents.emplace_back(ptr);
-        } else {
-          t.unique_keys.emplace_back(ptr);
-        }
+        t.add_index(index.first, index.second.columns);
       }
     }
   }
 }
 
-void Instance_cache_builder::fetch_table_histograms() {
+bool Instance_cache_builder::fetch_table_histograms(const Session &session,
+                                                    const Shard &shard) {
   Profiler profiler{"fetching table histograms"};
 
   if (!has_tables() || !m_cache.server_version.is_8_0) {
-    return;
+    return true;
   }
 
   try {
@@ -839,8 +915,9 @@ void Instance_cache_builder::fetch_table_histograms() {
     info.table_name = "column_statistics";
 
     iterate_tables(
-        info, [](const std::string &, const std::string &,
-                 Instance_cache::Table *table, const mysqlshdk::db::IRow *row) {
+        session, shard, info,
+        [](const std::string &, const std::string &,
+           Instance_cache::Table *table, const mysqlshdk::db::IRow *row) {
           Instance_cache::Histogram histogram;
 
           histogram.column = row->get_string(2);  // COLUMN_NAME
@@ -849,21 +926,16 @@ void Instance_cache_builder::fetch_table_histograms() {
 
           table->histograms.emplace_back(std::move(histogram));
         });
-
-    for (auto &schema : m_cache.schemas) {
-      for (auto &table : schema.second.tables) {
-        std::sort(
-            table.second.histograms.begin(), table.second.histograms.end(),
-            [](const auto &l, const auto &r) { return l.column < r.column; });
-      }
-    }
   } catch (const mysqlshdk::db::Error &e) {
     log_error("Failed to fetch table histograms: %s.", e.format().c_str());
-    current_console()->print_warning("Failed to fetch table histograms.");
+    return false;
   }
+
+  return true;
 }
 
 void Instance_cache_builder::fetch_table_partitions(
+    const Session &session, const Shard &shard,
     const Partition_filters &partitions) {
   Profiler profiler{"fetching table partitions"};
 
@@ -913,7 +985,8 @@ void Instance_cache_builder::fetch_table_partitions(
       };
 
   iterate_tables(
-      info, [&include_partition](const std::string &s, const std::string &t,
+      session, shard, info,
+      [&include_partition](const std::string &s, const std::string &t,
                                  Instance_cache::Table *table,
                                  const mysqlshdk::db::IRow *row) {
         if (shcore::str_caseeq(table->engine, "NDB", "NDBCLUSTER")) {
@@ -941,6 +1014,236 @@ void Instance_cache_builder::fetch_table_partitions(
       });
 }
 
+void Instance_cache_builder::fetch_triggers(const Session &session,
+                                            const Shard &shard,
+                                            const Iterate_table &info,
+                                            uint64_t *count) {
+  // schema -> table -> triggers
+  std::unordered_map<
+      std::string,
+      std::unordered_map<std::string, std::multimap<uint64_t, std::string>>>
+      triggers;
+
+  iterate_tables(session, shard, info,
+                 [&triggers, count](const std::string &schema_name,
+                                    const std::string &table_name,
+                                    Instance_cache::Table *,
+                                    const mysqlshdk::db::IRow *row) {
+                   triggers[schema_name][table_name].emplace(
+                       row->get_uint(3),
+                       row->get_string(2));  // ACTION_ORDER, TRIGGER_NAME
+
+                   ++(*count);
+                 });
+
+  for (auto &schema : triggers) {
+    auto &s = m_cache.schemas.at(schema.first);
+
+    for (auto &table : schema.second) {
+      auto &t = s.tables.at(table.first);
+
+      for (auto &trigger : table.second) {
+        t.triggers.emplace_back(std::move(trigger.second));
+      }
+    }
+  }
+}
+
+void Instance_cache_builder::fetch_checksums(const Session &session,
+                                             const Shard &shard) {
+  if (!has_tables() && !has_views()) {
+    return;
+  }
+
+  // schema names are grouped using a binary comparison, so that schemas whose
+  // names differ only by case or accents have their own checksums; CRC32 is
+  // used instead of a cryptographic hash, as these queries are executed on
+  // each dump and need to be as cheap as possible, while table's CREATE_TIME
+  // alone is not enough, as it's not changed by INSTANT and INPLACE ALTERs
+  const auto checksums = [this, &session, &shard](
+                             const std::string &table_name,
+                             const std::string &where,
+                             const std::vector<std::string> &columns) {
+    Iterate_table info;
+    info.schema_column = "TABLE_SCHEMA";
+    info.table_column = "TABLE_NAME";
+    info.table_name = table_name;
+    info.where = where;
+
+    const std::string schema = "CAST(TABLE_SCHEMA AS BINARY)";
+    std::string sql = "SELECT " + schema +
+                      ",COUNT(*),BIT_XOR(CRC32(CONCAT_WS(CHAR(0)," +
+                      shcore::str_join(columns, ",") +
+                      "))) FROM information_schema." + table_name;
+
+    if (const auto filter = shard_filter(info, shard); !filter.empty()) {
+      sql += " WHERE " + (where.empty() ? "" : where + " AND ") + filter;
+    } else if (!where.empty()) {
+      sql += " WHERE " + where;
+    }
+
+    sql += " GROUP BY ";
+    sql += schema;
+
+    std::unordered_map<std::string, std::string> result;
+    const auto rows = query(session, sql);
+
+    while (const auto row = rows->fetch_one()) {
+      result.emplace(row->get_string(0),
+                     row->get_as_string(1) + ':' + row->get_as_string(2));
+    }
+
+    return result;
+  };
+
+  const auto columns =
+      checksums("columns", {},
+                {"TABLE_NAME", "COLUMN_NAME", "ORDINAL_POSITION",
+                 "COLUMN_TYPE", "IS_NULLABLE", "EXTRA"});
+  const auto indexes = checksums(
+      "statistics", "COLUMN_NAME IS NOT NULL AND NON_UNIQUE=0",
+      {"TABLE_NAME", "INDEX_NAME", "COLUMN_NAME", "SEQ_IN_INDEX"});
+
+  for (auto &schema : m_cache.schemas) {
+    if (!shard.empty() && !shard.count(schema.first)) {
+      continue;
+    }
+
+    // schema without any columns either has no tables and views, or columns
+    // are not visible due to missing privileges, its metadata is not reused
+    const auto c = columns.find(schema.first);
+
+    if (columns.end() != c) {
+      const auto i = indexes.find(schema.first);
+      schema.second.checksum =
+          c->second + ',' + (indexes.end() != i ? i->second : "0:0");
+    }
+  }
+}
+
+Instance_cache_builder::Shard Instance_cache_builder::reuse_snapshot() {
+  const auto same_objects = [](const auto &current, const auto &previous) {
+    if (current.size() != previous.size()) {
+      return false;
+    }
+
+    for (const auto &object : current) {
+      const auto it = previous.find(object.first);
+
+      if (previous.end() == it ||
+          object.second.create_time != it->second.create_time) {
+        return false;
+      }
+    }
+
+    return true;
+  };
+
+  const auto reuse = [](auto *current, auto *previous) {
+    for (auto &object : *current) {
+      auto &target = object.second;
+      auto &source = previous->at(object.first);
+
+      // containers are moved, pointers to their elements remain valid
+      target.all_columns = std::move(source.all_columns);
+      target.columns = std::move(source.columns);
+      target.indexes = std::move(source.indexes);
+      target.primary_key = source.primary_key;
+      target.primary_key_equivalents =
+          std::move(source.primary_key_equivalents);
+      target.unique_keys = std::move(source.unique_keys);
+    }
+  };
+
+  Shard reused;
+
+  for (auto &schema : m_cache.schemas) {
+    auto &current = schema.second;
+
+    if (current.checksum.empty() ||
+        (current.tables.empty() && current.views.empty())) {
+      continue;
+    }
+
+    const auto it = m_snapshot->schemas.find(schema.first);
+
+    if (m_snapshot->schemas.end() == it) {
+      continue;
+    }
+
+    auto &previous = it->second;
+
+    if (current.checksum != previous.checksum ||
+        !same_objects(current.tables, previous.tables) ||
+        !same_objects(current.views, previous.views)) {
+      continue;
+    }
+
+    reuse(&current.tables, &previous.tables);
+    reuse(&current.views, &previous.views);
+
+    reused.emplace(schema.first);
+  }
+
+  log_info("Metadata of %zu out of %zu schemas was reused from the snapshot",
+           reused.size(), m_cache.schemas.size());
+
+  m_snapshot.reset();
+
+  return reused;
+}
+
+std::vector<Instance_cache_builder::Shard> Instance_cache_builder::shards(
+    const Shard &skip) const {
+  if (skip.empty() && (m_shards < 2 || m_cache.schemas.size() < 2)) {
+    return {Shard{}};
+  }
+
+  // largest schemas are assigned first, each one to the shard with the lowest
+  // number of objects, this keeps the shards balanced
+  std::vector<std::pair<std::size_t, const std::string *>> schemas;
+  schemas.reserve(m_cache.schemas.size());
+
+  for (const auto &schema : m_cache.schemas) {
+    if (!skip.count(schema.first)) {
+      schemas.emplace_back(
+          schema.second.tables.size() + schema.second.views.size(),
+          &schema.first);
+    }
+  }
+
+  if (schemas.empty()) {
+    return {};
+  }
+
+  std::sort(schemas.begin(), schemas.end(), [](const auto &l, const auto &r) {
+    return l.first > r.first || (l.first == r.first && *l.second < *r.second);
+  });
+
+  std::vector<std::size_t> sizes(std::min(m_shards, schemas.size()), 0);
+  std::vector<Shard> result(sizes.size());
+
+  for (const auto &schema : schemas) {
+    const auto idx = std::distance(
+        sizes.begin(), std::min_element(sizes.begin(), sizes.end()));
+
+    sizes[idx] += schema.first;
+    result[idx].emplace(*schema.second);
+  }
+
+  return result;
+}
+
+void Instance_cache_builder::execute(std::vector<Task> &&tasks) const {
+  if (m_executor) {
+    m_executor(std::move(tasks));
+  } else {
+    for (const auto &task : tasks) {
+      task(m_session);
+    }
+  }
+}
+
 void Instance_cache_builder::iterate_schemas(
     const Iterate_schema &info,
     const std::function<void(const std::string &, Instance_cache::Schema *,
@@ -976,7 +1279,7 @@ void Instance_cache_builder::iterate_schemas(
 }
 
 void Instance_cache_builder::iterate_tables_and_views(
-    const Iterate_table &info,
+    const Session &session, const Shard &shard, const Iterate_table &info,
     const std::function<void(const std::string &, const std::string &,
                              Instance_cache::Table *,
                              const mysqlshdk::db::IRow *)> &table_callback,
@@ -985,8 +1288,8 @@ void Instance_cache_builder::iterate_tables_and_views(
                              const mysqlshdk::db::IRow *)> &view_callback) {
   Profiler profiler{"iterating tables and views"};
 
-  const auto result =
-      query(QH::build_query(info, schema_and_table_filter(info)));
+  const auto result = query(
+      session, QH::build_query(info, shard_filter(info, shard)));
 
   std::string current_schema;
   Instance_cache::Schema *schema = nullptr;
@@ -1003,7 +1306,11 @@ void Instance_cache_builder::iterate_tables_and_views(
         current_schema = std::move(schema_name);
         current_object.clear();
 
-        const auto it = m_cache.schemas.find(current_schema);
+        // schema names are compared using the collation of the column, rows
+        // of schemas handled by a different shard are skipped
+        const auto it = shard.empty() || shard.count(current_schema)
+                            ? m_cache.schemas.find(current_schema)
+                            : m_cache.schemas.end();
 
         if (it != m_cache.schemas.end()) {
           schema = &it->second;
@@ -1051,23 +1358,23 @@ void Instance_cache_builder::iterate_tables_and_views(
 }
 
 void Instance_cache_builder::iterate_tables(
-    const Iterate_table &info,
+    const Session &session, const Shard &shard, const Iterate_table &info,
     const std::function<void(const std::string &, const std::string &,
                              Instance_cache::Table *,
                              const mysqlshdk::db::IRow *)> &callback) {
   Profiler profiler{"iterating tables"};
 
-  iterate_tables_and_views(info, callback, {});
+  iterate_tables_and_views(session, shard, info, callback, {});
 }
 
 void Instance_cache_builder::iterate_views(
-    const Iterate_table &info,
+    const Session &session, const Shard &shard, const Iterate_table &info,
     const std::function<void(const std::string &, const std::string &,
                              Instance_cache::View *,
                              const mysqlshdk::db::IRow *)> &callback) {
   Profiler profiler{"iterating views"};
 
-  iterate_tables_and_views(info, {}, callback);
+  iterate_tables_and_views(session, shard, info, {}, callback);
 }
 
 void Instance_cache_builder::set_schema_filter() {
@@ -1154,6 +1461,21 @@ std::string Instance_cache_builder::schema_and_table_filter(
   return result;
 }
 
+std::string Instance_cache_builder::shard_filter(const Iterate_table &info,
+                                                 const Shard &shard) const {
+  auto result = schema_and_table_filter(info);
+
+  if (!shard.empty()) {
+    if (!result.empty()) {
+      result += " AND ";
+    }
+
+    result += QH::compare(info.schema_column, shard, true);
+  }
+
+  return result;
+}
+
 std::string Instance_cache_builder::object_filter(
     const Iterate_schema &info, const Object_filters &included,
     const Object_filters &excluded) const {
@@ -26,6 +26,7 @@
 #ifndef MODULES_UTIL_DUMP_INSTANCE_CACHE_H_
 #define MODULES_UTIL_DUMP_INSTANCE_CACHE_H_
 
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <memory>
@@ -95,11 +96,25 @@ struct Instance_cache {
   };
 
   struct Table {
+    /**
+     * Sets all columns of the table, in the order of their definition.
+     */
+    void set_columns(std::vector<Column> &&columns);
+
+    /**
+     * Adds an index which uses the given columns of this table. Indexes need
+     * to be added in the order of their names to ensure repeatability of the
+     * selection algorithm.
+     */
+    void add_index(const std::string &name,
+                   const std::vector<const Column *> &columns);
+
     uint64_t row_count = 0;
     uint64_t average_row_length = 0;
     std::string engine;
     std::string create_options;
     std::string comment;
+    std::string create_time;
     std::unordered_map<std::string, Index> indexes;
     const Index *primary_key = nullptr;
     // indexes are ordered to ensure repeatability of the selection algorithm
@@ -119,6 +134,8 @@ struct Instance_cache {
 
   struct Schema {
     std::string collation;
+    // checksum of definitions of columns and indexes, empty if not fetched
+    std::string checksum;
     std::unordered_map<std::string, Table> tables;
     std::unordered_map<std::string, View> views;
     std::unordered_set<std::string> events;
@@ -179,6 +196,21 @@ class Instance_cache_builder final {
       std::string,
       std::unordered_map<std::string, std::unordered_set<std::string>>>;
 
+  using Session = std::shared_ptr<mysqlshdk::db::ISession>;
+
+  /**
+   * Fetches a part of the metadata using the given session.
+   */
+  using Task = std::function<void(const Session &)>;
+
+  /**
+   * Executes the given tasks, returns once all of them are finished. Tasks are
+   * independent of each other and can be executed concurrently, as long as
+   * each of the sessions is used by one task at a time. If any of the tasks
+   * throws, the exception is rethrown once all of them are finished.
+   */
+  using Task_executor = std::function<void(std::vector<Task> &&)>;
+
   Instance_cache_builder() = delete;
 
   Instance_cache_builder(
@@ -193,6 +225,22 @@ class Instance_cache_builder final {
   Instance_cache_builder &operator=(const Instance_cache_builder &) = delete;
   Instance_cache_builder &operator=(Instance_cache_builder &&) = delete;
 
+  /**
+   * Uses the given executor to fetch the metadata, information_schema queries
+   * are split into at most the given number of shards, each one handling a
+   * subset of schemas. If not set, all queries are executed sequentially,
+   * using the session this builder was created with.
+   */
+  Instance_cache_builder &executor(Task_executor executor, std::size_t shards);
+
+  /**
+   * Computes checksums of the definitions of tables and views. Columns and
+   * indexes of the schemas whose checksums and creation times of all tables
+   * and views match the given snapshot are not fetched, but taken from the
+   * snapshot instead. Needs to be called before metadata().
+   */
+  Instance_cache_builder &snapshot(Instance_cache &&snapshot);
+
   Instance_cache_builder &metadata(const Partition_filters &partitions);
 
   Instance_cache_builder &users();
@@ -224,6 +272,12 @@ class Instance_cache_builder final {
     std::string name;
   };
 
+  /**
+   * Names of the schemas handled by a single task, empty if all schemas are
+   * handled.
+   */
+  using Shard = std::set<std::string>;
+
   void filter_schemas();
 
   void filter_tables();
@@ -238,15 +292,27 @@ class Instance_cache_builder final {
 
   void fetch_ndbinfo();
 
-  void fetch_view_metadata();
+  void fetch_view_metadata(const Session &session, const Shard &shard);
+
+  void fetch_columns(const Session &session, const Shard &shard);
+
+  void fetch_table_indexes(const Session &session, const Shard &shard);
+
+  bool fetch_table_histograms(const Session &session, const Shard &shard);
+
+  void fetch_table_partitions(const Session &session, const Shard &shard,
+                              const Partition_filters &partitions);
 
-  void fetch_columns();
+  void fetch_triggers(const Session &session, const Shard &shard,
+                      const Iterate_table &info, uint64_t *count);
 
-  void fetch_table_indexes();
+  void fetch_checksums(const Session &session, const Shard &shard);
 
-  void fetch_table_histograms();
+  Shard reuse_snapshot();
 
-  void fetch_table_partitions(const Partition_filters &partitions);
+  std::vector<Shard> shards(const Shard &skip = {}) const;
+
+  void execute(std::vector<Task> &&tasks) const;
 
   void iterate_schemas(
       const Iterate_schema &info,
@@ -254,19 +320,19 @@ class Instance_cache_builder final {
                                const mysqlshdk::db::IRow *)> &callback);
 
   void iterate_tables(
-      const Iterate_table &info,
+      const Session &session, const Shard &shard, const Iterate_table &info,
       const std::function<void(const std::string &, const std::string &,
                                Instance_cache::Table *,
                                const mysqlshdk::db::IRow *)> &callback);
 
   void iterate_views(
-      const Iterate_table &info,
+      const Session &session, const Shard &shard, const Iterate_table &info,
       const std::function<void(const std::string &, const std::string &,
                                Instance_cache::View *,
                                const mysqlshdk::db::IRow *)> &callback);
 
   void iterate_tables_and_views(
-      const Iterate_table &info,
+      const Session &session, const Shard &shard, const Iterate_table &info,
       const std::function<void(const std::string &, const std::string &,
                                Instance_cache::Table *,
                                const mysqlshdk::db::IRow *)> &table_callback,
@@ -295,6 +361,8 @@ class Instance_cache_builder final {
 
   std::string schema_and_table_filter(const Iterate_table &info) const;
 
+  std::string shard_filter(const Iterate_table &info, const Shard &shard) const;
+
   std::string object_filter(const Iterate_schema &info,
                             const Object_filters &included,
                             const Object_filters &excluded) const;
@@ -305,7 +373,12 @@ class Instance_cache_builder final {
 
   inline std::shared_ptr<mysqlshdk::db::IResult> query(
       std::string_view sql) const {
-    return m_session->query(sql);
+    return query(m_session, sql);
+  }
+
+  static inline std::shared_ptr<mysqlshdk::db::IResult> query(
+      const Session &session, std::string_view sql) {
+    return session->query(sql);
   }
 
   /**
@@ -358,6 +431,12 @@ class Instance_cache_builder final {
   bool m_has_tables = false;
 
   bool m_has_views = false;
+
+  Task_executor m_executor;
+
+  std::size_t m_shards = 1;
+
+  std::unique_ptr<Instance_cache> m_snapshot;
 };
 
 }  // namespace dump
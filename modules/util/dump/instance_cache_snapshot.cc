@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/instance_cache_snapshot.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+// version needs to be increased if format or meaning of the stored values
+// (i.e. values of mysqlshdk::db::Type) changes
+constexpr std::string_view k_magic = "MSHCACHE";
+constexpr uint64_t k_version = 1;
+
+enum Column_flags : uint8_t {
+  CSV_UNSAFE = 1 << 0,
+  GENERATED = 1 << 1,
+  AUTO_INCREMENT = 1 << 2,
+  NULLABLE = 1 << 3,
+};
+
+class Writer final {
+ public:
+  void write(uint64_t value) {
+    // LEB128
+    do {
+      uint8_t byte = value & 0x7f;
+      value >>= 7;
+
+      if (value) {
+        byte |= 0x80;
+      }
+
+      m_data.push_back(static_cast<char>(byte));
+    } while (value);
+  }
+
+  void write(std::string_view value) {
+    write(static_cast<uint64_t>(value.size()));
+    m_data.append(value);
+  }
+
+  void write_raw(std::string_view value) { m_data.append(value); }
+
+  std::string &&data() { return std::move(m_data); }
+
+ private:
+  std::string m_data;
+};
+
+class Reader final {
+ public:
+  explicit Reader(std::string_view data) : m_data(data) {}
+
+  uint64_t read_uint() {
+    uint64_t value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7) {
+      const auto byte = static_cast<uint8_t>(next(1)[0]);
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+
+      if (!(byte & 0x80)) {
+        return value;
+      }
+    }
+
+    throw_corrupted();
+  }
+
+  /**
+   * Reads the number of elements which follow, each of them occupies at least
+   * one byte, so that a corrupted value does not result in a huge allocation.
+   */
+  uint64_t read_count() {
+    const auto count = read_uint();
+
+    if (count > m_data.size()) {
+      throw_corrupted();
+    }
+
+    return count;
+  }
+
+  std::string read_string() {
+    return std::string{next(read_uint())};
+  }
+
+  std::string_view read_raw(std::size_t size) { return next(size); }
+
+  bool eof() const { return m_data.empty(); }
+
+ private:
+  [[noreturn]] static void throw_corrupted() {
+    throw std::runtime_error("Snapshot is corrupted");
+  }
+
+  std::string_view next(uint64_t size) {
+    if (size > m_data.size()) {
+      throw_corrupted();
+    }
+
+    const auto result = m_data.substr(0, size);
+    m_data.remove_prefix(size);
+    return result;
+  }
+
+  std::string_view m_data;
+};
+
+template <typename C>
+std::map<std::string_view, const typename C::mapped_type *> sorted(
+    const C &objects) {
+  std::map<std::string_view, const typename C::mapped_type *> result;
+
+  for (const auto &object : objects) {
+    result.emplace(object.first, &object.second);
+  }
+
+  return result;
+}
+
+void write_table(const Instance_cache::Table &table, Writer *writer) {
+  writer->write(table.create_time);
+  writer->write(static_cast<uint64_t>(table.all_columns.size()));
+
+  for (const auto &column : table.all_columns) {
+    uint8_t flags = 0;
+
+    if (column.csv_unsafe) flags |= CSV_UNSAFE;
+    if (column.generated) flags |= GENERATED;
+    if (column.auto_increment) flags |= AUTO_INCREMENT;
+    if (column.nullable) flags |= NULLABLE;
+
+    writer->write(column.name);
+    writer->write(static_cast<uint64_t>(flags));
+    writer->write(static_cast<uint64_t>(column.type));
+  }
+
+  // indexes are stored in order of their names, this is the order in which
+  // they need to be restored
+  const auto first = table.all_columns.data();
+  writer->write(static_cast<uint64_t>(table.indexes.size()));
+
+  for (const auto &index : sorted(table.indexes)) {
+    writer->write(index.first);
+    writer->write(static_cast<uint64_t>(index.second->columns().size()));
+
+    for (const auto column : index.second->columns()) {
+      writer->write(static_cast<uint64_t>(column - first));
+    }
+  }
+}
+
+void read_table(Reader *reader, Instance_cache::Table *table) {
+  table->create_time = reader->read_string();
+
+  std::vector<Instance_cache::Column> columns(reader->read_count());
+
+  for (auto &column : columns) {
+    column.name = reader->read_string();
+    column.quoted_name = shcore::quote_identifier(column.name);
+
+    const auto flags = reader->read_uint();
+    column.csv_unsafe = flags & CSV_UNSAFE;
+    column.generated = flags & GENERATED;
+    column.auto_increment = flags & AUTO_INCREMENT;
+    column.nullable = flags & NULLABLE;
+
+    const auto type = reader->read_uint();
+
+    if (type > static_cast<uint64_t>(mysqlshdk::db::Type::Set)) {
+      throw std::runtime_error("Snapshot contains an unknown column type");
+    }
+
+    column.type = static_cast<mysqlshdk::db::Type>(type);
+  }
+
+  table->set_columns(std::move(columns));
+
+  for (auto indexes = reader->read_count(); indexes > 0; --indexes) {
+    const auto name = reader->read_string();
+    std::vector<const Instance_cache::Column *> index_columns;
+
+    for (auto count = reader->read_count(); count > 0; --count) {
+      const auto idx = reader->read_uint();
+
+      if (idx >= table->all_columns.size()) {
+        throw std::runtime_error("Snapshot contains an invalid index");
+      }
+
+      index_columns.emplace_back(&table->all_columns[idx]);
+    }
+
+    table->add_index(name, index_columns);
+  }
+}
+
+}  // namespace
+
+std::string serialize_snapshot(const Instance_cache &cache) {
+  Writer writer;
+
+  writer.write_raw(k_magic);
+  writer.write(k_version);
+
+  std::vector<std::pair<std::string_view, const Instance_cache::Schema *>>
+      schemas;
+
+  for (const auto &schema : sorted(cache.schemas)) {
+    if (!schema.second->checksum.empty()) {
+      schemas.emplace_back(schema);
+    }
+  }
+
+  writer.write(static_cast<uint64_t>(schemas.size()));
+
+  for (const auto &schema : schemas) {
+    writer.write(schema.first);
+    writer.write(schema.second->checksum);
+
+    writer.write(static_cast<uint64_t>(schema.second->tables.size()));
+
+    for (const auto &table : sorted(schema.second->tables)) {
+      writer.write(table.first);
+      write_table(*table.second, &writer);
+    }
+
+    writer.write(static_cast<uint64_t>(schema.second->views.size()));
+
+    for (const auto &view : sorted(schema.second->views)) {
+      writer.write(view.first);
+      write_table(*view.second, &writer);
+    }
+  }
+
+  return std::move(writer.data());
+}
+
+Instance_cache deserialize_snapshot(std::string_view data) {
+  Reader reader{data};
+
+  if (data.size() < k_magic.size() ||
+      reader.read_raw(k_magic.size()) != k_magic) {
+    throw std::runtime_error("File is not a snapshot of the instance cache");
+  }
+
+  if (const auto version = reader.read_uint(); k_version != version) {
+    throw std::runtime_error("Unsupported version of the snapshot: " +
+                             std::to_string(version));
+  }
+
+  Instance_cache cache;
+
+  for (auto schemas = reader.read_count(); schemas > 0; --schemas) {
+    auto &schema = cache.schemas[reader.read_string()];
+    schema.checksum = reader.read_string();
+
+    for (auto tables = reader.read_count(); tables > 0; --tables) {
+      read_table(&reader, &schema.tables[reader.read_string()]);
+    }
+
+    for (auto views = reader.read_count(); views > 0; --views) {
+      read_table(&reader, &schema.views[reader.read_string()]);
+    }
+  }
+
+  if (!reader.eof()) {
+    throw std::runtime_error("Snapshot contains unexpected data");
+  }
+
+  return cache;
+}
+
+void save_snapshot(const Instance_cache &cache, const std::string &path) {
+  const auto temp_path = path + ".tmp";
+
+  if (!shcore::create_file(temp_path, serialize_snapshot(cache), true)) {
+    throw std::runtime_error("Failed to write '" + temp_path +
+                             "': " + shcore::errno_to_string(errno));
+  }
+
+  shcore::rename_file(temp_path, path);
+}
+
+bool load_snapshot(const std::string &path, Instance_cache *cache) {
+  if (!shcore::is_file(path)) {
+    return false;
+  }
+
+  std::string data;
+
+  if (!shcore::load_text_file(path, data, true)) {
+    throw std::runtime_error("Failed to read '" + path +
+                             "': " + shcore::errno_to_string(errno));
+  }
+
+  *cache = deserialize_snapshot(data);
+
+  return true;
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_INSTANCE_CACHE_SNAPSHOT_H_
+#define MODULES_UTIL_DUMP_INSTANCE_CACHE_SNAPSHOT_H_
+
+#include <string>
+#include <string_view>
+
+#include "modules/util/dump/instance_cache.h"
+
+namespace mysqlsh {
+namespace dump {
+
+/**
+ * Serializes the part of the cache which can be reused by the subsequent
+ * dumps of the same instance: checksums of the schemas, creation times,
+ * columns and indexes of their tables and views. Only schemas which have a
+ * checksum are stored.
+ *
+ * @param cache Cache to be serialized.
+ *
+ * @returns Serialized snapshot.
+ */
+std::string serialize_snapshot(const Instance_cache &cache);
+
+/**
+ * Restores the cache serialized by serialize_snapshot().
+ *
+ * @param data Serialized snapshot.
+ *
+ * @returns Restored cache, containing only the serialized information.
+ *
+ * @throws std::runtime_error If data is not a valid snapshot.
+ */
+Instance_cache deserialize_snapshot(std::string_view data);
+
+/**
+ * Writes the snapshot of the cache to the given file, replacing the existing
+ * one once the new file is complete.
+ *
+ * @throws std::runtime_error If file could not be written.
+ */
+void save_snapshot(const Instance_cache &cache, const std::string &path);
+
+/**
+ * Reads the snapshot of the cache from the given file.
+ *
+ * @param path File to read.
+ * @param cache Receives the restored cache.
+ *
+ * @returns false if file does not exist.
+ *
+ * @throws std::runtime_error If file is not a valid snapshot.
+ */
+bool load_snapshot(const std::string &path, Instance_cache *cache);
+
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_INSTANCE_CACHE_SNAPSHOT_H_
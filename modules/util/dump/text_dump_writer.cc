@@ -27,6 +27,8 @@
 
 #include <utility>
 
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+
 namespace mysqlsh {
 namespace dump {
 
@@ -92,8 +94,8 @@ Text_dump_writer::Text_dump_writer(const import_table::Dialect &dialect)
 
 void Text_dump_writer::store_preamble(
     const std::vector<mysqlshdk::db::Column> &metadata,
-    const std::vector<Encoding_type> &pre_encoded_columns) {
-  read_metadata(metadata, pre_encoded_columns);
+    const std::vector<Encoding_type> &encoded_columns) {
+  read_metadata(metadata, encoded_columns);
 
   // no preamble
 }
@@ -114,7 +116,7 @@ void Text_dump_writer::store_postamble() {
 
 void Text_dump_writer::read_metadata(
     const std::vector<mysqlshdk::db::Column> &metadata,
-    const std::vector<Encoding_type> &pre_encoded_columns) {
+    const std::vector<Encoding_type> &encoded_columns) {
   m_num_fields = static_cast<uint32_t>(metadata.size());
 
   m_is_string_type.clear();
@@ -126,6 +128,8 @@ void Text_dump_writer::read_metadata(
   m_needs_escape.clear();
   m_needs_escape.resize(m_num_fields);
 
+  m_encoded_columns = encoded_columns;
+
   std::size_t fixed_length =
       m_dialect.lines_starting_by.length() + m_line_terminator.length();
 
@@ -136,7 +140,10 @@ void Text_dump_writer::read_metadata(
 
   for (uint32_t i = 0; i < m_num_fields; ++i) {
     const auto type = metadata[i].get_type();
-    const auto is_string = mysqlshdk::db::is_string_type(type);
+    // values encoded by the writer are stored as strings, just like the ones
+    // encoded by the server
+    const auto is_string = mysqlshdk::db::is_string_type(type) ||
+                           encoded_by_writer(encoded_columns, i);
 
     m_is_string_type[i] = is_string;
     // bit fields are transferred in binary format, should not be inspected for
@@ -147,11 +154,19 @@ void Text_dump_writer::read_metadata(
     if (m_is_number_type[i]) {
       m_needs_escape[i] = m_numbers_need_escape;
     } else {
-      if (pre_encoded_columns.size() == metadata.size()) {
-        if (pre_encoded_columns[i] == Encoding_type::BASE64)
+      if (encoded_columns.size() == metadata.size()) {
+        if (encoded_columns[i] == Encoding_type::BASE64)
           m_needs_escape[i] = m_base64_need_escape;
-        else if (pre_encoded_columns[i] == Encoding_type::HEX)
+        else if (encoded_columns[i] == Encoding_type::HEX)
           m_needs_escape[i] = m_hex_need_escape;
+        else if (encoded_columns[i] == Encoding_type::ENCODE_BASE64)
+          m_needs_escape[i] = Escape_type::FULL == m_base64_need_escape
+                                  ? Escape_type::FULL
+                                  : Escape_type::ENCODE_BASE64;
+        else if (encoded_columns[i] == Encoding_type::ENCODE_HEX)
+          m_needs_escape[i] = Escape_type::FULL == m_hex_need_escape
+                                  ? Escape_type::FULL
+                                  : Escape_type::ENCODE_HEX;
       }
     }
 
@@ -199,7 +214,19 @@ void Text_dump_writer::store_field(const mysqlshdk::db::IRow *row,
   } else {
     quote_field(idx);
 
-    if (!m_escape || m_needs_escape[idx] == Escape_type::NONE) {
+    if (m_needs_escape[idx] == Escape_type::FULL &&
+        encoded_by_writer(m_encoded_columns, idx)) {
+      // encoded value contains characters which need to be escaped
+      encode(m_encoded_columns[idx], data, length);
+      data = m_encoded.data();
+      length = m_encoded.length();
+    }
+
+    if (m_needs_escape[idx] == Escape_type::ENCODE_BASE64) {
+      buffer()->append_base64(data, length);
+    } else if (m_needs_escape[idx] == Escape_type::ENCODE_HEX) {
+      buffer()->append_hex(data, length);
+    } else if (!m_escape || m_needs_escape[idx] == Escape_type::NONE) {
       buffer()->will_write(length);
       buffer()->append(data, length);
     } else if (m_escape && m_needs_escape[idx] == Escape_type::BASE64 &&
@@ -272,6 +299,17 @@ void Text_dump_writer::store_field(const mysqlshdk::db::IRow *row,
   }
 }
 
+void Text_dump_writer::encode(Encoding_type encoding, const char *data,
+                              std::size_t length) {
+  if (Encoding_type::ENCODE_BASE64 == encoding) {
+    m_encoded.resize(shcore::base64_encoded_length(length));
+    m_encoded.resize(shcore::encode_base64(data, length, m_encoded.data()));
+  } else {
+    m_encoded.resize(2 * length);
+    m_encoded.resize(shcore::encode_hex(data, length, m_encoded.data()));
+  }
+}
+
 void Text_dump_writer::quote_field(uint32_t idx) {
   if (!m_dialect.fields_optionally_enclosed || m_is_string_type[idx]) {
     buffer()->append_fixed(m_dialect.fields_enclosed_by);
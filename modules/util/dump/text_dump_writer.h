@@ -52,19 +52,21 @@ class Text_dump_writer : public Dump_writer {
  private:
   void store_preamble(
       const std::vector<mysqlshdk::db::Column> &metadata,
-      const std::vector<Encoding_type> &pre_encoded_columns) override;
+      const std::vector<Encoding_type> &encoded_columns) override;
 
   void store_row(const mysqlshdk::db::IRow *row) override;
 
   void store_postamble() override;
 
   void read_metadata(const std::vector<mysqlshdk::db::Column> &metadata,
-                     const std::vector<Encoding_type> &pre_encoded_columns);
+                     const std::vector<Encoding_type> &encoded_columns);
 
   void start_row();
 
   void store_field(const mysqlshdk::db::IRow *row, uint32_t idx);
 
+  void encode(Encoding_type encoding, const char *data, std::size_t length);
+
   void quote_field(uint32_t idx);
 
   void store_null();
@@ -97,6 +99,11 @@ class Text_dump_writer : public Dump_writer {
   std::vector<int> m_is_number_type;
 
   std::vector<Escape_type> m_needs_escape;
+
+  std::vector<Encoding_type> m_encoded_columns;
+
+  // values which are encoded and then escaped
+  std::string m_encoded;
 };
 
 }  // namespace dump
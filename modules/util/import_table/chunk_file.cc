@@ -27,8 +27,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 
 namespace mysqlsh {
@@ -142,12 +144,48 @@ void File_iterator::force_offset(size_t start_from_offset) {
   }
 }
 
+bool File_iterator::skip_to(uint8_t needle, size_t limit, uint8_t *previous) {
+  assert(previous);
+
+  if (m_ptr >= m_ptr_end || m_offset >= limit) {
+    return false;
+  }
+
+  const auto available =
+      std::min(static_cast<size_t>(m_ptr_end - m_ptr), limit - m_offset);
+  // memchr() is vectorized and selects the best implementation for the CPU
+  const auto found =
+      static_cast<const uint8_t *>(std::memchr(m_ptr, needle, available));
+  const auto skip = found ? static_cast<size_t>(found - m_ptr) : available;
+
+  if (0 == skip) {
+    return false;
+  }
+
+  // move to the last skipped byte, then step over it checking the boundaries
+  m_ptr += skip - 1;
+  m_offset += skip - 1;
+  *previous = *m_ptr;
+
+  ++(*this);
+
+  return true;
+}
+
 File_handler::File_handler(mysqlshdk::storage::IFile *fh) : m_fh(fh) {
   if (!m_fh->is_open()) {
     m_fh->open(mysqlshdk::storage::Mode::READ);
   }
 
   m_file_size = m_fh->file_size();
+
+  if (const auto compressed =
+          dynamic_cast<mysqlshdk::storage::Compressed_file *>(m_fh)) {
+    // offsets of compressed files refer to the uncompressed data
+    if (const auto size = compressed->uncompressed_size()) {
+      m_file_size = *size;
+    }
+  }
   m_aio.fh = m_fh;
   m_aio.length = Buffer::capacity();
 
@@ -40,6 +40,7 @@
 #include "modules/util/import_table/helpers.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
 
 namespace mysqlsh {
 namespace import_table {
@@ -171,6 +172,19 @@ class File_iterator final {
    */
   void force_offset(size_t start_from_offset);
 
+  /**
+   * Advances iterator to the first occurrence of needle in the current buffer,
+   * or to the end of the current buffer if needle is not there. Iterator is
+   * not moved past the limit offset.
+   *
+   * @param needle Byte to search for.
+   * @param limit File offset which is not going to be crossed.
+   * @param previous Receives the last byte which was skipped.
+   *
+   * @return true if at least one byte was skipped.
+   */
+  bool skip_to(uint8_t needle, size_t limit, uint8_t *previous);
+
   ~File_iterator() = default;
 
  private:
@@ -332,6 +346,68 @@ ForwardIt find(ForwardIt first, ForwardIt last, ForwardIt2 needle_first,
   }
 }
 
+/**
+ * Searches for the first occurrence of the sequence of elements [needle_first,
+ * needle_last) in the file range [first, last).
+ *
+ * Specialization which skips over the bytes which cannot start the needle a
+ * buffer at a time, instead of visiting them one by one. Results and state of
+ * the context are the same as in case of the generic version.
+ *
+ * @tparam ForwardIt2 Forward iterator type.
+ * @param first Iterator to the first element of range to examine.
+ * @param last Iterator to the last element of range to examine.
+ * @param needle_first Iterator to first element of range to search for.
+ * @param needle_last Iterator to last element of range to search for.
+ * @return Returns one past first element from range [first, last) that
+ * satisfies search criteria, with character before matching needle and boolean
+ * flag indicating if needle was found.
+ */
+template <typename ForwardIt2>
+File_iterator find(File_iterator first, File_iterator last,
+                   ForwardIt2 needle_first, ForwardIt2 needle_last,
+                   Find_context<File_iterator::value_type> *context) {
+  assert(context);
+
+  if (needle_first == needle_last) {
+    context->last_element = *first;
+    context->needle_found = true;
+    return first;
+  }
+
+  const auto needle_start = static_cast<uint8_t>(*needle_first);
+  const auto limit = last.offset();
+
+  for (;; ++first) {
+    if (first != last) {
+      uint8_t previous;
+
+      if (first.skip_to(needle_start, limit, &previous)) {
+        context->preceding_element_set = true;
+        context->preceding_element = previous;
+      }
+    }
+
+    context->last_element = *first;
+    File_iterator it = first;
+    for (ForwardIt2 needle_it = needle_first;; it++, ++needle_it) {
+      if (needle_it == needle_last) {
+        context->needle_found = true;
+        return it;
+      }
+      if (it == last) {
+        context->needle_found = false;
+        return last;
+      }
+      if (!(*it == *needle_it)) {
+        break;
+      }
+    }
+    context->preceding_element_set = true;
+    context->preceding_element = *first;
+  }
+}
+
 /**
  * Skip count lines/rows delimited by needle.
  *
@@ -412,7 +488,7 @@ Iter skip_rows(Iter first, Iter last, const std::string &needle,
  * @param range_queue Queue where file chunk offset will be stored.
  */
 template <typename Iter,
-          class QueueContainer = shcore::Synchronized_queue<File_import_info>>
+          class QueueContainer = shcore::Work_stealing_queue<File_import_info>>
 void chunk_by_max_bytes(Iter first, Iter last, const std::string &needle,
                         char escape_char, const size_t max_bytes_per_chunk,
                         QueueContainer *range_queue,
@@ -463,7 +539,7 @@ void chunk_by_max_bytes(Iter first, Iter last, const std::string &needle,
  * @param range_queue Queue where file chunk offset will be stored.
  */
 template <typename Iter,
-          class QueueContainer = shcore::Synchronized_queue<File_import_info>>
+          class QueueContainer = shcore::Work_stealing_queue<File_import_info>>
 void chunk_by_max_bytes(Iter first, Iter last, const std::string &needle,
                         const size_t max_bytes_per_chunk,
                         QueueContainer *range_queue,
@@ -511,7 +587,7 @@ class Chunk_file final {
   void set_file_handle(mysqlshdk::storage::IFile *fh) { m_file_handle = fh; }
   void set_dialect(const Dialect &dialect) { m_dialect = dialect; }
   void set_rows_to_skip(const size_t rows) { m_skip_rows_count = rows; }
-  void set_output_queue(shcore::Synchronized_queue<File_import_info> *queue) {
+  void set_output_queue(shcore::Work_stealing_queue<File_import_info> *queue) {
     m_queue = queue;
   }
   void start();
@@ -520,7 +596,7 @@ class Chunk_file final {
   size_t m_chunk_size = 2 * BUFFER_SIZE;
   Dialect m_dialect;
   uint64_t m_skip_rows_count = 0;
-  shcore::Synchronized_queue<File_import_info> *m_queue = nullptr;
+  shcore::Work_stealing_queue<File_import_info> *m_queue = nullptr;
   mysqlshdk::storage::IFile *m_file_handle;
 };
 
@@ -183,11 +183,16 @@ void Import_table::import() {
   if (m_opt.is_multifile()) {
     build_queue();
   } else {
-    if (m_opt.is_compressed(m_opt.filelist_from_user()[0])) {
-      // cannot chunk compressed files
-      build_queue();
-    } else {
+    if (!m_opt.is_compressed(m_opt.filelist_from_user()[0])) {
+      chunk_file();
+    } else if (m_opt.uncompressed_size().has_value()) {
+      // compressed file with an index of frames, chunks refer to the
+      // uncompressed data
+      m_has_compressed_files = true;
       chunk_file();
+    } else {
+      // cannot chunk compressed files without an index
+      build_queue();
     }
   }
 
@@ -39,7 +39,7 @@
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
 #include "mysqlshdk/libs/utils/profiling.h"
-#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
 
 namespace mysqlsh {
 namespace import_table {
@@ -97,7 +97,7 @@ class Import_table final {
   size_t m_total_file_size = 0;
   bool m_has_compressed_files = false;
 
-  shcore::Synchronized_queue<File_import_info> m_range_queue;
+  shcore::Work_stealing_queue<File_import_info> m_range_queue;
 
   const Import_table_options &m_opt;
   Stats m_stats;
@@ -224,7 +224,8 @@ bool Import_table_option_pack::is_compressed(const std::string &path) const {
   const auto extension = std::get<1>(shcore::path::split_extension(path));
 
   return extension == get_extension(Compression::GZIP) ||
-         extension == get_extension(Compression::ZSTD);
+         extension == get_extension(Compression::ZSTD) ||
+         extension == get_extension(Compression::LZ4);
 }
 
 Import_table_options::Import_table_options(
@@ -287,10 +288,28 @@ void Import_table_options::validate() {
       m_file_handle = create_file_handle(m_filelist_from_user[0]);
       m_file_handle->open(mysqlshdk::storage::Mode::READ);
       m_file_size = m_file_handle->file_size();
+
+      if (const auto compressed =
+              dynamic_cast<mysqlshdk::storage::Compressed_file *>(
+                  m_file_handle.get())) {
+        // set only if file holds an index of independently decompressable
+        // frames
+        m_uncompressed_size = compressed->uncompressed_size();
+      }
+
       m_file_handle->close();
     }
   }
+
+  const auto requested_threads = m_threads_size;
   m_threads_size = calc_thread_size();
+
+  if (!is_multifile() && 1 == m_threads_size && requested_threads > 1 &&
+      is_compressed(m_filelist_from_user[0])) {
+    // a single compressed file is loaded by one thread, gzip files written
+    // in blocks can be decompressed using the remaining ones
+    m_decompression_threads = static_cast<std::size_t>(requested_threads);
+  }
 }
 
 std::unique_ptr<mysqlshdk::storage::IFile>
@@ -310,7 +329,11 @@ Import_table_option_pack::create_file_handle(
   } catch (...) {
     compr = mysqlshdk::storage::Compression::NONE;
   }
-  return mysqlshdk::storage::make_file(std::move(file_handler), compr);
+  mysqlshdk::storage::Compression_options options;
+  options.threads = m_decompression_threads;
+
+  return mysqlshdk::storage::make_file(std::move(file_handler), compr,
+                                       options);
 }
 
 size_t Import_table_option_pack::calc_thread_size() {
@@ -318,13 +341,15 @@ size_t Import_table_option_pack::calc_thread_size() {
   int64_t threads_size = std::max(static_cast<int64_t>(1), m_threads_size);
 
   if (!is_multifile()) {
-    if (is_compressed(m_filelist_from_user[0])) {
-      // a single compressed file cannot be chunked, we're going to use a single
-      // thread
+    if (is_compressed(m_filelist_from_user[0]) &&
+        !m_uncompressed_size.has_value()) {
+      // a single compressed file without an index cannot be chunked, we're
+      // going to use a single thread
       threads_size = 1;
     } else {
       // We do not need to spawn more threads than file chunks
-      const size_t calculated_threads = (m_file_size / bytes_per_chunk()) + 1;
+      const size_t calculated_threads =
+          (m_uncompressed_size.value_or(m_file_size) / bytes_per_chunk()) + 1;
       if (calculated_threads <
           static_cast<size_t>(std::numeric_limits<int64_t>::max())) {
         threads_size =
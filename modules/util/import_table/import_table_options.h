@@ -114,6 +114,14 @@ class Import_table_option_pack {
 
   size_t file_size() const { return m_file_size; }
 
+  /**
+   * Size of uncompressed data of a single compressed file, set only if such
+   * file can be imported in chunks.
+   */
+  const std::optional<size_t> &uncompressed_size() const {
+    return m_uncompressed_size;
+  }
+
   uint64_t bytes_per_chunk() const;
 
   size_t max_transaction_size() const;
@@ -150,11 +158,13 @@ class Import_table_option_pack {
 
   std::vector<std::string> m_filelist_from_user;
   size_t m_file_size;
+  std::optional<size_t> m_uncompressed_size;
   std::string m_table;
   std::string m_schema;
   std::string m_partition;
   std::string m_character_set;
   int64_t m_threads_size = 8;
+  std::size_t m_decompression_threads = 0;
   std::optional<uint64_t> m_bytes_per_chunk;
   size_t m_max_bytes_per_transaction = 0;
   shcore::Array_t m_columns;
@@ -534,7 +534,7 @@ Load_data_worker::Load_data_worker(
     const Import_table_options &options, int64_t thread_id,
     std::atomic<size_t> *prog_sent_bytes, std::atomic<size_t> *prog_file_bytes,
     volatile bool *interrupt,
-    shcore::Synchronized_queue<File_import_info> *range_queue,
+    shcore::Work_stealing_queue<File_import_info> *range_queue,
     std::vector<std::exception_ptr> *thread_exception, Stats *stats,
     const std::string &query_comment)
     : m_opt(options),
@@ -761,19 +761,20 @@ void Load_data_worker::execute(
             if (r.range_read) {
               fi.bytes_left = r.range.second - r.range.first;
               // TODO(pawel): maxBytesPerTransaction should not be ignored in
-              // case of a single uncompressed file imported in chunks
+              // case of a single file imported in chunks
               max_trx_size = 0;
 
               // if fi.range_read == true, we're importing in chunks from a
-              // single uncompressed file, rows were already skipped
+              // single file, rows were already skipped
               query_ignore_lines.clear();
             } else {
               fi.bytes_left = 0;
               max_trx_size = m_opt.max_transaction_size();
 
               if (m_opt.skip_rows_count() > 0) {
-                // this handles the case when a single compressed file or
-                // multiple files are being imported and skipRows is set
+                // this handles the case when a single compressed file which
+                // cannot be chunked or multiple files are being imported and
+                // skipRows is set
                 query_ignore_lines = " IGNORE " +
                                      std::to_string(m_opt.skip_rows_count()) +
                                      " LINES";
@@ -43,7 +43,7 @@
 #include "mysqlshdk/libs/storage/ifile.h"
 #include "mysqlshdk/libs/textui/text_progress.h"
 #include "mysqlshdk/libs/utils/rate_limit.h"
-#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
 
 namespace mysqlsh {
 namespace import_table {
@@ -161,7 +161,7 @@ class Load_data_worker final {
                    std::atomic<size_t> *prog_sent_bytes,
                    std::atomic<size_t> *prog_file_bytes,
                    volatile bool *interrupt,
-                   shcore::Synchronized_queue<File_import_info> *range_queue,
+                   shcore::Work_stealing_queue<File_import_info> *range_queue,
                    std::vector<std::exception_ptr> *thread_exception,
                    Stats *stats, const std::string &query_comment = "");
   Load_data_worker(const Load_data_worker &other) = default;
@@ -183,7 +183,7 @@ class Load_data_worker final {
   std::atomic<size_t> *m_prog_sent_bytes;
   std::atomic<size_t> *m_prog_file_bytes;
   volatile bool &m_interrupt;
-  shcore::Synchronized_queue<File_import_info> *m_range_queue;
+  shcore::Work_stealing_queue<File_import_info> *m_range_queue;
   std::vector<std::exception_ptr> &m_thread_exception;
   Stats &m_stats;
   std::string m_query_comment;
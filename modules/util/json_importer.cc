@@ -29,11 +29,20 @@
 #else
 #include <sys/select.h>
 #endif
+#include <atomic>
+#include <condition_variable>
 #include <deque>
+#include <exception>
 #include <istream>
+#include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
 #include "mysqlshdk/libs/db/mysqlx/util/setter_any.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
 #include "mysqlshdk/libs/utils/utils_buffered_input.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -183,6 +192,148 @@ Json_importer Prepare_json_import::build() {
  */
 static constexpr const int k_inserts_per_transaction = 8;
 
+namespace {
+
+/**
+ * Approximate size of a block of documents handed to a single worker thread
+ * during a parallel import.
+ */
+constexpr size_t k_chunk_size = 2 * 1024 * 1024;
+
+/**
+ * A block of complete top-level JSON documents.
+ */
+struct Json_chunk {
+  std::string data;
+  // offset of the first byte of data in the input
+  size_t offset = 0;
+};
+
+/**
+ * Finds the boundaries of top-level JSON documents without parsing them. The
+ * state is carried over between consecutive calls to scan(), documents can
+ * span multiple blocks of input.
+ */
+class Document_boundary_finder final {
+ public:
+  /**
+   * Scans the given block of input.
+   *
+   * @returns Position right after the last top-level document which ends in
+   *          the given block, nullptr if there's no such document.
+   */
+  const char *scan(const char *begin, const char *end) {
+    const char *boundary = nullptr;
+
+    for (auto p = begin; p != end; ++p) {
+      if (m_in_string) {
+        if (m_escape) {
+          m_escape = false;
+        } else if ('\\' == *p) {
+          m_escape = true;
+        } else if ('"' == *p) {
+          m_in_string = false;
+        }
+
+        continue;
+      }
+
+      switch (*p) {
+        case '"':
+          m_in_string = true;
+          break;
+
+        case '{':
+        case '[':
+          ++m_depth;
+          break;
+
+        case '}':
+        case ']':
+          // invalid input is reported by the parser
+          if (m_depth > 0 && 0 == --m_depth) {
+            boundary = p + 1;
+          }
+          break;
+      }
+    }
+
+    return boundary;
+  }
+
+ private:
+  uint64_t m_depth = 0;
+  bool m_in_string = false;
+  bool m_escape = false;
+};
+
+}  // namespace
+
+/**
+ * State shared by the threads of a parallel import.
+ */
+struct Json_importer::Parallel_state {
+  explicit Parallel_state(Json_importer *owner) : owner(owner) {}
+
+  bool stopped() const { return cancelled || failed; }
+
+  void set_error(std::exception_ptr e) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      if (!exception) exception = std::move(e);
+      failed = true;
+    }
+
+    chunk_done.notify_all();
+  }
+
+  void cancel() {
+    cancelled = true;
+    chunk_done.notify_all();
+  }
+
+  /**
+   * Blocks the reader until workers catch up, keeps the memory usage bounded.
+   */
+  void wait_for_workers(uint64_t max_chunks) {
+    std::unique_lock<std::mutex> lock(mutex);
+    chunk_done.wait(
+        lock, [&]() { return stopped() || chunks_in_flight < max_chunks; });
+    ++chunks_in_flight;
+  }
+
+  void finished_chunk() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      --chunks_in_flight;
+    }
+
+    chunk_done.notify_one();
+  }
+
+  void imported(uint64_t documents) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &stats = owner->m_stats;
+
+    stats.documents_successfully_imported += documents;
+
+    if (owner->m_print) {
+      owner->m_print(".. " +
+                     std::to_string(stats.documents_successfully_imported));
+    }
+  }
+
+  Json_importer *owner;
+  shcore::Synchronized_queue<Json_chunk> queue;
+  std::atomic<bool> cancelled{false};
+  std::atomic<bool> failed{false};
+  std::exception_ptr exception;
+  uint64_t chunks_in_flight = 0;
+  std::mutex mutex;
+  std::condition_variable chunk_done;
+};
+
 Json_importer::Json_importer(
     const std::shared_ptr<mysqlshdk::db::mysqlx::Session> &session)
     : m_session(session) {
@@ -253,7 +404,11 @@ void Json_importer::load_from(const shcore::Document_reader_options &options) {
     input.open(full_path);
   }
 
-  load_from(&input, options);
+  if (m_threads > 1) {
+    load_parallel(&input, options);
+  } else {
+    load_from(&input, options);
+  }
 }
 
 void Json_importer::load_from(shcore::Buffered_input *input,
@@ -294,6 +449,162 @@ void Json_importer::load_from(shcore::Buffered_input *input,
   if (cancel) throw shcore::cancelled("JSON documents import cancelled.");
 }
 
+void Json_importer::load_parallel(
+    shcore::Buffered_input *input,
+    const shcore::Document_reader_options &options) {
+  m_stats.items_processed = 0;
+  m_stats.bytes_processed = 0;
+
+  Parallel_state state{this};
+
+  // each worker inserts the documents using its own session, the first one
+  // reuses the session which was used to prepare the target
+  std::vector<Json_importer> workers;
+  workers.reserve(m_threads);
+
+  for (uint64_t i = 0; i < m_threads; ++i) {
+    auto session = m_session;
+
+    if (i > 0) {
+      session = mysqlshdk::db::mysqlx::Session::create();
+      session->connect(m_session->get_connection_options());
+    }
+
+    auto &worker = workers.emplace_back(session);
+    worker.m_batch_insert = m_batch_insert;
+    worker.m_parallel = &state;
+  }
+
+  shcore::Interrupt_handler intr_handler([&state]() -> bool {
+    state.cancel();
+    return false;
+  });
+
+  std::vector<std::thread> threads;
+  threads.reserve(m_threads);
+
+  for (auto &worker : workers) {
+    threads.emplace_back(
+        mysqlsh::spawn_scoped_thread([&worker, &options, &state]() {
+          try {
+            worker.load_chunks(options);
+          } catch (...) {
+            state.set_error(std::current_exception());
+          }
+        }));
+  }
+
+  // documents are only split here, they are parsed by the workers
+  try {
+    shcore::Json_reader reader(input, options);
+    reader.parse_bom();
+
+    Document_boundary_finder finder;
+    Json_chunk chunk;
+    // offset of the data which is going to be read next
+    auto offset = input->offset();
+
+    chunk.offset = offset;
+
+    const auto push_chunk = [&state, this](Json_chunk *c) {
+      state.wait_for_workers(2 * m_threads);
+
+      if (!state.stopped()) {
+        state.queue.push(std::move(*c));
+      } else {
+        state.finished_chunk();
+      }
+    };
+
+    while (!state.stopped()) {
+      input->peek();
+
+      if (input->eof()) break;
+
+      const auto begin = reinterpret_cast<const char *>(input->pos());
+      const auto end = reinterpret_cast<const char *>(input->end());
+      const auto boundary = finder.scan(begin, end);
+
+      if (boundary && chunk.data.size() + (boundary - begin) >= k_chunk_size) {
+        chunk.data.append(begin, boundary);
+        push_chunk(&chunk);
+
+        chunk = {};
+        chunk.offset = offset + (boundary - begin);
+        chunk.data.append(boundary, end);
+      } else {
+        chunk.data.append(begin, end);
+      }
+
+      offset += end - begin;
+      input->seek(input->end());
+    }
+
+    if (!chunk.data.empty() && !state.stopped()) {
+      push_chunk(&chunk);
+    }
+  } catch (...) {
+    state.set_error(std::current_exception());
+  }
+
+  state.queue.shutdown(m_threads);
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  for (const auto &worker : workers) {
+    m_stats.items_processed += worker.m_stats.items_processed;
+    m_stats.bytes_processed += worker.m_stats.bytes_processed;
+  }
+
+  if (state.exception) std::rethrow_exception(state.exception);
+
+  if (state.cancelled) {
+    throw shcore::cancelled("JSON documents import cancelled.");
+  }
+}
+
+void Json_importer::load_chunks(
+    const shcore::Document_reader_options &options) {
+  auto &state = *m_parallel;
+
+  m_packet_size_tracker.inserts_in_this_transaction = 0;
+  m_packet_size_tracker.crud_insert_overhead_bytes =
+      m_batch_insert.ByteSizeLong();
+
+  m_session->execute("START TRANSACTION");
+
+  while (true) {
+    auto chunk = state.queue.pop();
+
+    // empty chunk signals the end of input
+    if (chunk.data.empty()) break;
+
+    shcore::Buffered_input input;
+    input.open(chunk.data.data(), chunk.data.size(), chunk.offset);
+
+    shcore::Json_reader reader(&input, options);
+
+    while (!reader.eof() && !state.stopped()) {
+      std::string jd = reader.next();
+
+      if (!jd.empty()) {
+        put(std::move(jd));
+      }
+    }
+
+    state.finished_chunk();
+
+    if (state.stopped()) break;
+  }
+
+  // documents inserted so far are committed, just like in case of a
+  // sequential import which was interrupted
+  flush();
+  commit(true);
+}
+
 void Json_importer::put(const std::string &item) {
   if (m_packet_size_tracker.will_overflow(item.size())) {
     flush();
@@ -314,6 +625,11 @@ void Json_importer::update_statistics(xcl::XQuery_result *xquery_result) {
   uint64_t affected_rows = 0;
   bool ret = xquery_result->try_get_affected_rows(&affected_rows);
   if (ret) {
+    if (m_parallel) {
+      m_parallel->imported(affected_rows);
+      return;
+    }
+
     m_stats.documents_successfully_imported += affected_rows;
     if (m_print) {
       m_print(".. " + std::to_string(m_stats.documents_successfully_imported));
@@ -201,13 +201,26 @@ class Json_importer {
    * @param path Path to JSON document. Empty path enables read from stdin.
    */
   void set_path(const std::string &path) { m_file_path = path; }
+
+  /**
+   * Set number of threads (and sessions) used to import the documents.
+   * @param threads Number of threads, with 1 the documents are parsed and
+   *        inserted sequentially.
+   */
+  void set_threads(uint64_t threads) { m_threads = threads; }
+
   void load_from(const shcore::Document_reader_options &options);
 
   void print_stats();
 
  private:
+  struct Parallel_state;
+
   void load_from(shcore::Buffered_input *input,
                  const shcore::Document_reader_options &options);
+  void load_parallel(shcore::Buffered_input *input,
+                     const shcore::Document_reader_options &options);
+  void load_chunks(const shcore::Document_reader_options &options);
   void put(const std::string &item);
   void recv_response(bool block = false);
   void flush();
@@ -297,6 +310,10 @@ class Json_importer {
   } m_stats;
 
   std::string m_file_path;  //< Path to JSON document
+  uint64_t m_threads = 1;
+
+  // state shared by the workers of a parallel import, not owned
+  Parallel_state *m_parallel = nullptr;
 };
 
 }  // namespace mysqlsh
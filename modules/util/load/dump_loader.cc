@@ -2876,18 +2876,20 @@ bool Dump_loader::wait_for_more_data() {
         break;
       }
 
-      if (!waited) {
+      const auto interval = std::min(m_options.dump_poll_interval_ms(),
+                                     m_options.dump_wait_timeout_ms());
+
+      // short intervals are used when dump is produced concurrently by this
+      // process, waiting is expected there and would flood the console
+      if (!waited && m_options.dump_poll_interval_ms() >= 1000) {
         console->print_status("Waiting for more data to become available...");
       }
       waited = true;
-      if (m_options.dump_wait_timeout_ms() < 1000) {
-        shcore::sleep_ms(m_options.dump_wait_timeout_ms());
+      if (interval < 1000) {
+        shcore::sleep_ms(interval);
       } else {
-        // wait for at most 5s at a time and try again
-        for (uint64_t j = 0;
-             j < std::min<uint64_t>(5000, m_options.dump_wait_timeout_ms()) &&
-             !m_worker_interrupt;
-             j += 1000) {
+        // wait for at most the poll interval at a time and try again
+        for (uint64_t j = 0; j < interval && !m_worker_interrupt; j += 1000) {
           shcore::sleep_ms(1000);
         }
       }
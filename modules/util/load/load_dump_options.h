@@ -142,6 +142,10 @@ class Load_dump_options {
     return m_storage_config;
   }
 
+  void set_storage_config(const mysqlshdk::storage::Config_ptr &config) {
+    m_storage_config = config;
+  }
+
   bool show_progress() const { return m_show_progress; }
 
   uint64_t threads_count() const { return m_threads_count; }
@@ -154,6 +158,12 @@ class Load_dump_options {
 
   uint64_t dump_wait_timeout_ms() const { return m_wait_dump_timeout_ms; }
 
+  uint64_t dump_poll_interval_ms() const { return m_dump_poll_interval_ms; }
+
+  void set_dump_poll_interval_ms(uint64_t interval) {
+    m_dump_poll_interval_ms = interval;
+  }
+
   const std::string &character_set() const { return m_character_set; }
 
   bool load_data() const { return m_load_data; }
@@ -266,6 +276,7 @@ class Load_dump_options {
   dump::common::Filtering_options m_filtering_options;
 
   uint64_t m_wait_dump_timeout_ms = 0;
+  uint64_t m_dump_poll_interval_ms = 5000;
   bool m_reset_progress = false;
   std::optional<std::string> m_progress_file;
   std::string m_default_progress_file;
@@ -31,6 +31,8 @@
 #include <vector>
 #include "modules/mod_utils.h"
 #include "modules/mysqlxtest_utils.h"
+#include "modules/util/copy/copy.h"
+#include "modules/util/copy/copy_options.h"
 #include "modules/util/dump/dump_instance.h"
 #include "modules/util/dump/dump_instance_options.h"
 #include "modules/util/dump/dump_schemas.h"
@@ -85,6 +87,14 @@ Util::Util(shcore::IShell_core *owner)
   expose("exportTable", &Util::export_table, "table", "outputUrl", "?options")
       ->cli();
   expose("loadDump", &Util::load_dump, "url", "?options")->cli();
+  expose("copyInstance", &Util::copy_instance, "connectionData", "?options")
+      ->cli();
+  expose("copySchemas", &Util::copy_schemas, "schemas", "connectionData",
+         "?options")
+      ->cli();
+  expose("copyTables", &Util::copy_tables, "schema", "tables",
+         "connectionData", "?options")
+      ->cli();
 }
 
 REGISTER_HELP_FUNCTION(checkForServerUpgrade, util);
@@ -116,7 +126,13 @@ REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL4,
 REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL5,
               "@li password - password for connection.");
 
-REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL6, "${TOPIC_CONNECTION_DATA}");
+REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL6,
+              "@li threads - number of threads and sessions used to execute "
+              "the checks (default=1). If greater than 1, the checks and the "
+              "'CHECK TABLE x FOR UPGRADE' commands are executed in "
+              "parallel, output is printed once all of them finish.");
+
+REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL7, "${TOPIC_CONNECTION_DATA}");
 
 /**
  * \ingroup util
@@ -134,6 +150,7 @@ REGISTER_HELP(UTIL_CHECKFORSERVERUPGRADE_DETAIL6, "${TOPIC_CONNECTION_DATA}");
  * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL3)
  * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL4)
  * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL5)
+ * $(UTIL_CHECKFORSERVERUPGRADE_DETAIL6)
  *
  * \copydoc connection_options
  *
@@ -189,6 +206,9 @@ void Util::check_for_server_upgrade(
   Upgrade_check_config config{*options};
   config.set_session(session);
   config.set_user_privileges(privileges.get());
+  config.set_session_factory([co = session->get_connection_options()]() {
+    return establish_session(co, false);
+  });
 
   check_for_upgrade(config);
 }
@@ -233,50 +253,54 @@ REGISTER_HELP(UTIL_IMPORTJSON_DETAIL8,
               "field based on the ObjectID timestamp. Only valid if "
               "convertBsonOid is enabled.");
 REGISTER_HELP(UTIL_IMPORTJSON_DETAIL9,
+              "@li threads: int (default: 1) - use that many threads and "
+              "sessions to parse and insert the documents. If greater than 1, "
+              "documents are inserted in parallel, in no particular order.");
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL10,
               "The following options are valid only when convertBsonTypes is "
               "enabled. They are all boolean flags. ignoreRegexOptions is "
               "enabled by default, rest are disabled by default.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL10,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL11,
               "@li ignoreDate: disables conversion of BSON Date values");
 REGISTER_HELP(
-    UTIL_IMPORTJSON_DETAIL11,
+    UTIL_IMPORTJSON_DETAIL12,
     "@li ignoreTimestamp: disables conversion of BSON Timestamp values");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL12,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL13,
               "@li ignoreRegex: disables conversion of BSON Regex values.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL15,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL16,
               "@li ignoreRegexOptions: causes regex options to be ignored when "
               "processing a Regex BSON value. This option is only valid if "
               "ignoreRegex is disabled.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL13,
-              "@li ignoreBinary: disables conversion of BSON BinData values.");
 REGISTER_HELP(UTIL_IMPORTJSON_DETAIL14,
+              "@li ignoreBinary: disables conversion of BSON BinData values.");
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL15,
               "@li decimalAsDouble: causes BSON Decimal values to be imported "
               "as double values.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL16,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL17,
               "If the schema is not provided, an active schema on the global "
               "session, if set, will be used.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL17,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL18,
               "The collection and the table options cannot be combined. If "
               "they are not provided, the basename of the file without "
               "extension will be used as target collection name.");
 
 REGISTER_HELP(
-    UTIL_IMPORTJSON_DETAIL18,
+    UTIL_IMPORTJSON_DETAIL19,
     "If the target collection or table does not exist, they are created, "
     "otherwise the data is inserted into the existing collection or table.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL19,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL20,
               "The tableColumn implies the use of the table option and cannot "
               "be combined "
               "with the collection option.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL20, "<b>BSON Data Type Processing.</b>");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL21,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL21, "<b>BSON Data Type Processing.</b>");
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL22,
               "If only convertBsonOid is enabled, no conversion will be done "
               "on the rest of the BSON Data Types.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL22,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL23,
               "To use extractOidTime, it should be set to a name which will "
               "be used to insert an additional field into the main document. "
               "The value of the new field will be the timestamp obtained from "
@@ -284,12 +308,12 @@ REGISTER_HELP(UTIL_IMPORTJSON_DETAIL22,
               "ObjectID value associated to the '_id' field of the main "
               "document.");
 REGISTER_HELP(
-    UTIL_IMPORTJSON_DETAIL23,
+    UTIL_IMPORTJSON_DETAIL24,
     "NumberLong and NumberInt values will be converted to integer values.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL24,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL25,
               "NumberDecimal values are imported as strings, unless "
               "decimalAsDouble is enabled.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL25,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL26,
               "Regex values will be converted to strings containing the "
               "regular expression. The regular expression options are ignored "
               "unless ignoreRegexOptions is disabled. When ignoreRegexOptions "
@@ -327,6 +351,7 @@ const shcore::Option_pack_def<Import_json_options>
           .optional("collection", &Import_json_options::collection)
           .optional("table", &Import_json_options::table)
           .optional("tableColumn", &Import_json_options::table_column)
+          .optional("threads", &Import_json_options::threads)
           .include(&Import_json_options::doc_reader);
 
   return opts;
@@ -350,15 +375,14 @@ const shcore::Option_pack_def<Import_json_options>
  * $(UTIL_IMPORTJSON_DETAIL6)
  * $(UTIL_IMPORTJSON_DETAIL7)
  * $(UTIL_IMPORTJSON_DETAIL8)
- *
  * $(UTIL_IMPORTJSON_DETAIL9)
+ *
  * $(UTIL_IMPORTJSON_DETAIL10)
  * $(UTIL_IMPORTJSON_DETAIL11)
  * $(UTIL_IMPORTJSON_DETAIL12)
  * $(UTIL_IMPORTJSON_DETAIL13)
  * $(UTIL_IMPORTJSON_DETAIL14)
  * $(UTIL_IMPORTJSON_DETAIL15)
- *
  * $(UTIL_IMPORTJSON_DETAIL16)
  *
  * $(UTIL_IMPORTJSON_DETAIL17)
@@ -379,6 +403,8 @@ const shcore::Option_pack_def<Import_json_options>
  *
  * $(UTIL_IMPORTJSON_DETAIL25)
  *
+ * $(UTIL_IMPORTJSON_DETAIL26)
+ *
  * $(UTIL_IMPORTJSON_THROWS)
  * $(UTIL_IMPORTJSON_THROWS1)
  * $(UTIL_IMPORTJSON_THROWS2)
@@ -459,6 +485,11 @@ void Util::import_json(
     prepare.collection(options->collection);
   }
 
+  if (0 == options->threads) {
+    throw std::invalid_argument(
+        "The value of 'threads' option must be greater than 0.");
+  }
+
   // Validate provided parameters and build Json_importer object.
   auto importer = prepare.build();
 
@@ -471,6 +502,7 @@ void Util::import_json(
   importer.set_print_callback([](const std::string &msg) -> void {
     mysqlsh::current_console()->print(msg);
   });
+  importer.set_threads(options->threads);
 
   try {
     importer.load_from(options->doc_reader);
@@ -1504,17 +1536,33 @@ backup lock cannot not be acquired.
 @li <b>dataOnly</b>: bool (default: false) - Only dump data from the database.
 @li <b>dryRun</b>: bool (default: false) - Print information about what would be
 dumped, but do not dump anything.
+@li <b>metadataCache</b>: string (default: not set) - Path to a local file used
+to cache the metadata of the dumped tables and views between the dumps. If this
+file exists, columns and indexes of the schemas which did not change since it
+was written are not fetched from the server. The file is updated once the
+metadata is fetched.
 
 @li <b>chunking</b>: bool (default: true) - Enable chunking of the tables.
 @li <b>bytesPerChunk</b>: string (default: "64M") - Sets average estimated
 number of bytes to be written to each chunk file, enables <b>chunking</b>.
+@li <b>adaptiveChunking</b>: bool (default: false) - Adjust chunks of the
+tables while they are being dumped, using the measured throughput. Chunks which
+take too long to be dumped are split and handed over to the idle threads.
+Requires <b>chunking</b>.
 @li <b>threads</b>: int (default: 4) - Use N threads to dump data chunks from
 the server.
+@li <b>clientSideEncoding</b>: bool (default: false) - Fetch the values of
+columns with data types which are not safe to be stored in text form (i.e. BLOB)
+as is and encode them in the Shell, instead of on the server. Reduces the load
+of the server and the amount of data transferred over the network.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_DDL_COMPRESSION, R"*(
 @li <b>compression</b>: string (default: "zstd") - Compression used when writing
-the data dump files, one of: "none", "gzip", "zstd".
+the data dump files, one of: "none", "gzip", "lz4", "zstd".
+@li <b>compressionThreads</b>: int (default: 0) - Use N threads to compress the
+data dump files, shared by all dump threads. If set to 0, data is compressed by
+the dump threads. Can only be used with "zstd" or "gzip" compression.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_MDS_COMMON_OPTIONS, R"*(
@@ -1737,7 +1785,7 @@ partition names used to limit the data export to just the specified partitions.
 
 ${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
 @li <b>compression</b>: string (default: "none") - Compression used when writing
-the data dump files, one of: "none", "gzip", "zstd".
+the data dump files, one of: "none", "gzip", "lz4", "zstd".
 
 ${TOPIC_UTIL_DUMP_OCI_COMMON_OPTIONS}
 
@@ -2108,4 +2156,335 @@ void Util::dump_instance(
   Dump_instance{opts}.run();
 }
 
+REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_COPY_COMMON_PARAMETERS, R"*(
+The <b>connectionData</b> specifies the target instance, the data is copied
+from the instance the global Shell session is connected to. Data is streamed
+directly between the instances, it is not written to any intermediate storage.
+)*");
+
+REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_COPY_COMMON_OPTIONS, R"*(
+@li <b>compression</b>: string (default: "none") - Compression used when
+transferring the data between the instances, one of: "none", "gzip", "lz4",
+"zstd".
+
+@li <b>analyzeTables</b>: "off", "on", "histogram" (default: off) - If 'on',
+executes ANALYZE TABLE for all tables, once copied. If set to 'histogram', only
+tables that have histogram information stored in the source instance will be
+analyzed.
+@li <b>deferTableIndexes</b>: "off", "fulltext", "all" (default: fulltext) -
+If "all", creation of "all" indexes except PRIMARY is deferred until after table
+data is loaded, which in many cases can reduce load times. If "fulltext", only
+full-text indexes will be deferred.
+@li <b>handleGrantErrors</b>: "abort", "drop_account", "ignore" (default:
+abort) - Specifies action to be performed in case of errors related to the
+GRANT/REVOKE statements, "abort": throws an error and aborts the copy,
+"drop_account": deletes the problematic account and continues, "ignore":
+ignores the error and continues copying the account.
+@li <b>ignoreExistingObjects</b>: bool (default false) - Perform the copy even
+if it contains objects that already exist in the target database.
+@li <b>ignoreVersion</b>: bool (default false) - Perform the copy even if the
+major version number of the source instance does not match that of the target
+instance.
+@li <b>loadIndexes</b>: bool (default: true) - use together with
+<b>deferTableIndexes</b> to control whether secondary indexes should be
+recreated at the end of the copy.
+@li <b>maxBytesPerTransaction</b>: string (default: the value of
+<b>bytesPerChunk</b>) - Specifies the maximum number of bytes that can be
+loaded from a chunk in a single LOAD DATA statement.
+@li <b>schema</b>: string (default not set) - Copy the data into the given
+target schema. This option can only be used when copying just one schema.
+@li <b>sessionInitSql</b>: list of strings (default: []) - execute the given
+list of SQL statements in each session of the target instance about to load
+data.
+@li <b>skipBinlog</b>: bool (default: false) - Disables the binary log for the
+MySQL sessions used by the loader (set sql_log_bin=0).
+@li <b>updateGtidSet</b>: "off", "replace", "append" (default: off) - if set to
+a value other than 'off' updates GTID_PURGED by either replacing its contents
+or appending to it the gtid set of the source instance.
+)*");
+
+REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_COPY_COMMON_DETAILS, R"*(
+<b>Details</b>
+
+The data is dumped from the source instance in the same way as by the
+corresponding dump utility, and loaded into the target instance in the same way
+as by the <<<loadDump>>>() utility, but the files are exchanged in memory. The
+amount of memory used to hold the data files, including the ones which are
+still being dumped, is limited to <b>threads</b> * <b>bytesPerChunk</b> * 2
+bytes, once this limit is reached, the source instance is read only as fast as
+the target instance is able to load the data. If a single data file does not
+fit within this limit, it is held in memory until it's loaded, and no other
+data is dumped in the meantime. Metadata and DDL files are not subject to this
+limit. If the <b>chunking</b> option is disabled, data of each table is still
+split into multiple files, each holding roughly <b>bytesPerChunk</b> bytes.
+
+The same number of <b>threads</b> is used to dump and to load the data. The
+progress of the operation is reported by the loader.
+
+If the <b>dryRun</b> option is enabled, only the metadata and DDL are dumped,
+without acquiring any locks, and the loader checks them against the target
+instance (i.e. for duplicate objects) without loading anything.
+
+The copy cannot be resumed if it is interrupted, and the options which specify
+the storage of the dump (i.e. <b>osBucketName</b>) cannot be used.
+
+${TOPIC_UTIL_DUMP_SESSION_DETAILS}
+
+The target instance needs to have the <b>local_infile</b> system variable
+enabled.
+)*");
+
+REGISTER_HELP_FUNCTION(copyInstance, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_COPYINSTANCE, R"*(
+Copies a source instance to the target instance.
+
+@param connectionData Specifies the connection information required to
+establish a connection to the target instance.
+@param options Optional dictionary with the copy options.
+
+${TOPIC_UTIL_COPY_COMMON_PARAMETERS}
+
+<b>The following options are supported:</b>
+@li <b>excludeSchemas</b>: list of strings (default: empty) - List of schemas to
+be excluded from the copy.
+@li <b>includeSchemas</b>: list of strings (default: empty) - List of schemas to
+be included in the copy.
+${TOPIC_UTIL_DUMP_SCHEMAS_COMMON_OPTIONS}
+@li <b>users</b>: bool (default: true) - Include users, roles and grants in the
+copy.
+@li <b>excludeUsers</b>: array of strings (default not set) - Skip copying the
+specified users. Each user is in the format of 'user_name'[@'host']. If the host
+is not specified, all the accounts with the given user name are excluded.
+@li <b>includeUsers</b>: array of strings (default not set) - Copy only the
+specified users. Each user is in the format of 'user_name'[@'host']. If the host
+is not specified, all the accounts with the given user name are included. By
+default, all users are included.
+
+${TOPIC_UTIL_DUMP_DDL_COMMON_OPTIONS}
+${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
+${TOPIC_UTIL_COPY_COMMON_OPTIONS}
+
+${TOPIC_UTIL_DUMP_DDL_COMMON_REQUIREMENTS}
+
+${TOPIC_UTIL_COPY_COMMON_DETAILS}
+
+The following schemas are not copied:
+@li information_schema,
+@li mysql,
+@li ndbinfo,
+@li performance_schema,
+@li sys.
+
+<b>Options</b>
+
+${TOPIC_UTIL_DUMP_DDL_COMMON_OPTION_DETAILS}
+${TOPIC_UTIL_DUMP_COMPATIBILITY_OPTION}
+
+@throws ArgumentError in the following scenarios:
+@li If any of the input arguments contains an invalid value.
+
+@throws RuntimeError in the following scenarios:
+@li If there is no open global session.
+@li If connecting to the target instance fails.
+@li If dumping the data from the source instance fails.
+@li If loading the data into the target instance fails.
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_COPYINSTANCE_BRIEF)
+ *
+ * $(UTIL_COPYINSTANCE)
+ */
+#if DOXYGEN_JS
+Undefined Util::copyInstance(ConnectionData connectionData,
+                             Dictionary options);
+#elif DOXYGEN_PY
+None Util::copy_instance(ConnectionData connectionData, dict options);
+#endif
+void Util::copy_instance(
+    const mysqlshdk::db::Connection_options &connection_options,
+    const shcore::Option_pack_ref<copy::Copy_instance_options> &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  Scoped_log_sql log_sql{log_sql_for_dump_and_load()};
+  shcore::Log_sql_guard log_sql_context{"util.copyInstance()"};
+
+  copy::Copy_instance_options opts = *options;
+  opts.set_output_url("");
+  opts.set_session(session->get_core_session());
+
+  const auto target = establish_session(connection_options,
+                                        current_shell_options()->get().wizards);
+
+  copy::copy_instance(target, &opts);
+}
+
+REGISTER_HELP_FUNCTION(copySchemas, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_COPYSCHEMAS, R"*(
+Copies schemas from the source instance to the target instance.
+
+@param schemas List of schemas to be copied.
+@param connectionData Specifies the connection information required to
+establish a connection to the target instance.
+@param options Optional dictionary with the copy options.
+
+The <b>schemas</b> parameter cannot be an empty list.
+
+${TOPIC_UTIL_COPY_COMMON_PARAMETERS}
+
+<b>The following options are supported:</b>
+${TOPIC_UTIL_DUMP_SCHEMAS_COMMON_OPTIONS}
+${TOPIC_UTIL_DUMP_DDL_COMMON_OPTIONS}
+${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
+${TOPIC_UTIL_COPY_COMMON_OPTIONS}
+
+${TOPIC_UTIL_DUMP_DDL_COMMON_REQUIREMENTS}
+
+${TOPIC_UTIL_COPY_COMMON_DETAILS}
+
+<b>Options</b>
+
+${TOPIC_UTIL_DUMP_DDL_COMMON_OPTION_DETAILS}
+${TOPIC_UTIL_DUMP_COMPATIBILITY_OPTION}
+
+@throws ArgumentError in the following scenarios:
+@li If any of the input arguments contains an invalid value.
+
+@throws RuntimeError in the following scenarios:
+@li If there is no open global session.
+@li If connecting to the target instance fails.
+@li If dumping the data from the source instance fails.
+@li If loading the data into the target instance fails.
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_COPYSCHEMAS_BRIEF)
+ *
+ * $(UTIL_COPYSCHEMAS)
+ */
+#if DOXYGEN_JS
+Undefined Util::copySchemas(List schemas, ConnectionData connectionData,
+                            Dictionary options);
+#elif DOXYGEN_PY
+None Util::copy_schemas(list schemas, ConnectionData connectionData,
+                        dict options);
+#endif
+void Util::copy_schemas(
+    const std::vector<std::string> &schemas,
+    const mysqlshdk::db::Connection_options &connection_options,
+    const shcore::Option_pack_ref<copy::Copy_schemas_options> &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  Scoped_log_sql log_sql{log_sql_for_dump_and_load()};
+  shcore::Log_sql_guard log_sql_context{"util.copySchemas()"};
+
+  copy::Copy_schemas_options opts = *options;
+  opts.set_schemas(schemas);
+  opts.set_output_url("");
+  opts.set_session(session->get_core_session());
+
+  const auto target = establish_session(connection_options,
+                                        current_shell_options()->get().wizards);
+
+  copy::copy_schemas(target, &opts);
+}
+
+REGISTER_HELP_FUNCTION(copyTables, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_COPYTABLES, R"*(
+Copies tables and views from schema in the source instance to the target
+instance.
+
+@param schema Name of the schema that contains tables and views to be copied.
+@param tables List of tables and views to be copied.
+@param connectionData Specifies the connection information required to
+establish a connection to the target instance.
+@param options Optional dictionary with the copy options.
+
+${TOPIC_UTIL_COPY_COMMON_PARAMETERS}
+
+<b>The following options are supported:</b>
+@li <b>all</b>: bool (default: false) - Copy all views and tables from the
+specified schema, requires the <b>tables</b> argument to be an empty list.
+${TOPIC_UTIL_DUMP_DDL_COMMON_OPTIONS}
+${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
+${TOPIC_UTIL_COPY_COMMON_OPTIONS}
+
+${TOPIC_UTIL_DUMP_DDL_COMMON_REQUIREMENTS}
+
+${TOPIC_UTIL_COPY_COMMON_DETAILS}
+
+<b>Options</b>
+
+If the <b>all</b> option is set to true and the <b>tables</b> parameter is set
+to an empty array, all views and tables from the specified schema are copied.
+If the <b>all</b> option is set to true and the <b>tables</b> parameter is not
+set to an empty array, an exception is thrown.
+
+${TOPIC_UTIL_DUMP_DDL_COMMON_OPTION_DETAILS}
+${TOPIC_UTIL_DUMP_COMPATIBILITY_OPTION}
+
+@throws ArgumentError in the following scenarios:
+@li If any of the input arguments contains an invalid value.
+
+@throws RuntimeError in the following scenarios:
+@li If there is no open global session.
+@li If connecting to the target instance fails.
+@li If dumping the data from the source instance fails.
+@li If loading the data into the target instance fails.
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_COPYTABLES_BRIEF)
+ *
+ * $(UTIL_COPYTABLES)
+ */
+#if DOXYGEN_JS
+Undefined Util::copyTables(String schema, List tables,
+                           ConnectionData connectionData, Dictionary options);
+#elif DOXYGEN_PY
+None Util::copy_tables(str schema, list tables, ConnectionData connectionData,
+                       dict options);
+#endif
+void Util::copy_tables(
+    const std::string &schema, const std::vector<std::string> &tables,
+    const mysqlshdk::db::Connection_options &connection_options,
+    const shcore::Option_pack_ref<copy::Copy_tables_options> &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  Scoped_log_sql log_sql{log_sql_for_dump_and_load()};
+  shcore::Log_sql_guard log_sql_context{"util.copyTables()"};
+
+  copy::Copy_tables_options opts = *options;
+  opts.set_schema(schema);
+  opts.set_tables(tables);
+  opts.set_output_url("");
+  opts.set_session(session->get_core_session());
+
+  const auto target = establish_session(connection_options,
+                                        current_shell_options()->get().wizards);
+
+  copy::copy_tables(target, &opts);
+}
+
 }  // namespace mysqlsh
@@ -25,7 +25,10 @@
 
 #include <algorithm>
 #include <array>
+#include <condition_variable>
+#include <iterator>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -35,9 +38,11 @@
 #include "modules/util/upgrade_check_formatter.h"
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/libs/config/config_file.h"
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/parser/mysql_parser_utils.h"
+#include "mysqlshdk/libs/utils/threads.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
@@ -92,7 +97,8 @@ const shcore::Option_pack_def<Upgrade_check_options>
           .optional("configPath", &Upgrade_check_options::config_path)
           .optional("password", &Upgrade_check_options::password, "",
                     shcore::Option_extract_mode::CASE_SENSITIVE,
-                    shcore::Option_scope::CLI_DISABLED);
+                    shcore::Option_scope::CLI_DISABLED)
+          .optional("threads", &Upgrade_check_options::set_threads);
 
   return opts;
 }
@@ -103,6 +109,15 @@ void Upgrade_check_options::set_target_version(const std::string &value) {
   }
 }
 
+void Upgrade_check_options::set_threads(uint64_t value) {
+  if (0 == value) {
+    throw std::invalid_argument(
+        "The value of 'threads' option must be greater than 0.");
+  }
+
+  threads = value;
+}
+
 Upgrade_check::Collection Upgrade_check::s_available_checks;
 
 std::vector<std::unique_ptr<Upgrade_check>> Upgrade_check::create_checklist(
@@ -1536,6 +1551,21 @@ Check_table_command::Check_table_command()
 std::vector<Upgrade_issue> Check_table_command::run(
     const std::shared_ptr<mysqlshdk::db::ISession> &session,
     const Upgrade_info &server_info) {
+  std::vector<Upgrade_issue> issues;
+
+  for (const auto &pair : list_tables(session, server_info)) {
+    auto table_issues = check_table(session, pair.first, pair.second);
+    std::move(table_issues.begin(), table_issues.end(),
+              std::back_inserter(issues));
+  }
+
+  return issues;
+}
+
+std::vector<std::pair<std::string, std::string>>
+Check_table_command::list_tables(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    const Upgrade_info &server_info) {
   // Needed for warnings related to triggers, incompatible types in 5.7
   if (server_info.server_version < Version(8, 0, 0))
     session->execute("FLUSH LOCAL TABLES;");
@@ -1553,34 +1583,38 @@ std::vector<Upgrade_issue> Check_table_command::run(
     }
   }
 
+  return tables;
+}
+
+std::vector<Upgrade_issue> Check_table_command::check_table(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    const std::string &schema, const std::string &table) {
   std::vector<Upgrade_issue> issues;
-  for (const auto &pair : tables) {
-    const auto query = shcore::sqlstring("CHECK TABLE !.! FOR UPGRADE;", 0)
-                       << pair.first << pair.second;
-    auto check_result = session->query(query.str_view());
-    const mysqlshdk::db::IRow *row = nullptr;
-    while ((row = check_result->fetch_one()) != nullptr) {
-      if (row->get_string(2) == "status") continue;
-      Upgrade_issue issue;
-      std::string type = row->get_string(2);
-      if (type == "warning")
-        issue.level = Upgrade_issue::WARNING;
-      else if (type == "error")
-        issue.level = Upgrade_issue::ERROR;
-      else
-        issue.level = Upgrade_issue::NOTICE;
-      issue.schema = pair.first;
-      issue.table = pair.second;
-      issue.description = row->get_string(3);
-
-      // Native partitioning warning has been promoted to error in context of
-      // upgrade to 8.0 and is handled by the separate check
-      if (issue.description.find("use native partitioning instead.") !=
-              std::string::npos &&
-          issue.level == Upgrade_issue::WARNING)
-        continue;
-      issues.push_back(issue);
-    }
+  const auto query = shcore::sqlstring("CHECK TABLE !.! FOR UPGRADE;", 0)
+                     << schema << table;
+  auto check_result = session->query(query.str_view());
+  const mysqlshdk::db::IRow *row = nullptr;
+  while ((row = check_result->fetch_one()) != nullptr) {
+    if (row->get_string(2) == "status") continue;
+    Upgrade_issue issue;
+    std::string type = row->get_string(2);
+    if (type == "warning")
+      issue.level = Upgrade_issue::WARNING;
+    else if (type == "error")
+      issue.level = Upgrade_issue::ERROR;
+    else
+      issue.level = Upgrade_issue::NOTICE;
+    issue.schema = schema;
+    issue.table = table;
+    issue.description = row->get_string(3);
+
+    // Native partitioning warning has been promoted to error in context of
+    // upgrade to 8.0 and is handled by the separate check
+    if (issue.description.find("use native partitioning instead.") !=
+            std::string::npos &&
+        issue.level == Upgrade_issue::WARNING)
+      continue;
+    issues.push_back(issue);
   }
 
   return issues;
@@ -1957,7 +1991,7 @@ bool UNUSED_VARIABLE(register_get_invalid_engine_foreign_key_check) =
 }
 
 Upgrade_check_config::Upgrade_check_config(const Upgrade_check_options &options)
-    : m_output_format(options.output_format) {
+    : m_threads(options.threads), m_output_format(options.output_format) {
   m_upgrade_info.target_version = options.target_version;
   m_upgrade_info.config_path = options.config_path;
 
@@ -2010,6 +2044,174 @@ std::vector<Upgrade_issue> Upgrade_check_config::filter_issues(
   }
 }
 
+namespace {
+
+struct Check_result {
+  std::vector<Upgrade_issue> issues;
+  std::optional<std::string> error;
+  bool runtime_error = true;
+};
+
+Check_result run_check(
+    const std::function<std::vector<Upgrade_issue>()> &check,
+    const Upgrade_check_config &config) {
+  Check_result result;
+
+  try {
+    result.issues = config.filter_issues(check());
+  } catch (const Upgrade_check::Check_configuration_error &e) {
+    result.error = e.what();
+    result.runtime_error = false;
+  } catch (const std::exception &e) {
+    result.error = e.what();
+  }
+
+  return result;
+}
+
+/**
+ * Sessions shared by the threads which execute the checks, additional sessions
+ * are opened on demand. If a session cannot be opened, threads wait for the
+ * ones which are already opened.
+ */
+class Session_pool final {
+ public:
+  Session_pool(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+               const Upgrade_check_config::Session_factory &factory)
+      : m_factory(factory) {
+    m_idle.emplace_back(session);
+  }
+
+  std::shared_ptr<mysqlshdk::db::ISession> acquire() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_idle.empty() && !m_factory_failed) {
+      lock.unlock();
+
+      try {
+        auto session = m_factory();
+        // see check_for_upgrade()
+        session->execute("USE mysql;");
+        return session;
+      } catch (const std::exception &e) {
+        log_warning("Unable to open an additional session: %s", e.what());
+        lock.lock();
+        m_factory_failed = true;
+      }
+    }
+
+    m_session_released.wait(lock, [this]() { return !m_idle.empty(); });
+
+    auto session = std::move(m_idle.back());
+    m_idle.pop_back();
+
+    return session;
+  }
+
+  void release(std::shared_ptr<mysqlshdk::db::ISession> session) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_idle.emplace_back(std::move(session));
+    }
+
+    m_session_released.notify_one();
+  }
+
+ private:
+  Upgrade_check_config::Session_factory m_factory;
+  std::mutex m_mutex;
+  std::condition_variable m_session_released;
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> m_idle;
+  bool m_factory_failed = false;
+};
+
+/**
+ * Executes the runnable checks using multiple threads. Check tables command is
+ * split into separate tasks for each of the tables. Results are returned in
+ * the order of the checklist.
+ */
+std::vector<Check_result> run_checks_in_parallel(
+    const std::vector<std::unique_ptr<Upgrade_check>> &checklist,
+    const Upgrade_check_config &config) {
+  struct Task {
+    std::size_t check;
+    // set if this task checks a single table
+    const std::pair<std::string, std::string> *table = nullptr;
+    Check_result result;
+  };
+
+  const auto &session = config.session();
+  const auto &info = config.upgrade_info();
+  std::vector<Check_result> results(checklist.size());
+  std::vector<std::vector<std::pair<std::string, std::string>>> tables(
+      checklist.size());
+  std::vector<Task> tasks;
+
+  for (std::size_t i = 0; i < checklist.size(); ++i) {
+    const auto &check = checklist[i];
+
+    if (!check->is_runnable()) continue;
+
+    if (dynamic_cast<Check_table_command *>(check.get())) {
+      // tables are listed upfront, so that they can be checked in parallel
+      results[i] = run_check(
+          [&]() {
+            tables[i] = Check_table_command::list_tables(session, info);
+            return std::vector<Upgrade_issue>{};
+          },
+          config);
+
+      if (!results[i].error) {
+        for (const auto &table : tables[i]) {
+          tasks.emplace_back(Task{i, &table, {}});
+        }
+      }
+    } else {
+      tasks.emplace_back(Task{i, nullptr, {}});
+    }
+  }
+
+  Session_pool pool{session, config.session_factory()};
+
+  mysqlshdk::utils::parallel_for(
+      tasks.size(), config.threads(), [&](std::size_t i) {
+        mysqlsh::Mysql_thread mysql_thread;
+        auto &task = tasks[i];
+        auto s = pool.acquire();
+
+        task.result = run_check(
+            [&]() {
+              return task.table
+                         ? Check_table_command::check_table(
+                               s, task.table->first, task.table->second)
+                         : checklist[task.check]->run(s, info);
+            },
+            config);
+
+        pool.release(std::move(s));
+      });
+
+  // tasks of a single check are consecutive, report the first error of a
+  // check in the same way as if the tables were checked serially
+  for (auto &task : tasks) {
+    auto &result = results[task.check];
+
+    if (result.error) continue;
+
+    if (task.result.error) {
+      result = std::move(task.result);
+      result.issues.clear();
+    } else {
+      std::move(task.result.issues.begin(), task.result.issues.end(),
+                std::back_inserter(result.issues));
+    }
+  }
+
+  return results;
+}
+
+}  // namespace
+
 bool check_for_upgrade(const Upgrade_check_config &config) {
   if (config.user_privileges()) {
     if (config.user_privileges()
@@ -2054,22 +2256,45 @@ bool check_for_upgrade(const Upgrade_check_config &config) {
   // to 5.7.39
   config.session()->execute("USE mysql;");
 
-  for (const auto &check : checklist)
-    if (check->is_runnable()) {
-      try {
-        const auto issues = config.filter_issues(
-            check->run(config.session(), config.upgrade_info()));
-        for (const auto &issue : issues) update_counts(issue.level);
-        print->check_results(*check, issues);
-      } catch (const Upgrade_check::Check_configuration_error &e) {
-        print->check_error(*check, e.what(), false);
-      } catch (const std::exception &e) {
-        print->check_error(*check, e.what());
-      }
+  const auto report = [&](const Upgrade_check &check,
+                          const Check_result &result) {
+    if (result.error) {
+      print->check_error(check, result.error->c_str(), result.runtime_error);
     } else {
-      update_counts(check->get_level());
-      print->manual_check(*check);
+      for (const auto &issue : result.issues) update_counts(issue.level);
+      print->check_results(check, result.issues);
     }
+  };
+
+  if (config.threads() > 1 && config.session_factory()) {
+    // checks are executed in parallel, output is printed once all of them
+    // finish, in the same order as when they are executed serially
+    const auto results = run_checks_in_parallel(checklist, config);
+
+    for (std::size_t i = 0; i < checklist.size(); ++i) {
+      const auto &check = checklist[i];
+
+      if (check->is_runnable()) {
+        report(*check, results[i]);
+      } else {
+        update_counts(check->get_level());
+        print->manual_check(*check);
+      }
+    }
+  } else {
+    for (const auto &check : checklist)
+      if (check->is_runnable()) {
+        report(*check, run_check(
+                           [&]() {
+                             return check->run(config.session(),
+                                               config.upgrade_info());
+                           },
+                           config));
+      } else {
+        update_counts(check->get_level());
+        print->manual_check(*check);
+      }
+  }
 
   std::string summary;
   if (errors > 0) {
@@ -73,9 +73,11 @@ struct Upgrade_check_options {
   std::string config_path;
   std::string output_format;
   std::optional<std::string> password;
+  uint64_t threads = 1;
 
  private:
   void set_target_version(const std::string &value);
+  void set_threads(uint64_t value);
 };
 
 std::string upgrade_issue_to_string(const Upgrade_issue &problem);
@@ -296,6 +298,20 @@ class Check_table_command : public Upgrade_check {
     throw std::runtime_error("Unimplemented");
   }
 
+  /**
+   * Lists the tables which are going to be checked, as (schema, table) pairs.
+   */
+  static std::vector<std::pair<std::string, std::string>> list_tables(
+      const std::shared_ptr<mysqlshdk::db::ISession> &session,
+      const Upgrade_info &server_info);
+
+  /**
+   * Runs the 'CHECK TABLE x FOR UPGRADE' command for a single table.
+   */
+  static std::vector<Upgrade_issue> check_table(
+      const std::shared_ptr<mysqlshdk::db::ISession> &session,
+      const std::string &schema, const std::string &table);
+
  protected:
   const char *get_description_internal() const override { return nullptr; }
 
@@ -329,6 +345,8 @@ class Manual_check : public Upgrade_check {
 class Upgrade_check_config final {
  public:
   using Include_issue = std::function<bool(const Upgrade_issue &)>;
+  using Session_factory =
+      std::function<std::shared_ptr<mysqlshdk::db::ISession>()>;
 
   explicit Upgrade_check_config(const Upgrade_check_options &options);
 
@@ -342,6 +360,18 @@ class Upgrade_check_config final {
     return m_session;
   }
 
+  /**
+   * Sets the function used to open additional sessions to the checked server,
+   * checks are executed in parallel only if it is set.
+   */
+  void set_session_factory(const Session_factory &factory) {
+    m_session_factory = factory;
+  }
+
+  const Session_factory &session_factory() const { return m_session_factory; }
+
+  uint64_t threads() const { return m_threads; }
+
   std::unique_ptr<Upgrade_check_output_formatter> formatter() const;
 
   void set_user_privileges(
@@ -367,6 +397,8 @@ class Upgrade_check_config final {
  private:
   Upgrade_check::Upgrade_info m_upgrade_info;
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
+  Session_factory m_session_factory;
+  uint64_t m_threads;
   std::string m_output_format;
   const mysqlshdk::mysql::User_privileges *m_privileges;
   Include_issue m_filter;
@@ -990,6 +990,23 @@ class SHCORE_PUBLIC Object_bridge {
 
   //! Calls the named method with the given args
   virtual Value call(const std::string &name, const Argument_list &args) = 0;
+
+  //! Read-only contiguous memory exposed by an object
+  struct Buffer {
+    const void *data = nullptr;
+    //! Number of items
+    size_t length = 0;
+    size_t item_size = 1;
+    //! Format of an item, using the syntax of the Python's struct module
+    const char *format = "B";
+  };
+
+  //! Returns true if the object exposes a contiguous memory
+  virtual bool is_buffer() const { return false; }
+
+  //! Returns the memory exposed by the object, it has to remain valid and
+  // unchanged as long as the object exists
+  virtual Buffer buffer() const { return {}; }
 };
 
 class SHCORE_PUBLIC Function_base {
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/column_buffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+inline size_t validity_size(size_t rows) { return (rows + 7) / 8; }
+
+/**
+ * Maximum number of rows memory is reserved for up front.
+ */
+constexpr size_t k_max_reserved_rows = 64 * 1024;
+
+}  // namespace
+
+Column_buffer::Column_buffer(Type type)
+    : m_type(type), m_layout(layout(type)) {
+  if (Layout::Binary == m_layout) {
+    m_offsets.emplace_back(0);
+  }
+}
+
+Column_buffer::Layout Column_buffer::layout(Type type) {
+  switch (type) {
+    case Type::Integer:
+      return Layout::Int64;
+
+    case Type::UInteger:
+    case Type::Bit:
+      return Layout::UInt64;
+
+    case Type::Float:
+    case Type::Double:
+      return Layout::Double;
+
+    default:
+      return Layout::Binary;
+  }
+}
+
+void Column_buffer::reserve(size_t rows) {
+  m_validity.reserve(validity_size(rows));
+
+  if (Layout::Binary == m_layout) {
+    m_offsets.reserve(rows + 1);
+  } else {
+    m_data.reserve(rows * sizeof(uint64_t));
+  }
+}
+
+void Column_buffer::append(const IRow &row, uint32_t field) {
+  if (Type::Null == m_type || row.is_null(field)) {
+    append_null();
+    return;
+  }
+
+  switch (m_type) {
+    case Type::Integer:
+      append_fixed(row.get_int(field));
+      break;
+
+    case Type::UInteger:
+      append_fixed(row.get_uint(field));
+      break;
+
+    case Type::Bit:
+      append_fixed(std::get<0>(row.get_bit(field)));
+      break;
+
+    case Type::Float:
+      append_fixed(static_cast<double>(row.get_float(field)));
+      break;
+
+    case Type::Double:
+      append_fixed(row.get_double(field));
+      break;
+
+    case Type::String:
+    case Type::Bytes: {
+      const auto s = row.get_string_data(field);
+      append_binary({s.first, s.second});
+      break;
+    }
+
+    case Type::Decimal:
+      append_binary(row.get_as_string(field));
+      break;
+
+    default:
+      append_binary(row.get_string(field));
+      break;
+  }
+
+  set_valid(true);
+}
+
+int64_t Column_buffer::get_int(size_t index) const {
+  assert(Layout::Int64 == m_layout);
+  return fixed<int64_t>(index);
+}
+
+uint64_t Column_buffer::get_uint(size_t index) const {
+  assert(Layout::UInt64 == m_layout);
+  return fixed<uint64_t>(index);
+}
+
+double Column_buffer::get_double(size_t index) const {
+  assert(Layout::Double == m_layout);
+  return fixed<double>(index);
+}
+
+std::string_view Column_buffer::get_string(size_t index) const {
+  assert(Layout::Binary == m_layout);
+  assert(index < m_size);
+
+  const auto begin = m_offsets[index];
+  return {m_data.data() + begin,
+          static_cast<size_t>(m_offsets[index + 1] - begin)};
+}
+
+template <typename T>
+void Column_buffer::append_fixed(T value) {
+  static_assert(sizeof(T) == sizeof(uint64_t));
+
+  const auto pos = m_data.size();
+  m_data.resize(pos + sizeof(T));
+  memcpy(m_data.data() + pos, &value, sizeof(T));
+}
+
+template <typename T>
+T Column_buffer::fixed(size_t index) const {
+  assert(index < m_size);
+
+  T value;
+  memcpy(&value, m_data.data() + index * sizeof(T), sizeof(T));
+  return value;
+}
+
+void Column_buffer::append_binary(std::string_view value) {
+  if (m_data.size() + value.size() >
+      static_cast<size_t>(std::numeric_limits<int64_t>::max())) {
+    throw std::length_error("Column is too big to be stored");
+  }
+
+  m_data.insert(m_data.end(), value.begin(), value.end());
+  m_offsets.emplace_back(m_data.size());
+}
+
+void Column_buffer::append_null() {
+  if (Layout::Binary == m_layout) {
+    m_offsets.emplace_back(m_data.size());
+  } else {
+    m_data.resize(m_data.size() + sizeof(uint64_t), 0);
+  }
+
+  ++m_null_count;
+  set_valid(false);
+}
+
+void Column_buffer::set_valid(bool valid) {
+  if (0 == m_size % 8) {
+    m_validity.emplace_back(0);
+  }
+
+  if (valid) {
+    m_validity.back() |= 1 << (m_size % 8);
+  }
+
+  ++m_size;
+}
+
+std::vector<Column_buffer> fetch_columns(IResult *result, size_t max_rows) {
+  assert(result);
+
+  const auto &metadata = result->get_metadata();
+  const auto fields = static_cast<uint32_t>(metadata.size());
+  std::vector<Column_buffer> columns;
+
+  columns.reserve(fields);
+
+  for (const auto &column : metadata) {
+    columns.emplace_back(column.get_type());
+
+    if (max_rows) {
+      columns.back().reserve(std::min(max_rows, k_max_reserved_rows));
+    }
+  }
+
+  size_t rows = 0;
+
+  while (0 == max_rows || rows < max_rows) {
+    const auto row = result->fetch_one();
+
+    if (!row) {
+      break;
+    }
+
+    if (row->num_fields() != fields) {
+      throw std::logic_error(shcore::str_format(
+          "Row has %u fields, expected %u", row->num_fields(), fields));
+    }
+
+    for (uint32_t i = 0; i < fields; ++i) {
+      columns[i].append(*row, i);
+    }
+
+    ++rows;
+  }
+
+  return columns;
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Columnar storage of the values of a result
+
+#ifndef MYSQLSHDK_LIBS_DB_COLUMN_BUFFER_H_
+#define MYSQLSHDK_LIBS_DB_COLUMN_BUFFER_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mysqlshdk/include/mysqlshdk_export.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/result.h"
+#include "mysqlshdk/libs/db/row.h"
+
+namespace mysqlshdk {
+namespace db {
+
+/**
+ * Holds the values of a single field of consecutive rows of a result in a
+ * contiguous memory, instead of converting each of the values separately.
+ *
+ * The layout follows the one used by the columnar formats (i.e. Apache Arrow):
+ *  - fixed size values are stored in an array of 64-bit values,
+ *  - variable length values are stored one after another, with an array of
+ *    size() + 1 offsets, i-th value spans [offsets[i], offsets[i + 1]),
+ *  - validity bitmap has a bit for each of the values, bit is set if value is
+ *    not NULL, least significant bit first; slots of NULL values are zeroed.
+ */
+class SHCORE_PUBLIC Column_buffer final {
+ public:
+  enum class Layout {
+    Int64,
+    UInt64,
+    Double,
+    Binary,
+  };
+
+  explicit Column_buffer(Type type);
+
+  Column_buffer(const Column_buffer &) = delete;
+  Column_buffer(Column_buffer &&) = default;
+
+  Column_buffer &operator=(const Column_buffer &) = delete;
+  Column_buffer &operator=(Column_buffer &&) = default;
+
+  ~Column_buffer() = default;
+
+  /**
+   * Layout used to store the values of the given type:
+   *  - Integer - Int64
+   *  - UInteger, Bit - UInt64
+   *  - Float, Double - Double
+   *  - all other types - Binary, values are stored as strings
+   */
+  static Layout layout(Type type);
+
+  void reserve(size_t rows);
+
+  /**
+   * Appends the value of the given field of a row, type of the field needs to
+   * match the type of the buffer.
+   */
+  void append(const IRow &row, uint32_t field);
+
+  Type type() const { return m_type; }
+
+  Layout layout() const { return m_layout; }
+
+  size_t size() const { return m_size; }
+
+  bool empty() const { return 0 == m_size; }
+
+  size_t null_count() const { return m_null_count; }
+
+  bool is_null(size_t index) const {
+    return 0 == (m_validity[index / 8] & (1 << (index % 8)));
+  }
+
+  int64_t get_int(size_t index) const;
+  uint64_t get_uint(size_t index) const;
+  double get_double(size_t index) const;
+  std::string_view get_string(size_t index) const;
+
+  /**
+   * Fixed size values or the contents of the variable length values.
+   */
+  const char *data() const { return m_data.data(); }
+
+  size_t data_size() const { return m_data.size(); }
+
+  /**
+   * Offsets of the variable length values, empty for other layouts.
+   */
+  const std::vector<int64_t> &offsets() const { return m_offsets; }
+
+  const std::vector<uint8_t> &validity() const { return m_validity; }
+
+ private:
+  template <typename T>
+  void append_fixed(T value);
+
+  template <typename T>
+  T fixed(size_t index) const;
+
+  void append_binary(std::string_view value);
+
+  void append_null();
+
+  void set_valid(bool valid);
+
+  Type m_type;
+  Layout m_layout;
+  size_t m_size = 0;
+  size_t m_null_count = 0;
+
+  std::vector<char> m_data;
+  std::vector<int64_t> m_offsets;
+  std::vector<uint8_t> m_validity;
+};
+
+/**
+ * Fetches up to max_rows rows from the given result, decoding them into a
+ * buffer per each of the fields.
+ *
+ * @param result result to fetch the rows from
+ * @param max_rows maximum number of rows to fetch, 0 - fetch all rows
+ *
+ * @returns buffers of all of the fields of the result, in the same order as
+ *          its metadata
+ */
+SHCORE_PUBLIC std::vector<Column_buffer> fetch_columns(IResult *result,
+                                                       size_t max_rows = 0);
+
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_COLUMN_BUFFER_H_
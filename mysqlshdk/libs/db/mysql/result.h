@@ -39,6 +39,8 @@
 
 #include <mysql.h>
 
+#include "mysqlshdk/libs/db/row_store.h"
+
 namespace mysqlshdk {
 namespace db {
 namespace mysql {
@@ -80,7 +82,7 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
          bool buffered);
   void reset(std::shared_ptr<MYSQL_RES> res);
 
-  std::deque<mysqlshdk::db::Row_copy> _pre_fetched_rows;
+  mysqlshdk::db::Row_store _pre_fetched_rows;
   // size_t _fetched_row_count = 0;
   // size_t _fetched_warning_count = 0;
   bool _stop_pre_fetch = false;
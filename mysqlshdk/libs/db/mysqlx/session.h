@@ -35,6 +35,8 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <variant>
+#include <vector>
 #include "mysqlshdk/libs/db/mysqlx/mysqlxclient_clean.h"
 
 #include "mysqlshdk/libs/db/mysqlx/result.h"
@@ -58,6 +60,14 @@ struct GlobalNotice {
   Type type;
 };
 
+/**
+ * Message which can be sent as a part of a pipeline.
+ */
+using Pipelined_message =
+    std::variant<::Mysqlx::Sql::StmtExecute, ::Mysqlx::Crud::Insert,
+                 ::Mysqlx::Crud::Update, ::Mysqlx::Crud::Delete,
+                 ::Mysqlx::Crud::Find>;
+
 /*
  * Session implementation for the MySQL protocol.
  *
@@ -121,6 +131,9 @@ class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
   std::shared_ptr<IResult> execute_crud(const ::Mysqlx::Crud::Delete &msg);
   std::shared_ptr<IResult> execute_crud(const ::Mysqlx::Crud::Find &msg);
 
+  std::vector<std::shared_ptr<IResult>> execute_pipelined(
+      const std::vector<Pipelined_message> &messages, std::size_t *failed);
+
   uint32_t next_prep_stmt_id() { return ++m_prep_stmt_count; }
   void prepare_stmt(const ::Mysqlx::Prepare::Prepare &msg);
 
@@ -243,6 +256,25 @@ class SHCORE_PUBLIC Session : public ISession,
     return _impl->execute_crud(msg);
   }
 
+  /**
+   * Sends all the messages without waiting for the responses, then reads the
+   * results in the same order. Rows of each result are buffered, result sets
+   * other than the first one are discarded.
+   *
+   * If one of the statements fails, the following ones are not executed and
+   * the error is thrown once all the responses are read.
+   *
+   * @param messages Statements to be executed.
+   * @param failed If set, receives the index of the statement which failed.
+   *
+   * @returns Results of the statements.
+   */
+  std::vector<std::shared_ptr<IResult>> execute_pipelined(
+      const std::vector<Pipelined_message> &messages,
+      std::size_t *failed = nullptr) {
+    return _impl->execute_pipelined(messages, failed);
+  }
+
   uint32_t next_prep_stmt_id() { return _impl->next_prep_stmt_id(); }
   void prepare_stmt(const ::Mysqlx::Prepare::Prepare &msg) {
     _impl->prepare_stmt(msg);
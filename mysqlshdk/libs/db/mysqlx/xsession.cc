@@ -26,9 +26,12 @@
 #include <mysqlx_version.h>
 
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <variant>
 
 #include "mysqlshdk/include/shellcore/console.h"
 #include "mysqlshdk/libs/db/mysqlx/session.h"
@@ -723,6 +726,106 @@ std::shared_ptr<IResult> XSession_impl::execute_crud(
   return result;
 }
 
+std::vector<std::shared_ptr<IResult>> XSession_impl::execute_pipelined(
+    const std::vector<Pipelined_message> &messages, std::size_t *failed) {
+  mysqlshdk::utils::Profile_timer timer;
+  timer.stage_begin("execute_pipelined");
+  before_query();
+
+  auto &protocol = _mysql->get_protocol();
+  auto log_sql_handler = shcore::current_log_sql();
+
+  const auto stmt = [](const Pipelined_message &message) -> const char * {
+    if (const auto sql = std::get_if<::Mysqlx::Sql::StmtExecute>(&message)) {
+      return sql->stmt().c_str();
+    }
+
+    return nullptr;
+  };
+
+  // statements which follow a failed one are not executed
+  ::Mysqlx::Expect::Open open;
+  open.add_cond()->set_condition_key(
+      ::Mysqlx::Expect::Open::Condition::EXPECT_NO_ERROR);
+  check_error_and_throw(protocol.send(open));
+
+  for (const auto &message : messages) {
+    if (const auto sql = stmt(message)) {
+      log_sql_handler->log(get_thread_id(), sql);
+      DBUG_LOG("sqlall", get_thread_id() << ": QUERY: " << sql);
+    }
+
+    check_error_and_throw(std::visit(
+        [&protocol](const auto &msg) { return protocol.send(msg); }, message));
+  }
+
+  check_error_and_throw(protocol.send(::Mysqlx::Expect::Close()));
+
+  // all responses are read, even if a statement has failed, so that nothing
+  // is left on the wire
+  std::optional<Error> first_error;
+  std::size_t failed_index = 0;
+  std::vector<std::shared_ptr<IResult>> results;
+  results.reserve(messages.size());
+
+  check_error_and_throw(protocol.recv_ok());
+
+  for (std::size_t i = 0; i < messages.size(); ++i) {
+    xcl::XError error;
+    auto xresult = protocol.recv_resultset(&error);
+
+    if (error) {
+      auto err = Error(error.what(), error.error());
+
+      if (const auto sql = stmt(messages[i])) {
+        log_sql_handler->log(get_thread_id(), sql, err);
+      }
+
+      // connection is no longer usable
+      if (error.is_fatal()) {
+        if (failed) *failed = i;
+        store_error_and_throw(err, stmt(messages[i]));
+      }
+
+      if (!first_error) {
+        first_error = std::move(err);
+        failed_index = i;
+      }
+
+      continue;
+    }
+
+    std::shared_ptr<Result> result(new Result(std::move(xresult)));
+    result->fetch_metadata();
+
+    // result needs to be read in full before the next one is available
+    if (result->has_resultset()) result->pre_fetch_rows(false);
+    result->drain_resultset();
+
+    results.emplace_back(std::move(result));
+  }
+
+  {
+    const auto error = protocol.recv_ok();
+
+    if (!first_error) check_error_and_throw(error);
+  }
+
+  if (first_error) {
+    if (failed) *failed = failed_index;
+    store_error_and_throw(*first_error, stmt(messages[failed_index]));
+  }
+
+  timer.stage_end();
+
+  // statements were executed concurrently, each one gets the total time
+  for (const auto &result : results) {
+    result->set_execution_time(timer.total_seconds_elapsed());
+  }
+
+  return results;
+}
+
 void XSession_impl::prepare_stmt(const ::Mysqlx::Prepare::Prepare &msg) {
   before_query();
   xcl::XError error = _mysql->get_protocol().send(msg);
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/row_store.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace db {
+
+#define FIELD_ERROR(index, msg) \
+  std::invalid_argument(        \
+      shcore::str_format("%s(%u): " msg, __FUNCTION__, index).c_str())
+
+#define FIELD_ERROR1(index, msg, arg) \
+  std::invalid_argument(              \
+      shcore::str_format("%s(%u): " msg, __FUNCTION__, index, arg).c_str())
+
+#define VALIDATE_INDEX(index)                          \
+  do {                                                 \
+    if (index >= num_fields())                         \
+      throw FIELD_ERROR(index, "index out of bounds"); \
+  } while (0)
+
+#define GET_VALIDATE_TYPE(index, TYPE_CHECK)                                  \
+  if (index >= num_fields()) throw FIELD_ERROR(index, "index out of bounds"); \
+  if (is_null(index)) throw FIELD_ERROR(index, "field is NULL");              \
+  ftype = get_type(index);                                                    \
+  if (!(TYPE_CHECK))                                                          \
+    throw FIELD_ERROR1(index, "field type is %s", to_string(ftype).c_str());
+
+namespace {
+
+/**
+ * Each field has a slot of this size at the beginning of a record, holding
+ * either its value or the position of its data within the record.
+ */
+constexpr size_t k_slot_size = sizeof(uint64_t);
+
+/**
+ * Minimum size of a memory block allocated for records.
+ */
+constexpr size_t k_block_size = 256 * 1024;
+
+inline size_t null_bitmap_size(size_t fields) { return (fields + 7) / 8; }
+
+inline bool is_stored_as_string(Type type) {
+  switch (type) {
+    case Type::Integer:
+    case Type::UInteger:
+    case Type::Float:
+    case Type::Double:
+    case Type::Null:
+      return false;
+
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
+void Row_store::emplace_back(const IRow &row) {
+  const auto fields = row.num_fields();
+
+  if (m_types.empty()) {
+    m_types.reserve(fields);
+
+    for (uint32_t i = 0; i < fields; ++i) {
+      m_types.emplace_back(row.get_type(i));
+    }
+  } else if (m_types.size() != fields) {
+    throw std::logic_error(
+        "Attempt to store a row with a different number of fields");
+  }
+
+  if (m_converted.size() < fields) m_converted.resize(fields);
+  if (m_field_data.size() < fields) m_field_data.resize(fields);
+
+  // first pass: find out the size of the record
+  const auto header_size = fields * k_slot_size + null_bitmap_size(fields);
+  size_t size = header_size;
+  auto &data = m_field_data;
+
+  for (uint32_t i = 0; i < fields; ++i) {
+    const auto type = m_types[i];
+
+    if (!is_stored_as_string(type) || row.is_null(i)) continue;
+
+    switch (type) {
+      case Type::String:
+      case Type::Bytes: {
+        const auto s = row.get_string_data(i);
+        data[i] = {s.first, s.second};
+        break;
+      }
+
+      case Type::Decimal:
+      case Type::Bit:
+        m_converted[i] = row.get_as_string(i);
+        data[i] = m_converted[i];
+        break;
+
+      default:
+        m_converted[i] = row.get_string(i);
+        data[i] = m_converted[i];
+        break;
+    }
+
+    size += data[i].size();
+  }
+
+  if (size > std::numeric_limits<uint32_t>::max()) {
+    throw std::length_error("Row is too big to be stored");
+  }
+
+  // second pass: write the record
+  const auto record = allocate(size);
+  const auto null_bitmap = record + fields * k_slot_size;
+  auto offset = header_size;
+
+  std::fill(null_bitmap, null_bitmap + null_bitmap_size(fields), 0);
+
+  for (uint32_t i = 0; i < fields; ++i) {
+    const auto slot = record + i * k_slot_size;
+    const auto type = m_types[i];
+
+    if (Type::Null == type || row.is_null(i)) {
+      null_bitmap[i / 8] |= 1 << (i % 8);
+      continue;
+    }
+
+    switch (type) {
+      case Type::Integer: {
+        const auto v = row.get_int(i);
+        memcpy(slot, &v, sizeof(v));
+        break;
+      }
+
+      case Type::UInteger: {
+        const auto v = row.get_uint(i);
+        memcpy(slot, &v, sizeof(v));
+        break;
+      }
+
+      case Type::Float: {
+        const auto v = row.get_float(i);
+        memcpy(slot, &v, sizeof(v));
+        break;
+      }
+
+      case Type::Double: {
+        const auto v = row.get_double(i);
+        memcpy(slot, &v, sizeof(v));
+        break;
+      }
+
+      default: {
+        const uint32_t position[2] = {static_cast<uint32_t>(offset),
+                                      static_cast<uint32_t>(data[i].size())};
+        memcpy(slot, position, sizeof(position));
+
+        if (!data[i].empty()) {
+          memcpy(record + offset, data[i].data(), data[i].size());
+        }
+
+        offset += data[i].size();
+        break;
+      }
+    }
+  }
+
+  m_rows.emplace_back(
+      Row{this, record, m_first_block + m_blocks.size() - 1});
+}
+
+void Row_store::pop_front() {
+  m_rows.pop_front();
+  release_blocks();
+}
+
+void Row_store::clear() {
+  m_rows.clear();
+  m_blocks.clear();
+  m_first_block = 0;
+  m_block_pos = nullptr;
+  m_block_end = nullptr;
+  m_types.clear();
+}
+
+char *Row_store::allocate(size_t size) {
+  if (static_cast<size_t>(m_block_end - m_block_pos) < size) {
+    const auto block_size = std::max(k_block_size, size);
+
+    m_blocks.emplace_back(new char[block_size]);
+    m_block_pos = m_blocks.back().get();
+    m_block_end = m_block_pos + block_size;
+  }
+
+  const auto ptr = m_block_pos;
+  m_block_pos += size;
+  return ptr;
+}
+
+void Row_store::release_blocks() {
+  if (m_blocks.empty()) return;
+
+  // the last block is kept, so that it can be reused
+  const auto first_used = m_rows.empty()
+                              ? m_first_block + m_blocks.size() - 1
+                              : m_rows.front().m_block;
+
+  while (m_first_block < first_used) {
+    m_blocks.pop_front();
+    ++m_first_block;
+  }
+
+  if (m_rows.empty()) {
+    m_block_pos = m_blocks.back().get();
+  }
+}
+
+template <typename T>
+T Row_store::Row::value(uint32_t index) const {
+  T v;
+  memcpy(&v, m_record + index * k_slot_size, sizeof(v));
+  return v;
+}
+
+std::string_view Row_store::Row::string_value(uint32_t index) const {
+  uint32_t position[2];
+  memcpy(position, m_record + index * k_slot_size, sizeof(position));
+  return {m_record + position[0], position[1]};
+}
+
+uint32_t Row_store::Row::num_fields() const {
+  return static_cast<uint32_t>(m_owner->m_types.size());
+}
+
+Type Row_store::Row::get_type(uint32_t index) const {
+  VALIDATE_INDEX(index);
+  return m_owner->m_types[index];
+}
+
+bool Row_store::Row::is_null(uint32_t index) const {
+  VALIDATE_INDEX(index);
+  const auto null_bitmap = m_record + m_owner->m_types.size() * k_slot_size;
+  return null_bitmap[index / 8] & (1 << (index % 8));
+}
+
+std::string Row_store::Row::get_as_string(uint32_t index) const {
+  VALIDATE_INDEX(index);
+
+  if (is_null(index)) return "NULL";
+
+  switch (get_type(index)) {
+    case Type::Null:
+      return "NULL";
+
+    case Type::Integer:
+      return std::to_string(value<int64_t>(index));
+
+    case Type::UInteger:
+      return std::to_string(value<uint64_t>(index));
+
+    case Type::Float:
+      return std::to_string(value<float>(index));
+
+    case Type::Double:
+      return std::to_string(value<double>(index));
+
+    default:
+      return std::string{string_value(index)};
+  }
+}
+
+std::string Row_store::Row::get_string(uint32_t index) const {
+  Type ftype;
+  GET_VALIDATE_TYPE(index, (is_string_type(ftype)));
+  return std::string{string_value(index)};
+}
+
+int64_t Row_store::Row::get_int(uint32_t index) const {
+  Type ftype;
+  std::string dec;
+  GET_VALIDATE_TYPE(index, (ftype == Type::Integer || ftype == Type::UInteger ||
+                            (ftype == Type::Decimal &&
+                             (dec = string_value(index)).find('.') ==
+                                 std::string::npos)));
+
+  if (ftype == Type::UInteger) {
+    const auto u = value<uint64_t>(index);
+    if (u > LLONG_MAX) {
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    }
+    return static_cast<int64_t>(u);
+  } else if (ftype == Type::Decimal) {
+    return std::stoll(dec);
+  }
+  return value<int64_t>(index);
+}
+
+uint64_t Row_store::Row::get_uint(uint32_t index) const {
+  Type ftype;
+  std::string dec;
+  GET_VALIDATE_TYPE(index, (ftype == Type::Integer || ftype == Type::UInteger ||
+                            (ftype == Type::Decimal &&
+                             (dec = string_value(index)).find('.') ==
+                                 std::string::npos)));
+
+  if (ftype == Type::Integer) {
+    const auto i = value<int64_t>(index);
+    if (i < 0) {
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    }
+    return static_cast<uint64_t>(i);
+  } else if (ftype == Type::Decimal) {
+    if (!dec.empty() && dec[0] == '-') {
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    }
+    return std::stoull(dec);
+  }
+  return value<uint64_t>(index);
+}
+
+float Row_store::Row::get_float(uint32_t index) const {
+  Type ftype;
+  GET_VALIDATE_TYPE(index, (ftype == Type::Float || ftype == Type::Decimal ||
+                            ftype == Type::Double));
+  switch (ftype) {
+    case Type::Decimal:
+      try {
+        return std::stof(std::string{string_value(index)});
+      } catch (...) {
+        throw FIELD_ERROR(index, "float value out of the allowed range");
+      }
+    case Type::Double:
+      return static_cast<float>(value<double>(index));
+    case Type::Float:
+      return value<float>(index);
+    default:
+      throw std::logic_error("internal error");
+  }
+}
+
+double Row_store::Row::get_double(uint32_t index) const {
+  Type ftype;
+  GET_VALIDATE_TYPE(index, (ftype == Type::Double || ftype == Type::Float ||
+                            ftype == Type::Decimal));
+  switch (ftype) {
+    case Type::Decimal:
+      try {
+        return std::stod(std::string{string_value(index)});
+      } catch (const std::exception &e) {
+        throw FIELD_ERROR(index, "double value out of the allowed range");
+      }
+    case Type::Float:
+      return static_cast<double>(value<float>(index));
+    case Type::Double:
+      return value<double>(index);
+    default:
+      throw std::logic_error("internal error");
+  }
+}
+
+std::pair<const char *, size_t> Row_store::Row::get_string_data(
+    uint32_t index) const {
+  Type ftype;
+  GET_VALIDATE_TYPE(index, (ftype == Type::String || ftype == Type::Bytes));
+  const auto s = string_value(index);
+  return {s.data(), s.size()};
+}
+
+void Row_store::Row::get_raw_data(uint32_t index, const char **out_data,
+                                  size_t *out_size) const {
+  if (is_null(index)) {
+    *out_data = nullptr;
+    *out_size = 0;
+  } else if (is_stored_as_string(get_type(index))) {
+    const auto s = string_value(index);
+    *out_data = s.data();
+    *out_size = s.size();
+  } else {
+    auto &cache = m_owner->m_raw_data_cache;
+    cache = get_as_string(index);
+    *out_data = cache.c_str();
+    *out_size = cache.length();
+  }
+}
+
+std::tuple<uint64_t, int> Row_store::Row::get_bit(uint32_t index) const {
+  Type ftype;
+  GET_VALIDATE_TYPE(index, (ftype == Type::Bit));
+  return shcore::string_to_bits(string_value(index));
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Compact storage of copies of rows
+
+#ifndef MYSQLSHDK_LIBS_DB_ROW_STORE_H_
+#define MYSQLSHDK_LIBS_DB_ROW_STORE_H_
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/mysqlshdk_export.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row.h"
+
+namespace mysqlshdk {
+namespace db {
+
+/**
+ * Append-only storage of copies of rows which belong to the same result set.
+ *
+ * As opposed to Row_copy, which allocates every field separately, each row is
+ * serialized into a single record: a fixed size slot per field, followed by a
+ * null bitmap and the contents of the variable length fields. Records are
+ * placed one after another in large blocks of memory, shared by all the rows.
+ * Types of the fields are shared by all the rows as well.
+ *
+ * Provides the subset of std::deque operations which is used to hold the
+ * pre-fetched rows of a result.
+ */
+class SHCORE_PUBLIC Row_store final {
+ public:
+  /**
+   * Read-only view of a row held by the store, valid until it's popped or the
+   * store is cleared.
+   */
+  class SHCORE_PUBLIC Row final : public IRow {
+   public:
+    Row(const Row &) = delete;
+    Row &operator=(const Row &) = delete;
+    Row(Row &&) = default;
+    Row &operator=(Row &&) = default;
+    ~Row() override = default;
+
+    uint32_t num_fields() const override;
+
+    Type get_type(uint32_t index) const override;
+    bool is_null(uint32_t index) const override;
+    std::string get_as_string(uint32_t index) const override;
+
+    std::string get_string(uint32_t index) const override;
+    int64_t get_int(uint32_t index) const override;
+    uint64_t get_uint(uint32_t index) const override;
+    float get_float(uint32_t index) const override;
+    double get_double(uint32_t index) const override;
+    std::pair<const char *, size_t> get_string_data(
+        uint32_t index) const override;
+    void get_raw_data(uint32_t index, const char **out_data,
+                      size_t *out_size) const override;
+    std::tuple<uint64_t, int> get_bit(uint32_t index) const override;
+
+   private:
+    friend class Row_store;
+
+    Row(const Row_store *owner, const char *record, uint64_t block)
+        : m_owner(owner), m_record(record), m_block(block) {}
+
+    template <typename T>
+    T value(uint32_t index) const;
+
+    std::string_view string_value(uint32_t index) const;
+
+    const Row_store *m_owner;
+    const char *m_record;
+    // sequential number of the block which holds the record
+    uint64_t m_block;
+  };
+
+  Row_store() = default;
+
+  Row_store(const Row_store &) = delete;
+  Row_store(Row_store &&) = delete;
+
+  Row_store &operator=(const Row_store &) = delete;
+  Row_store &operator=(Row_store &&) = delete;
+
+  ~Row_store() = default;
+
+  /**
+   * Stores a copy of the given row. All rows in the store need to have the
+   * same fields.
+   */
+  void emplace_back(const IRow &row);
+
+  const Row &front() const { return m_rows.front(); }
+
+  /**
+   * Removes the first row, memory which is no longer used by any row is
+   * released.
+   */
+  void pop_front();
+
+  const Row &operator[](size_t index) const { return m_rows[index]; }
+
+  size_t size() const { return m_rows.size(); }
+
+  bool empty() const { return m_rows.empty(); }
+
+  void clear();
+
+ private:
+  char *allocate(size_t size);
+
+  void release_blocks();
+
+  std::vector<Type> m_types;
+  std::deque<Row> m_rows;
+
+  std::deque<std::unique_ptr<char[]>> m_blocks;
+  // sequential number of the first block in m_blocks
+  uint64_t m_first_block = 0;
+  char *m_block_pos = nullptr;
+  char *m_block_end = nullptr;
+
+  // shared by all rows to keep them small, raw data of a numeric field is
+  // valid until get_raw_data() is called again
+  mutable std::string m_raw_data_cache;
+
+  // temporary storage used when a row is being stored
+  std::vector<std::string> m_converted;
+  std::vector<std::string_view> m_field_data;
+};
+
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_ROW_STORE_H_
@@ -25,11 +25,214 @@
 
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <limits>
+#include <stdexcept>
+
 #include "mysqlshdk/libs/mysql/replication.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
 namespace mysql {
 
+namespace {
+
+using Interval = Gtid_intervals::Interval;
+using Intervals = std::vector<Interval>;
+
+constexpr std::size_t k_uuid_length = 36;
+constexpr std::size_t k_max_tag_length = 32;
+// transaction numbers are in range [1, 2^63 - 1]
+constexpr uint64_t k_max_gno = std::numeric_limits<int64_t>::max();
+
+std::atomic<bool> g_server_verification{false};
+
+[[noreturn]] void throw_malformed(std::string_view gtid_set) {
+  throw std::invalid_argument("Malformed GTID set specification '" +
+                              std::string{gtid_set} + "'.");
+}
+
+std::string_view trim(std::string_view s) {
+  constexpr std::string_view k_whitespace = " \t\n\r";
+
+  const auto begin = s.find_first_not_of(k_whitespace);
+
+  if (std::string_view::npos == begin) {
+    return {};
+  }
+
+  return s.substr(begin, s.find_last_not_of(k_whitespace) - begin + 1);
+}
+
+/**
+ * Accepts the same formats as the server: 8-4-4-4-12 hex digits, optionally
+ * in braces, or 32 hex digits.
+ */
+bool normalize_uuid(std::string_view uuid, std::string *out) {
+  if (uuid.size() == k_uuid_length + 2 && '{' == uuid.front() &&
+      '}' == uuid.back()) {
+    uuid = uuid.substr(1, k_uuid_length);
+  }
+
+  const auto with_dashes = k_uuid_length == uuid.size();
+
+  if (!with_dashes && 32 != uuid.size()) {
+    return false;
+  }
+
+  out->clear();
+  out->reserve(k_uuid_length);
+
+  for (std::size_t i = 0; i < uuid.size(); ++i) {
+    const auto c = uuid[i];
+
+    if (with_dashes && (8 == i || 13 == i || 18 == i || 23 == i)) {
+      if ('-' != c) return false;
+    } else {
+      if (!std::isxdigit(static_cast<unsigned char>(c))) return false;
+
+      if (!with_dashes && (8 == i || 12 == i || 16 == i || 20 == i)) {
+        out->push_back('-');
+      }
+    }
+
+    out->push_back(
+        static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+  }
+
+  return true;
+}
+
+bool is_tag(std::string_view tag) {
+  if (tag.empty() || tag.size() > k_max_tag_length) {
+    return false;
+  }
+
+  const auto valid = [](unsigned char c, bool first) {
+    return '_' == c || std::isalpha(c) || (!first && std::isdigit(c));
+  };
+
+  for (std::size_t i = 0; i < tag.size(); ++i) {
+    if (!valid(static_cast<unsigned char>(tag[i]), 0 == i)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool parse_gno(std::string_view s, uint64_t *out) {
+  if (s.empty() || !std::isdigit(static_cast<unsigned char>(s.front()))) {
+    return false;
+  }
+
+  const auto end = s.data() + s.size();
+  const auto result = std::from_chars(s.data(), end, *out);
+
+  return std::errc{} == result.ec && end == result.ptr && *out > 0 &&
+         *out <= k_max_gno;
+}
+
+bool parse_interval(std::string_view s, Interval *out) {
+  const auto dash = s.find('-');
+
+  if (std::string_view::npos == dash) {
+    if (!parse_gno(trim(s), &out->first)) return false;
+    out->second = out->first;
+  } else {
+    if (!parse_gno(trim(s.substr(0, dash)), &out->first) ||
+        !parse_gno(trim(s.substr(dash + 1)), &out->second)) {
+      return false;
+    }
+  }
+
+  return out->first <= out->second;
+}
+
+/**
+ * Sorts the intervals and merges the overlapping and adjacent ones.
+ */
+void coalesce(Intervals *intervals) {
+  if (intervals->size() < 2) {
+    return;
+  }
+
+  std::sort(intervals->begin(), intervals->end());
+
+  auto last = intervals->begin();
+
+  for (auto it = std::next(last); it != intervals->end(); ++it) {
+    if (it->first <= last->second + 1) {
+      last->second = std::max(last->second, it->second);
+    } else {
+      *++last = *it;
+    }
+  }
+
+  intervals->erase(std::next(last), intervals->end());
+}
+
+Intervals subtract(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  auto other = b.begin();
+
+  for (auto [begin, end] : a) {
+    // skip intervals which end before this one
+    while (other != b.end() && other->second < begin) {
+      ++other;
+    }
+
+    bool covered = false;
+
+    for (auto it = other; it != b.end() && it->first <= end; ++it) {
+      if (it->first > begin) {
+        result.emplace_back(begin, it->first - 1);
+      }
+
+      if (it->second >= end) {
+        covered = true;
+        break;
+      }
+
+      begin = it->second + 1;
+    }
+
+    if (!covered) {
+      result.emplace_back(begin, end);
+    }
+  }
+
+  return result;
+}
+
+Intervals intersect(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  auto left = a.begin();
+  auto right = b.begin();
+
+  while (left != a.end() && right != b.end()) {
+    const auto begin = std::max(left->first, right->first);
+    const auto end = std::min(left->second, right->second);
+
+    if (begin <= end) {
+      result.emplace_back(begin, end);
+    }
+
+    if (left->second < right->second) {
+      ++left;
+    } else {
+      ++right;
+    }
+  }
+
+  return result;
+}
+
+}  // namespace
+
 std::string to_string(const Gtid_range &range) {
   if (std::get<1>(range) == std::get<2>(range))
     return std::get<0>(range) + ":" + std::to_string(std::get<1>(range));
@@ -42,31 +245,274 @@ uint64_t count(const Gtid_range &range) {
   return std::get<2>(range) - std::get<1>(range) + 1;
 }
 
-Gtid_set &Gtid_set::normalize(const mysqlshdk::mysql::IInstance &server) {
+Gtid_intervals Gtid_intervals::parse(std::string_view gtid_set) {
+  Gtid_intervals result;
+  std::string uuid;
+  std::string source;
+  Interval interval;
+
+  for (std::size_t begin = 0; begin <= gtid_set.size();) {
+    auto end = gtid_set.find(',', begin);
+
+    if (std::string_view::npos == end) {
+      end = gtid_set.size();
+    }
+
+    const auto item = trim(gtid_set.substr(begin, end - begin));
+    begin = end + 1;
+
+    if (item.empty()) {
+      continue;
+    }
+
+    auto colon = item.find(':');
+
+    if (!normalize_uuid(trim(item.substr(0, colon)), &uuid)) {
+      throw_malformed(gtid_set);
+    }
+
+    source = uuid;
+    Intervals *intervals = nullptr;
+
+    while (std::string_view::npos != colon) {
+      const auto next = item.find(':', colon + 1);
+      const auto token = trim(item.substr(colon + 1, next - colon - 1));
+      colon = next;
+
+      if (!token.empty() &&
+          std::isdigit(static_cast<unsigned char>(token.front()))) {
+        if (!parse_interval(token, &interval)) {
+          throw_malformed(gtid_set);
+        }
+
+        if (!intervals) {
+          intervals = &result.m_sources[source];
+        }
+
+        intervals->emplace_back(interval);
+      } else if (is_tag(token)) {
+        source = uuid + ':';
+        std::transform(token.begin(), token.end(), std::back_inserter(source),
+                       [](unsigned char c) { return std::tolower(c); });
+        intervals = nullptr;
+      } else {
+        throw_malformed(gtid_set);
+      }
+    }
+  }
+
+  for (auto &s : result.m_sources) {
+    coalesce(&s.second);
+  }
+
+  return result;
+}
+
+std::string Gtid_intervals::to_string() const {
+  std::string result;
+  std::string_view uuid;
+
+  for (const auto &[source, intervals] : m_sources) {
+    const std::string_view s = source;
+
+    if (s.substr(0, k_uuid_length) != uuid) {
+      if (!result.empty()) {
+        result += ",\n";
+      }
+
+      uuid = s.substr(0, k_uuid_length);
+      result += uuid;
+    }
+
+    if (s.size() > k_uuid_length) {
+      // tag, including the colon
+      result += s.substr(k_uuid_length);
+    }
+
+    for (const auto &interval : intervals) {
+      result += ':';
+      result += std::to_string(interval.first);
+
+      if (interval.first != interval.second) {
+        result += '-';
+        result += std::to_string(interval.second);
+      }
+    }
+  }
+
+  return result;
+}
+
+void Gtid_intervals::add(const std::string &source, uint64_t begin,
+                         uint64_t end) {
+  if (begin > end) {
+    throw std::invalid_argument("Invalid GTID range: " +
+                                mysqlshdk::mysql::to_string(
+                                    Gtid_range{source, begin, end}));
+  }
+
+  auto &intervals = m_sources[source];
+  intervals.emplace_back(begin, end);
+  coalesce(&intervals);
+}
+
+void Gtid_intervals::add(const Gtid_intervals &other) {
+  for (const auto &[source, intervals] : other.m_sources) {
+    auto &target = m_sources[source];
+    target.insert(target.end(), intervals.begin(), intervals.end());
+    coalesce(&target);
+  }
+}
+
+void Gtid_intervals::subtract(const Gtid_intervals &other) {
+  for (auto it = m_sources.begin(); it != m_sources.end();) {
+    if (const auto o = other.m_sources.find(it->first);
+        other.m_sources.end() != o) {
+      it->second = mysqlshdk::mysql::subtract(it->second, o->second);
+    }
+
+    if (it->second.empty()) {
+      it = m_sources.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void Gtid_intervals::intersect(const Gtid_intervals &other) {
+  for (auto it = m_sources.begin(); it != m_sources.end();) {
+    if (const auto o = other.m_sources.find(it->first);
+        other.m_sources.end() != o) {
+      it->second = mysqlshdk::mysql::intersect(it->second, o->second);
+    } else {
+      it->second.clear();
+    }
+
+    if (it->second.empty()) {
+      it = m_sources.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+bool Gtid_intervals::contains(const Gtid_intervals &other) const {
+  for (const auto &[source, intervals] : other.m_sources) {
+    const auto it = m_sources.find(source);
+
+    if (m_sources.end() == it ||
+        !mysqlshdk::mysql::subtract(intervals, it->second).empty()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+uint64_t Gtid_intervals::count() const {
+  uint64_t count = 0;
+
+  for (const auto &s : m_sources) {
+    for (const auto &interval : s.second) {
+      count += interval.second - interval.first + 1;
+    }
+  }
+
+  return count;
+}
+
+void Gtid_intervals::enumerate_ranges(
+    const std::function<void(const Gtid_range &)> &fn) const {
+  for (const auto &[source, intervals] : m_sources) {
+    for (const auto &interval : intervals) {
+      fn(std::make_tuple(source, interval.first, interval.second));
+    }
+  }
+}
+
+void Gtid_set::set_server_verification(bool enabled) {
+  g_server_verification = enabled;
+}
+
+bool Gtid_set::server_verification() { return g_server_verification; }
+
+Gtid_intervals Gtid_set::intervals() const {
+  return Gtid_intervals::parse(m_gtid_set);
+}
+
+Gtid_set &Gtid_set::assign(const Gtid_intervals &intervals) {
+  m_normalized = true;
+  m_gtid_set = intervals.to_string();
+  return *this;
+}
+
+Gtid_set &Gtid_set::verify(const char *operation, std::string &&expected) {
+  if (m_gtid_set != expected) {
+    throw std::logic_error(shcore::str_format(
+        "Result of GTID set %s operation differs from the one computed by the "
+        "server, local: '%s', server: '%s'",
+        operation, m_gtid_set.c_str(), expected.c_str()));
+  }
+
+  return *this;
+}
+
+Gtid_set &Gtid_set::normalize() {
   if (!m_normalized) {
-    m_normalized = true;
-    m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, '')",
-                                          m_gtid_set);
+    assign(intervals());
   }
+
   return *this;
 }
 
+Gtid_set &Gtid_set::normalize(const mysqlshdk::mysql::IInstance &server) {
+  if (m_normalized) {
+    return *this;
+  }
+
+  if (server_verification()) {
+    auto expected = server.queryf_one_string(
+        0, "", "SELECT gtid_subtract(?, '')", m_gtid_set);
+    return normalize().verify("normalize", std::move(expected));
+  }
+
+  return normalize();
+}
+
+Gtid_set &Gtid_set::intersect(const Gtid_set &other) {
+  auto result = intervals();
+  result.intersect(other.intervals());
+  return assign(result);
+}
+
 Gtid_set &Gtid_set::intersect(const Gtid_set &other,
                               const mysqlshdk::mysql::IInstance &server) {
-  // a /\ b = a - (a - b)
-  m_gtid_set = server.queryf_one_string(
-      0, "", "SELECT gtid_subtract(?, gtid_subtract(?, ?))", other.m_gtid_set,
-      other.m_gtid_set, m_gtid_set);
+  if (server_verification()) {
+    // a /\ b = a - (a - b)
+    auto expected = server.queryf_one_string(
+        0, "", "SELECT gtid_subtract(?, gtid_subtract(?, ?))",
+        other.m_gtid_set, other.m_gtid_set, m_gtid_set);
+    return intersect(other).verify("intersect", std::move(expected));
+  }
 
-  return *this;
+  return intersect(other);
+}
+
+Gtid_set &Gtid_set::subtract(const Gtid_set &other) {
+  auto result = intervals();
+  result.subtract(other.intervals());
+  return assign(result);
 }
 
 Gtid_set &Gtid_set::subtract(const Gtid_set &other,
                              const mysqlshdk::mysql::IInstance &server) {
-  m_normalized = true;
-  m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, ?)",
-                                        m_gtid_set, other.m_gtid_set);
-  return *this;
+  if (server_verification()) {
+    auto expected = server.queryf_one_string(
+        0, "", "SELECT gtid_subtract(?, ?)", m_gtid_set, other.m_gtid_set);
+    return subtract(other).verify("subtract", std::move(expected));
+  }
+
+  return subtract(other);
 }
 
 Gtid_set &Gtid_set::add(const Gtid &gtid) {
@@ -121,10 +567,28 @@ Gtid_set Gtid_set::get_gtids_from(const std::string &uuid) const {
   return matches;
 }
 
+bool Gtid_set::contains(const Gtid_set &other) const {
+  return intervals().contains(other.intervals());
+}
+
 bool Gtid_set::contains(const Gtid_set &other,
                         const mysqlshdk::mysql::IInstance &server) const {
-  return server.queryf_one_int(0, 0, "SELECT gtid_subtract(?, ?) = ''",
-                               other.m_gtid_set, m_gtid_set) != 0;
+  const auto result = contains(other);
+
+  if (server_verification()) {
+    const auto expected =
+        server.queryf_one_int(0, 0, "SELECT gtid_subtract(?, ?) = ''",
+                              other.m_gtid_set, m_gtid_set) != 0;
+
+    if (result != expected) {
+      throw std::logic_error(shcore::str_format(
+          "Result of GTID set contains operation differs from the one computed "
+          "by the server, set: '%s', subset: '%s', local: %d, server: %d",
+          m_gtid_set.c_str(), other.m_gtid_set.c_str(), result, expected));
+    }
+  }
+
+  return result;
 }
 
 uint64_t Gtid_set::count() const {
@@ -151,33 +615,7 @@ void Gtid_set::enumerate_ranges(
   if (!m_normalized)
     throw std::invalid_argument("Can't enumerate un-normalized Gtid_set");
 
-  shcore::str_itersplit(
-      m_gtid_set,
-      [&fn](const std::string &s) {
-        if (const auto p = s.find(':'); p != std::string::npos) {
-          const auto offs = (s.front() == '\n') ? 1 : 0;
-          // strip \n from previous range as in range,\nrange
-          const auto prefix = s.substr(offs, p - offs);
-
-          shcore::str_itersplit(
-              s.substr(p + 1),
-              [&fn, &prefix](const std::string &ss) {
-                uint64_t begin, end;
-                switch (sscanf(&ss[0], "%" PRIu64 "-%" PRIu64, &begin, &end)) {
-                  case 2:
-                    fn(std::make_tuple(Gtid(prefix), begin, end));
-                    break;
-                  case 1:
-                    fn(std::make_tuple(Gtid(prefix), begin, begin));
-                    break;
-                }
-                return true;
-              },
-              ":");
-        }
-        return true;
-      },
-      ",");
+  intervals().enumerate_ranges(fn);
 }
 
 }  // namespace mysql
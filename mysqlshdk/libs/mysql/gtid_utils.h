@@ -27,8 +27,12 @@
 #define MYSQLSHDK_LIBS_MYSQL_GTID_UTILS_H_
 
 #include <functional>
+#include <map>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/mysql/instance.h"
 
@@ -41,6 +45,76 @@ using Gtid_range = std::tuple<std::string, uint64_t, uint64_t>;
 std::string to_string(const Gtid_range &range);
 uint64_t count(const Gtid_range &range);
 
+/**
+ * Set of GTIDs stored as sorted intervals of transaction numbers, grouped by
+ * their source (UUID, optionally followed by a tag). Allows to execute the set
+ * operations locally, without a round trip to the server.
+ */
+class Gtid_intervals final {
+ public:
+  using Interval = std::pair<uint64_t, uint64_t>;
+
+  Gtid_intervals() = default;
+
+  Gtid_intervals(const Gtid_intervals &) = default;
+  Gtid_intervals(Gtid_intervals &&) = default;
+
+  Gtid_intervals &operator=(const Gtid_intervals &) = default;
+  Gtid_intervals &operator=(Gtid_intervals &&) = default;
+
+  ~Gtid_intervals() = default;
+
+  /**
+   * Parses a GTID set, UUIDs and tags are converted to lower case, intervals
+   * are sorted and merged.
+   *
+   * @throws std::invalid_argument if GTID set is malformed
+   */
+  static Gtid_intervals parse(std::string_view gtid_set);
+
+  /**
+   * Provides the same representation as the one used by the server.
+   */
+  std::string to_string() const;
+
+  void add(const std::string &source, uint64_t begin, uint64_t end);
+
+  void add(const Gtid_intervals &other);
+
+  void subtract(const Gtid_intervals &other);
+
+  void intersect(const Gtid_intervals &other);
+
+  bool contains(const Gtid_intervals &other) const;
+
+  bool empty() const { return m_sources.empty(); }
+
+  uint64_t count() const;
+
+  void enumerate_ranges(
+      const std::function<void(const Gtid_range &)> &fn) const;
+
+  bool operator==(const Gtid_intervals &other) const {
+    return m_sources == other.m_sources;
+  }
+
+  bool operator!=(const Gtid_intervals &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  // source -> sorted, non-overlapping and non-adjacent intervals, sources
+  // with tags are placed right after the corresponding UUID
+  std::map<std::string, std::vector<Interval>> m_sources;
+};
+
+/**
+ * Set of GTIDs.
+ *
+ * All the operations are executed locally. If server verification is enabled,
+ * operations which accept an instance are also executed by that server, in
+ * case of a mismatch std::logic_error is thrown.
+ */
 class Gtid_set {
  public:
   Gtid_set() : m_normalized(true) {}
@@ -79,19 +153,27 @@ class Gtid_set {
                     true);
   }
 
+  static void set_server_verification(bool enabled);
+
+  static bool server_verification();
+
+  Gtid_set &normalize();
   Gtid_set &normalize(const mysqlshdk::mysql::IInstance &server);
 
+  Gtid_set &subtract(const Gtid_set &other);
   Gtid_set &subtract(const Gtid_set &other,
                      const mysqlshdk::mysql::IInstance &server);
   Gtid_set &add(const Gtid &gtid);
   Gtid_set &add(const Gtid_set &other);
   Gtid_set &add(const Gtid_range &gtids);
 
+  Gtid_set &intersect(const Gtid_set &other);
   Gtid_set &intersect(const Gtid_set &other,
                       const mysqlshdk::mysql::IInstance &server);
 
   Gtid_set get_gtids_from(const std::string &uuid) const;
 
+  bool contains(const Gtid_set &other) const;
   bool contains(const Gtid_set &other,
                 const mysqlshdk::mysql::IInstance &server) const;
 
@@ -121,6 +203,12 @@ class Gtid_set {
   }
 
  private:
+  Gtid_intervals intervals() const;
+
+  Gtid_set &assign(const Gtid_intervals &intervals);
+
+  Gtid_set &verify(const char *operation, std::string &&expected);
+
   std::string m_gtid_set;
   bool m_normalized;
 
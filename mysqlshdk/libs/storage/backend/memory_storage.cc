@@ -0,0 +1,489 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/backend/memory_storage.h"
+
+#include <algorithm>
+#include <cassert>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+
+class Memory_storage::File : public IFile {
+ public:
+  File() = delete;
+
+  File(Memory_storage_ptr storage, const std::string &name)
+      : m_storage(std::move(storage)), m_name(name) {}
+
+  File(const File &other) = delete;
+  File(File &&other) = default;
+
+  File &operator=(const File &other) = delete;
+  File &operator=(File &&other) = default;
+
+  ~File() override {
+    try {
+      close();
+    } catch (...) {
+    }
+  }
+
+  void open(Mode m) override {
+    if (Mode::APPEND == m) {
+      throw std::logic_error("Memory_storage::File::open() - append mode is "
+                             "not supported");
+    }
+
+    m_storage->throw_if_interrupted();
+
+    if (Mode::READ == m) {
+      m_entry = m_storage->open_for_reading(m_name);
+    } else {
+      m_entry = std::make_shared<Entry>();
+    }
+
+    m_open_mode = m;
+    m_offset = 0;
+  }
+
+  bool is_open() const override { return m_open_mode.has_value(); }
+
+  int error() const override { return 0; }
+
+  void close() override {
+    if (!m_open_mode.has_value()) {
+      return;
+    }
+
+    const auto mode = *m_open_mode;
+    auto entry = std::move(m_entry);
+
+    m_open_mode.reset();
+
+    if (Mode::READ == mode) {
+      m_storage->close_for_reading(m_name, entry);
+    } else {
+      m_storage->publish(m_name, std::move(entry));
+    }
+  }
+
+  size_t file_size() const override {
+    if (Mode::WRITE == m_open_mode) {
+      return m_entry->content.size();
+    }
+
+    if (m_entry) {
+      return m_entry->size;
+    }
+
+    const auto entry = m_storage->find(m_name);
+    return entry ? entry->size : 0;
+  }
+
+  Masked_string full_path() const override { return std::string{m_name}; }
+
+  std::string filename() const override { return m_name; }
+
+  bool exists() const override { return !!m_storage->find(m_name); }
+
+  std::unique_ptr<IDirectory> parent() const override {
+    return m_storage->directory();
+  }
+
+  off64_t seek(off64_t offset) override {
+    assert(is_open());
+
+    if (Mode::WRITE == m_open_mode) {
+      if (static_cast<size_t>(offset) != m_entry->content.size()) {
+        throw std::logic_error(
+            "Memory_storage::File::seek() - cannot seek while writing");
+      }
+    } else {
+      offset = std::clamp<off64_t>(offset, 0, m_entry->content.size());
+    }
+
+    m_offset = offset;
+    return m_offset;
+  }
+
+  off64_t tell() const override { return m_offset; }
+
+  ssize_t read(void *buffer, size_t length) override {
+    assert(Mode::READ == m_open_mode);
+
+    m_storage->throw_if_interrupted();
+
+    const auto bytes = m_entry->content.copy(static_cast<char *>(buffer),
+                                             length, m_offset);
+    m_offset += bytes;
+    return bytes;
+  }
+
+  ssize_t write(const void *buffer, size_t length) override {
+    assert(Mode::WRITE == m_open_mode);
+
+    m_storage->reserve(m_name, m_entry.get(), length);
+
+    m_entry->content.append(static_cast<const char *>(buffer), length);
+    m_offset += length;
+    return length;
+  }
+
+  bool flush() override { return true; }
+
+  bool is_local() const override { return true; }
+
+  void rename(const std::string &new_name) override {
+    if (!is_open()) {
+      m_storage->rename(m_name, new_name);
+    }
+
+    m_name = new_name;
+  }
+
+  void remove() override { m_storage->remove(m_name); }
+
+ private:
+  Memory_storage_ptr m_storage;
+  std::string m_name;
+  Entry_ptr m_entry;
+  off64_t m_offset = 0;
+  std::optional<Mode> m_open_mode;
+};
+
+class Memory_storage::Directory : public IDirectory {
+ public:
+  Directory() = delete;
+
+  explicit Directory(Memory_storage_ptr storage)
+      : m_storage(std::move(storage)) {}
+
+  Directory(const Directory &other) = delete;
+  Directory(Directory &&other) = default;
+
+  Directory &operator=(const Directory &other) = delete;
+  Directory &operator=(Directory &&other) = default;
+
+  ~Directory() override = default;
+
+  bool exists() const override { return true; }
+
+  void create() override {}
+
+  void close() override {}
+
+  Masked_string full_path() const override { return ""; }
+
+  std::unordered_set<File_info> list_files(
+      bool /* hidden_files */ = false) const override {
+    return m_storage->list_files("");
+  }
+
+  std::unordered_set<File_info> filter_files(
+      const std::string &pattern) const override {
+    return m_storage->list_files(pattern);
+  }
+
+  std::unique_ptr<IFile> file(const std::string &name,
+                              const File_options & = {}) const override {
+    return std::make_unique<File>(m_storage, name);
+  }
+
+  bool is_local() const override { return true; }
+
+  std::string join_path(const std::string &a,
+                        const std::string &b) const override {
+    return a.empty() ? b : a + "/" + b;
+  }
+
+ private:
+  Memory_storage_ptr m_storage;
+};
+
+Memory_storage::Memory_storage(std::size_t memory_limit,
+                               Is_transient is_transient)
+    : m_memory_limit(memory_limit), m_is_transient(std::move(is_transient)) {
+  if (!m_is_transient) {
+    throw std::invalid_argument("Memory_storage - predicate is not set");
+  }
+}
+
+std::size_t Memory_storage::memory_used() const {
+  std::lock_guard lock{m_mutex};
+  return m_memory_used;
+}
+
+std::size_t Memory_storage::peak_transient_memory_used() const {
+  std::lock_guard lock{m_mutex};
+  return m_peak_transient_memory_used;
+}
+
+void Memory_storage::interrupt() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_interrupted = true;
+  }
+
+  m_condition.notify_all();
+}
+
+bool Memory_storage::wait_for(const std::string &name) {
+  std::unique_lock lock{m_mutex};
+
+  m_condition.wait(lock, [this, &name]() {
+    return m_interrupted || m_files.end() != m_files.find(name);
+  });
+
+  return !m_interrupted;
+}
+
+std::unique_ptr<IDirectory> Memory_storage::directory() {
+  return std::make_unique<Directory>(shared_from_this());
+}
+
+void Memory_storage::throw_if_interrupted() const {
+  std::lock_guard lock{m_mutex};
+
+  if (m_interrupted) {
+    throw std::runtime_error("In-memory storage was interrupted");
+  }
+}
+
+void Memory_storage::reserve(const std::string &name, Entry *entry,
+                             std::size_t bytes) {
+  std::unique_lock lock{m_mutex};
+
+  if (m_is_transient(name)) {
+    m_condition.wait(lock, [this, entry, bytes]() {
+      if (m_interrupted || m_transient_memory_used + bytes <= m_memory_limit) {
+        return true;
+      }
+
+      // if there's nothing the readers can release, the writers would wait
+      // for themselves, allow one of them to exceed the limit
+      if (0 == m_pending && (!m_exceeding || entry == m_exceeding)) {
+        m_exceeding = entry;
+        return true;
+      }
+
+      return false;
+    });
+
+    if (!m_interrupted) {
+      entry->reserved += bytes;
+      m_transient_memory_used += bytes;
+      m_peak_transient_memory_used =
+          std::max(m_peak_transient_memory_used, m_transient_memory_used);
+    }
+  }
+
+  if (m_interrupted) {
+    throw std::runtime_error("In-memory storage was interrupted");
+  }
+
+  m_memory_used += bytes;
+}
+
+void Memory_storage::publish(const std::string &name, Entry_ptr entry) {
+  {
+    std::lock_guard lock{m_mutex};
+
+    entry->size = entry->content.size();
+
+    if (entry.get() == m_exceeding) {
+      m_exceeding = nullptr;
+    }
+
+    if (const auto it = m_files.find(name); m_files.end() != it) {
+      discard(it->second);
+      it->second = std::move(entry);
+    } else {
+      m_files.emplace(name, std::move(entry));
+    }
+
+    if (m_is_transient(name)) {
+      m_pending += m_files[name]->size;
+    }
+  }
+
+  m_condition.notify_all();
+}
+
+void Memory_storage::discard(const Entry_ptr &entry) {
+  // mutex is locked
+  if (entry->consumed) {
+    return;
+  }
+
+  m_memory_used -= entry->content.size();
+  m_transient_memory_used -= entry->reserved;
+  entry->reserved = 0;
+  entry->consumed = true;
+  std::string().swap(entry->content);
+}
+
+void Memory_storage::rename(const std::string &from, const std::string &to) {
+  {
+    std::lock_guard lock{m_mutex};
+
+    const auto it = m_files.find(from);
+
+    if (m_files.end() == it) {
+      throw std::runtime_error("Cannot rename '" + from +
+                               "', file does not exist");
+    }
+
+    auto entry = std::move(it->second);
+    m_files.erase(it);
+
+    if (!entry->consumed) {
+      if (m_is_transient(from)) {
+        m_pending -= entry->size;
+      }
+
+      if (m_is_transient(to)) {
+        m_pending += entry->size;
+      }
+    }
+
+    if (const auto target = m_files.find(to); m_files.end() != target) {
+      if (!target->second->consumed && m_is_transient(to)) {
+        m_pending -= target->second->size;
+      }
+
+      discard(target->second);
+      target->second = std::move(entry);
+    } else {
+      m_files.emplace(to, std::move(entry));
+    }
+  }
+
+  m_condition.notify_all();
+}
+
+void Memory_storage::remove(const std::string &name) {
+  {
+    std::lock_guard lock{m_mutex};
+
+    const auto it = m_files.find(name);
+
+    if (m_files.end() == it) {
+      return;
+    }
+
+    if (!it->second->consumed && m_is_transient(name)) {
+      m_pending -= it->second->size;
+    }
+
+    discard(it->second);
+    m_files.erase(it);
+  }
+
+  m_condition.notify_all();
+}
+
+Memory_storage::Entry_ptr Memory_storage::open_for_reading(
+    const std::string &name) {
+  std::lock_guard lock{m_mutex};
+
+  const auto it = m_files.find(name);
+
+  if (m_files.end() == it) {
+    throw std::runtime_error("Cannot open '" + name +
+                             "' for reading, file does not exist");
+  }
+
+  if (it->second->consumed) {
+    throw std::runtime_error("Cannot open '" + name +
+                             "' for reading, file was already read");
+  }
+
+  ++it->second->readers;
+
+  return it->second;
+}
+
+void Memory_storage::close_for_reading(const std::string &name,
+                                       const Entry_ptr &entry) {
+  {
+    std::lock_guard lock{m_mutex};
+
+    assert(entry->readers > 0);
+
+    if (0 != --entry->readers || entry->consumed || !m_is_transient(name)) {
+      return;
+    }
+
+    m_pending -= entry->size;
+    discard(entry);
+  }
+
+  m_condition.notify_all();
+}
+
+Memory_storage::Entry_ptr Memory_storage::find(const std::string &name) const {
+  std::lock_guard lock{m_mutex};
+
+  const auto it = m_files.find(name);
+  return m_files.end() == it ? nullptr : it->second;
+}
+
+std::unordered_set<IDirectory::File_info> Memory_storage::list_files(
+    const std::string &pattern) const {
+  throw_if_interrupted();
+
+  std::unordered_set<IDirectory::File_info> files;
+  std::lock_guard lock{m_mutex};
+
+  for (const auto &file : m_files) {
+    if (pattern.empty() || shcore::match_glob(pattern, file.first)) {
+      files.emplace(file.first, file.second->size);
+    }
+  }
+
+  return files;
+}
+
+std::unique_ptr<IFile> Memory_storage_config::file(
+    const std::string &path) const {
+  return m_storage->directory()->file(shcore::path::basename(path));
+}
+
+std::unique_ptr<IDirectory> Memory_storage_config::directory(
+    const std::string &) const {
+  return m_storage->directory();
+}
+
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_MEMORY_STORAGE_H_
+#define MYSQLSHDK_LIBS_STORAGE_BACKEND_MEMORY_STORAGE_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "mysqlshdk/libs/storage/config.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+
+/**
+ * A flat directory which holds its files in memory, allowing one thread to
+ * write the files while another one reads them.
+ *
+ * A file becomes visible once the writer closes it. Content of the transient
+ * files is released as soon as a reader closes them, these files cannot be
+ * opened again. Memory held by the transient files, including the ones which
+ * are still being written, is limited: a write which would exceed the limit
+ * blocks until some of these files are read. If none of the visible transient
+ * files can be read, a single file which is being written is allowed to exceed
+ * the limit, so that it can be finished. Writes to other files are not limited
+ * and never block.
+ */
+class Memory_storage final
+    : public std::enable_shared_from_this<Memory_storage> {
+ public:
+  using Is_transient = std::function<bool(const std::string &)>;
+
+  Memory_storage() = delete;
+
+  /**
+   * Creates the storage.
+   *
+   * @param memory_limit Number of bytes after which writes are blocked.
+   * @param is_transient Checks if a file with the given name is transient.
+   */
+  Memory_storage(std::size_t memory_limit, Is_transient is_transient);
+
+  Memory_storage(const Memory_storage &other) = delete;
+  Memory_storage(Memory_storage &&other) = delete;
+
+  Memory_storage &operator=(const Memory_storage &other) = delete;
+  Memory_storage &operator=(Memory_storage &&other) = delete;
+
+  ~Memory_storage() = default;
+
+  std::size_t memory_limit() const { return m_memory_limit; }
+
+  /**
+   * Number of bytes currently held in memory.
+   */
+  std::size_t memory_used() const;
+
+  /**
+   * Highest number of bytes held by the transient files at any given time.
+   */
+  std::size_t peak_transient_memory_used() const;
+
+  /**
+   * Wakes up all blocked writers. Once interrupted, all operations on the
+   * files throw.
+   */
+  void interrupt();
+
+  /**
+   * Waits until the given file becomes visible.
+   *
+   * @returns false if storage was interrupted
+   */
+  bool wait_for(const std::string &name);
+
+  /**
+   * Provides a handle to the directory holding the files.
+   */
+  std::unique_ptr<IDirectory> directory();
+
+ private:
+  class Directory;
+  class File;
+
+  struct Entry {
+    std::string content;
+    std::size_t size = 0;
+    std::size_t readers = 0;
+    // bytes counted towards the memory limit
+    std::size_t reserved = 0;
+    bool consumed = false;
+  };
+
+  using Entry_ptr = std::shared_ptr<Entry>;
+
+  void throw_if_interrupted() const;
+
+  void reserve(const std::string &name, Entry *entry, std::size_t bytes);
+
+  void publish(const std::string &name, Entry_ptr entry);
+
+  void discard(const Entry_ptr &entry);
+
+  void rename(const std::string &from, const std::string &to);
+
+  void remove(const std::string &name);
+
+  Entry_ptr open_for_reading(const std::string &name);
+
+  void close_for_reading(const std::string &name, const Entry_ptr &entry);
+
+  Entry_ptr find(const std::string &name) const;
+
+  std::unordered_set<IDirectory::File_info> list_files(
+      const std::string &pattern) const;
+
+  const std::size_t m_memory_limit;
+  const Is_transient m_is_transient;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::unordered_map<std::string, Entry_ptr> m_files;
+  std::size_t m_memory_used = 0;
+  // bytes held by the transient files, including the ones being written
+  std::size_t m_transient_memory_used = 0;
+  std::size_t m_peak_transient_memory_used = 0;
+  // bytes held by the visible transient files which were not read yet
+  std::size_t m_pending = 0;
+  // file which is being written and is allowed to exceed the limit
+  const Entry *m_exceeding = nullptr;
+  bool m_interrupted = false;
+};
+
+using Memory_storage_ptr = std::shared_ptr<Memory_storage>;
+
+/**
+ * Configuration which directs all files and directories to the given storage,
+ * regardless of their paths.
+ */
+class Memory_storage_config : public Config {
+ public:
+  Memory_storage_config() = delete;
+
+  explicit Memory_storage_config(Memory_storage_ptr storage)
+      : m_storage(std::move(storage)) {}
+
+  Memory_storage_config(const Memory_storage_config &) = delete;
+  Memory_storage_config(Memory_storage_config &&) = default;
+
+  Memory_storage_config &operator=(const Memory_storage_config &) = delete;
+  Memory_storage_config &operator=(Memory_storage_config &&) = default;
+
+  ~Memory_storage_config() override = default;
+
+  bool valid() const override { return !!m_storage; }
+
+  const Memory_storage_ptr &storage() const { return m_storage; }
+
+ private:
+  std::string describe_self() const override { return "in-memory storage"; }
+
+  std::string describe_url(const std::string &) const override { return {}; }
+
+  std::unique_ptr<IFile> file(const std::string &path) const override;
+
+  std::unique_ptr<IDirectory> directory(const std::string &) const override;
+
+  Memory_storage_ptr m_storage;
+};
+
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_BACKEND_MEMORY_STORAGE_H_
@@ -25,9 +25,18 @@
 
 #include "mysqlshdk/libs/storage/backend/object_storage.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
 
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/rest/error_codes.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 
 namespace mysqlshdk {
@@ -58,6 +67,184 @@ bool Directory::exists() const {
   return !list_multipart_uploads().empty();
 }
 
+/**
+ * Uploads parts of a multipart upload in the background. Each thread uses its
+ * own container (and thus its own connection), up to the given number of parts
+ * can be queued or in progress at the same time.
+ */
+class Object::Writer::Uploader final {
+ public:
+  Uploader() = delete;
+
+  Uploader(const Config_ptr &config, const Multipart_object &object,
+           std::size_t max_parts)
+      : m_config(config), m_object(object), m_max_parts(max_parts) {
+    m_threads.reserve(m_max_parts);
+
+    for (std::size_t i = 0; i < m_max_parts; ++i) {
+      m_threads.emplace_back(
+          mysqlsh::spawn_scoped_thread([this]() { upload_parts(); }));
+    }
+  }
+
+  Uploader(const Uploader &) = delete;
+  Uploader(Uploader &&) = delete;
+
+  Uploader &operator=(const Uploader &) = delete;
+  Uploader &operator=(Uploader &&) = delete;
+
+  ~Uploader() {
+    {
+      std::lock_guard lock{m_mutex};
+      // parts which were not picked up yet are discarded
+      m_stop = true;
+      m_queue.clear();
+    }
+
+    m_cv.notify_all();
+
+    for (auto &thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  /**
+   * Queues the part for upload, blocks if there are too many parts in flight.
+   * Data is moved out of the given buffer, which is replaced with a recycled
+   * one.
+   *
+   * @returns false if any of the previous uploads has failed
+   */
+  bool push(std::size_t part_num, std::string *data) {
+    std::unique_lock lock{m_mutex};
+
+    m_cv.wait(lock, [this]() {
+      return m_error || m_queue.size() + m_in_progress < m_max_parts;
+    });
+
+    if (m_error) {
+      return false;
+    }
+
+    m_queue.emplace_back(part_num, std::move(*data));
+
+    if (m_free.empty()) {
+      data->clear();
+    } else {
+      *data = std::move(m_free.back());
+      m_free.pop_back();
+    }
+
+    lock.unlock();
+    m_cv.notify_all();
+
+    return true;
+  }
+
+  /**
+   * Waits until all queued parts are uploaded.
+   *
+   * @returns false if any of the uploads has failed
+   */
+  bool wait() {
+    std::unique_lock lock{m_mutex};
+
+    m_cv.wait(lock, [this]() {
+      return m_error || (m_queue.empty() && 0 == m_in_progress);
+    });
+
+    return !m_error;
+  }
+
+  std::exception_ptr error() const {
+    std::lock_guard lock{m_mutex};
+    return m_error;
+  }
+
+  /**
+   * Provides the uploaded parts, sorted by their numbers.
+   */
+  std::vector<Multipart_object_part> parts() {
+    std::lock_guard lock{m_mutex};
+
+    std::sort(m_parts.begin(), m_parts.end(),
+              [](const auto &l, const auto &r) {
+                return l.part_num < r.part_num;
+              });
+
+    return m_parts;
+  }
+
+ private:
+  void upload_parts() {
+    const auto container = m_config->container();
+
+    while (true) {
+      std::pair<std::size_t, std::string> part;
+
+      {
+        std::unique_lock lock{m_mutex};
+
+        m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+
+        if (m_stop) {
+          return;
+        }
+
+        part = std::move(m_queue.front());
+        m_queue.pop_front();
+        ++m_in_progress;
+      }
+
+      std::optional<Multipart_object_part> uploaded;
+      std::exception_ptr error;
+
+      try {
+        uploaded = container->upload_part(m_object, part.first,
+                                          part.second.data(),
+                                          part.second.size());
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      {
+        std::lock_guard lock{m_mutex};
+
+        --m_in_progress;
+
+        if (uploaded) {
+          m_parts.emplace_back(std::move(*uploaded));
+        } else if (!m_error) {
+          m_error = error;
+          // nothing more is going to be uploaded
+          m_queue.clear();
+        }
+
+        // buffer is going to be reused
+        part.second.clear();
+        m_free.emplace_back(std::move(part.second));
+      }
+
+      m_cv.notify_all();
+    }
+  }
+
+  Config_ptr m_config;
+  const Multipart_object m_object;
+  const std::size_t m_max_parts;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<std::pair<std::size_t, std::string>> m_queue;
+  std::size_t m_in_progress = 0;
+  std::vector<std::string> m_free;
+  std::vector<Multipart_object_part> m_parts;
+  std::exception_ptr m_error;
+  bool m_stop = false;
+
+  std::vector<std::thread> m_threads;
+};
+
 void Directory::create() { m_created = true; }
 
 std::unordered_set<IDirectory::File_info> Directory::list_files(
@@ -334,9 +521,37 @@ Object::Writer::Writer(Object *owner, Multipart_object *object)
       throw rest::to_exception(error);
     }
 
+    // parts are uploaded in the background and can complete out of order, if
+    // upload was interrupted there may be gaps, only the parts preceding the
+    // first gap are kept, the remaining ones are going to be uploaded again
+    std::sort(m_parts.begin(), m_parts.end(),
+              [](const auto &l, const auto &r) {
+                return l.part_num < r.part_num;
+              });
+
+    std::size_t contiguous = 0;
+
+    while (contiguous < m_parts.size() &&
+           m_parts[contiguous].part_num == contiguous + 1) {
+      ++contiguous;
+    }
+
+    if (contiguous < m_parts.size()) {
+      log_warning(
+          "Multipart upload of '%s' is missing part %zu, %zu part(s) uploaded "
+          "after it are going to be uploaded again",
+          m_multipart.name.c_str(), contiguous + 1,
+          m_parts.size() - contiguous);
+      m_parts.resize(contiguous);
+    }
+
     for (const auto &part : m_parts) {
       m_size += part.size;
     }
+
+    m_next_part_num = m_parts.size() + 1;
+
+    start_uploader();
   }
 }
 
@@ -347,6 +562,69 @@ Object::Writer::~Writer() {
   abort_multipart_upload("unexpected inner state");
 }
 
+void Object::Writer::start_uploader() {
+  if (const auto parts = m_object->m_container->config()->max_parts_in_flight();
+      parts > 0) {
+    m_uploader = std::make_unique<Uploader>(m_object->m_container->config(),
+                                            m_multipart, parts);
+  }
+}
+
+void Object::Writer::upload_part(const char *data, size_t size) {
+  try {
+    m_parts.push_back(m_object->m_container->upload_part(
+        m_multipart, m_next_part_num++, data, size));
+  } catch (const rest::Response_error &error) {
+    abort_multipart_upload("failure uploading part", error.format());
+    throw rest::to_exception(error);
+  }
+}
+
+void Object::Writer::upload_buffer() {
+  if (m_uploader) {
+    if (!m_uploader->push(m_next_part_num++, &m_buffer)) {
+      handle_upload_error(m_uploader->error());
+    }
+  } else {
+    upload_part(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+  }
+}
+
+void Object::Writer::wait_for_uploads() {
+  if (!m_uploader) {
+    return;
+  }
+
+  if (!m_uploader->wait()) {
+    handle_upload_error(m_uploader->error());
+  }
+
+  auto parts = m_uploader->parts();
+  m_uploader.reset();
+
+  m_parts.insert(m_parts.end(), std::make_move_iterator(parts.begin()),
+                 std::make_move_iterator(parts.end()));
+}
+
+void Object::Writer::handle_upload_error(std::exception_ptr error) {
+  // remaining uploads need to be stopped before the upload is cancelled
+  m_uploader.reset();
+
+  try {
+    std::rethrow_exception(error);
+  } catch (const rest::Response_error &e) {
+    abort_multipart_upload("failure uploading part", e.format());
+    throw rest::to_exception(e);
+  } catch (const rest::Connection_error &e) {
+    abort_multipart_upload("failure uploading part", e.what());
+    throw shcore::Exception::runtime_error(e.what());
+  } catch (const std::exception &e) {
+    abort_multipart_upload("failure uploading part", e.what());
+    throw;
+  }
+}
+
 off64_t Object::Writer::seek(off64_t /*offset*/) { return 0; }
 
 off64_t Object::Writer::tell() const { return size(); }
@@ -365,6 +643,8 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
     }
 
     m_is_multipart = true;
+
+    start_uploader();
   }
 
   size_t incoming_offset = 0;
@@ -373,30 +653,21 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
   // This loops handles the upload of N number of chunks of size
   // MY_MAX_PART_SIZE including the buffered data and the incoming data
   while (to_send > MY_MAX_PART_SIZE) {
-    const char *part = nullptr;
-
-    if (!m_buffer.empty()) {
-      // BUFFERED DATA: fills the buffer and sends it
+    if (!m_buffer.empty() || m_uploader) {
+      // BUFFERED DATA: fills the buffer and sends it, parts uploaded in the
+      // background are always buffered, as the incoming buffer is going to be
+      // reused by the caller
       const auto buffer_space = MY_MAX_PART_SIZE - m_buffer.size();
       m_buffer.append(incoming + incoming_offset, buffer_space);
-
-      part = m_buffer.data();
       incoming_offset += buffer_space;
+
+      upload_buffer();
     } else {
       // NO BUFFERED DATA: sends the data directly from the incoming buffer
-      part = incoming + incoming_offset;
+      upload_part(incoming + incoming_offset, MY_MAX_PART_SIZE);
       incoming_offset += MY_MAX_PART_SIZE;
     }
 
-    try {
-      m_parts.push_back(m_object->m_container->upload_part(
-          m_multipart, m_parts.size() + 1, part, MY_MAX_PART_SIZE));
-    } catch (const rest::Response_error &error) {
-      abort_multipart_upload("failure uploading part", error.format());
-      throw rest::to_exception(error);
-    }
-
-    m_buffer.clear();
     to_send -= MY_MAX_PART_SIZE;
   }
 
@@ -412,11 +683,14 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
 
 void Object::Writer::close() {
   if (m_is_multipart) {
-    // MULTIPART UPLOAD STARTED: Sends last part if any and commits the upload
+    // MULTIPART UPLOAD STARTED: Waits for the background uploads, sends last
+    // part if any and commits the upload
+    wait_for_uploads();
+
     try {
       if (!m_buffer.empty()) {
         m_parts.push_back(m_object->m_container->upload_part(
-            m_multipart, m_parts.size() + 1, m_buffer.data(), m_buffer.size()));
+            m_multipart, m_next_part_num++, m_buffer.data(), m_buffer.size()));
       }
 
       m_object->m_container->commit_multipart_upload(m_multipart, m_parts);
@@ -446,9 +720,11 @@ void Object::Writer::close() {
 
 void Object::Writer::reset() {
   // clean up
+  m_uploader.reset();
   m_is_multipart = false;
   m_buffer.clear();
   m_parts.clear();
+  m_next_part_num = 1;
 }
 
 void Object::Writer::abort_multipart_upload(const char *context,
@@ -482,6 +758,134 @@ void Object::Writer::abort_multipart_upload(const char *context,
   }
 }
 
+/**
+ * A block of an object, fetched in the background.
+ */
+struct Object::Reader::Block {
+  size_t offset = 0;
+  size_t size = 0;
+  std::string data;
+  bool ready = false;
+  std::exception_ptr error;
+};
+
+/**
+ * Fetches blocks of an object in the background. Each thread uses its own
+ * container (and thus its own connection), blocks are fetched in the order
+ * they were requested.
+ */
+class Object::Reader::Prefetcher final {
+ public:
+  Prefetcher() = delete;
+
+  Prefetcher(const Config_ptr &config, const std::string &name,
+             std::size_t threads)
+      : m_config(config), m_name(name) {
+    m_threads.reserve(threads);
+
+    for (std::size_t i = 0; i < threads; ++i) {
+      m_threads.emplace_back(
+          mysqlsh::spawn_scoped_thread([this]() { fetch_blocks(); }));
+    }
+  }
+
+  Prefetcher(const Prefetcher &) = delete;
+  Prefetcher(Prefetcher &&) = delete;
+
+  Prefetcher &operator=(const Prefetcher &) = delete;
+  Prefetcher &operator=(Prefetcher &&) = delete;
+
+  ~Prefetcher() {
+    {
+      std::lock_guard lock{m_mutex};
+      m_stop = true;
+      m_queue.clear();
+    }
+
+    m_cv.notify_all();
+
+    for (auto &thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  void fetch(std::shared_ptr<Block> block) {
+    {
+      std::lock_guard lock{m_mutex};
+      m_queue.emplace_back(std::move(block));
+    }
+
+    m_cv.notify_all();
+  }
+
+  /**
+   * Removes all blocks which were not picked up yet.
+   */
+  void cancel() {
+    std::lock_guard lock{m_mutex};
+    m_queue.clear();
+  }
+
+  /**
+   * Waits until the given block is fetched.
+   */
+  void wait(const Block &block) {
+    std::unique_lock lock{m_mutex};
+    m_cv.wait(lock, [&block]() { return block.ready; });
+  }
+
+ private:
+  void fetch_blocks() {
+    const auto container = m_config->container();
+
+    while (true) {
+      std::shared_ptr<Block> block;
+
+      {
+        std::unique_lock lock{m_mutex};
+
+        m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+
+        if (m_stop) {
+          return;
+        }
+
+        block = std::move(m_queue.front());
+        m_queue.pop_front();
+      }
+
+      std::exception_ptr error;
+
+      try {
+        block->data.resize(block->size);
+        rest::Static_char_ref_buffer buffer(block->data.data(), block->size);
+        block->data.resize(container->get_object(
+            m_name, &buffer, block->offset, block->offset + block->size - 1));
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      {
+        std::lock_guard lock{m_mutex};
+        block->error = error;
+        block->ready = true;
+      }
+
+      m_cv.notify_all();
+    }
+  }
+
+  Config_ptr m_config;
+  const std::string m_name;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<std::shared_ptr<Block>> m_queue;
+  bool m_stop = false;
+
+  std::vector<std::thread> m_threads;
+};
+
 Object::Reader::Reader(Object *owner) : File_handler(owner), m_offset(0) {
   try {
     m_size = m_object->m_container->head_object(m_object->full_path().real());
@@ -501,6 +905,12 @@ Object::Reader::Reader(Object *owner) : File_handler(owner), m_offset(0) {
   }
 }
 
+Object::Reader::~Reader() {
+  // blocks which are being fetched need to be finished before they are
+  // released
+  m_prefetcher.reset();
+}
+
 off64_t Object::Reader::seek(off64_t offset) {
   const off64_t fsize = m_size;
   m_offset = std::min(offset, fsize);
@@ -512,31 +922,156 @@ off64_t Object::Reader::tell() const {
 }
 
 ssize_t Object::Reader::read(void *buffer, size_t length) {
-  const size_t first = m_offset;
-  const size_t last_unbounded = m_offset + length - 1;
   const off64_t fsize = m_size;
 
-  if (m_offset >= fsize) return 0;
+  if (m_offset >= fsize || 0 == length) return 0;
+
+  update_read_ahead_window();
+
+  const auto target = reinterpret_cast<char *>(buffer);
+  size_t read = 0;
 
+  if (m_read_ahead_window) {
+    if (m_blocks.empty()) {
+      m_next_fetch = m_offset;
+    }
+
+    fetch_blocks();
+    read = read_blocks(target, length);
+  } else {
+    read = read_object(target, length);
+  }
+
+  m_offset += read;
+  m_last_read_end = m_offset;
+
+  return read;
+}
+
+size_t Object::Reader::read_object(char *buffer, size_t length) {
+  const size_t first = m_offset;
+  const size_t last_unbounded = m_offset + length - 1;
   const size_t last = std::min(m_size - 1, last_unbounded);
 
   // Creates a response buffer that writes data directly to buffer
-  rest::Static_char_ref_buffer rbuffer(reinterpret_cast<char *>(buffer),
-                                       length);
+  rest::Static_char_ref_buffer rbuffer(buffer, length);
 
-  size_t read = 0;
   try {
-    read = m_object->m_container->get_object(m_object->full_path().real(),
+    return m_object->m_container->get_object(m_object->full_path().real(),
                                              &rbuffer, first, last);
   } catch (const rest::Response_error &error) {
     throw rest::to_exception(error);
+  } catch (const rest::Connection_error &error) {
+    throw shcore::Exception::runtime_error(error.what());
   }
+}
 
-  m_offset += read;
+void Object::Reader::update_read_ahead_window() {
+  const auto &config = m_object->m_container->config();
+  const auto block_size = config->read_ahead_block_size();
+  const auto max_window = config->max_reads_in_flight();
+
+  if (!max_window || !block_size || m_size <= block_size) {
+    // read-ahead is disabled or the whole object fits in a single read
+    return;
+  }
+
+  if (static_cast<size_t>(m_offset) != m_last_read_end) {
+    // random access, read-ahead is restarted once reads are sequential again
+    discard_blocks();
+    m_read_ahead_window = 0;
+    return;
+  }
+
+  if (0 == m_last_read_end) {
+    // first read, wait until access is known to be sequential
+    return;
+  }
+
+  // window grows with each sequential read
+  if (m_read_ahead_window < max_window) {
+    m_read_ahead_window = std::min(max_window, 2 * m_read_ahead_window + 1);
+  }
+
+  if (!m_prefetcher) {
+    m_prefetcher = std::make_unique<Prefetcher>(
+        config, m_object->full_path().real(), max_window);
+  }
+}
+
+void Object::Reader::fetch_blocks() {
+  const auto block_size =
+      m_object->m_container->config()->read_ahead_block_size();
+
+  while (m_blocks.size() < m_read_ahead_window && m_next_fetch < m_size) {
+    auto block = std::make_shared<Block>();
+    block->offset = m_next_fetch;
+    block->size = std::min(block_size, m_size - m_next_fetch);
+
+    m_next_fetch += block->size;
+
+    m_blocks.emplace_back(block);
+    m_prefetcher->fetch(std::move(block));
+  }
+}
+
+size_t Object::Reader::read_blocks(char *buffer, size_t length) {
+  size_t read = 0;
+  size_t offset = m_offset;
+
+  while (read < length && !m_blocks.empty()) {
+    const auto block = m_blocks.front();
+
+    m_prefetcher->wait(*block);
+
+    if (block->error) {
+      discard_blocks();
+      m_read_ahead_window = 0;
+
+      try {
+        std::rethrow_exception(block->error);
+      } catch (const rest::Response_error &error) {
+        throw rest::to_exception(error);
+      } catch (const rest::Connection_error &error) {
+        throw shcore::Exception::runtime_error(error.what());
+      }
+    }
+
+    const auto block_offset = offset - block->offset;
+    const auto available = block->data.size() > block_offset
+                               ? block->data.size() - block_offset
+                               : 0;
+    const auto size = std::min(length - read, available);
+
+    std::memcpy(buffer + read, block->data.data() + block_offset, size);
+    read += size;
+    offset += size;
+
+    if (offset >= block->offset + block->data.size()) {
+      // block was fully consumed
+      m_blocks.pop_front();
+
+      if (block->data.size() < block->size) {
+        // object is shorter than expected, there's nothing more to read
+        discard_blocks();
+        break;
+      }
+
+      fetch_blocks();
+    }
+  }
 
   return read;
 }
 
+void Object::Reader::discard_blocks() {
+  if (m_prefetcher) {
+    m_prefetcher->cancel();
+  }
+
+  m_blocks.clear();
+}
+
 }  // namespace object_storage
 }  // namespace backend
 }  // namespace storage
@@ -26,9 +26,12 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_H_
 
+#include <deque>
+#include <exception>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
@@ -305,15 +308,29 @@ class Object : public mysqlshdk::storage::IFile {
     void close();
 
    private:
+    class Uploader;
+
     void reset();
 
     void abort_multipart_upload(const char *context,
                                 const std::string &error = {});
 
+    void start_uploader();
+
+    void upload_part(const char *data, size_t size);
+
+    void upload_buffer();
+
+    void wait_for_uploads();
+
+    [[noreturn]] void handle_upload_error(std::exception_ptr error);
+
     std::string m_buffer;
     bool m_is_multipart;
     Multipart_object m_multipart;
     std::vector<Multipart_object_part> m_parts;
+    size_t m_next_part_num = 1;
+    std::unique_ptr<Uploader> m_uploader;
   };
 
   /**
@@ -322,14 +339,34 @@ class Object : public mysqlshdk::storage::IFile {
   class Reader : public File_handler {
    public:
     explicit Reader(Object *owner);
-    ~Reader() override = default;
+    ~Reader() override;
 
     off64_t seek(off64_t offset);
     off64_t tell() const;
     ssize_t read(void *buffer, size_t length);
 
    private:
+    struct Block;
+    class Prefetcher;
+
+    size_t read_object(char *buffer, size_t length);
+
+    void update_read_ahead_window();
+
+    void fetch_blocks();
+
+    size_t read_blocks(char *buffer, size_t length);
+
+    void discard_blocks();
+
     off64_t m_offset;
+    // end offset of the previous read, used to detect sequential access
+    size_t m_last_read_end = 0;
+    size_t m_read_ahead_window = 0;
+    // offset of the next block to be fetched
+    size_t m_next_fetch = 0;
+    std::deque<std::shared_ptr<Block>> m_blocks;
+    std::unique_ptr<Prefetcher> m_prefetcher;
   };
 
   std::unique_ptr<Writer> m_writer;
@@ -92,7 +92,7 @@ class Container {
    *
    * @returns A list of objects.
    */
-  std::vector<Object_details> list_objects(
+  virtual std::vector<Object_details> list_objects(
       const std::string &prefix = "", size_t limit = 0, bool recursive = true,
       const Object_details::Fields_mask &fields = Object_details::NAME_SIZE,
       std::unordered_set<std::string> *out_prefixes = nullptr);
@@ -107,7 +107,7 @@ class Container {
    *
    * @throws Response_error if the object does not exist.
    */
-  size_t head_object(const std::string &object_name);
+  virtual size_t head_object(const std::string &object_name);
 
   /**
    * Deletes an object from the bucket.
@@ -116,7 +116,7 @@ class Container {
    *
    * @throws Response_error if the given object does not exist.
    */
-  void delete_object(const std::string &object_name);
+  virtual void delete_object(const std::string &object_name);
 
   /**
    * Determines whether the object renaming is allowed.
@@ -129,7 +129,8 @@ class Container {
    * @param src_name: Current name.
    * @param new_name: New name.
    */
-  void rename_object(const std::string &src_name, const std::string &new_name);
+  virtual void rename_object(const std::string &src_name,
+                             const std::string &new_name);
 
   /**
    * Creates an object on the bucket.
@@ -138,8 +139,8 @@ class Container {
    * @param data: Buffer containing the information to be stored on the object.
    * @param size: The length of the data contained on the buffer.
    */
-  void put_object(const std::string &object_name, const char *data,
-                  size_t size);
+  virtual void put_object(const std::string &object_name, const char *data,
+                          size_t size);
 
   /**
    * Retrieves content data from an object.
@@ -159,10 +160,10 @@ class Container {
    * from-: Retrieves all the data starting at from.
    * -to: Retrieves the last 'to' bytes. Use optional<> overload.
    */
-  size_t get_object(const std::string &object_name,
-                    mysqlshdk::rest::Base_response_buffer *buffer,
-                    const std::optional<size_t> &from_byte,
-                    const std::optional<size_t> &to_byte);
+  virtual size_t get_object(const std::string &object_name,
+                            mysqlshdk::rest::Base_response_buffer *buffer,
+                            const std::optional<size_t> &from_byte,
+                            const std::optional<size_t> &to_byte);
   size_t get_object(const std::string &object_name,
                     mysqlshdk::rest::Base_response_buffer *buffer,
                     size_t from_byte, size_t to_byte);
@@ -184,7 +185,8 @@ class Container {
    *
    * @returns A list of multipart objects.
    */
-  std::vector<Multipart_object> list_multipart_uploads(size_t limit = 0);
+  virtual std::vector<Multipart_object> list_multipart_uploads(
+      size_t limit = 0);
 
   /**
    * Retrieves information about the parts of a multipart object being uploaded.
@@ -196,7 +198,7 @@ class Container {
    *
    * @returns the list of uploaded parts for the given object.
    */
-  std::vector<Multipart_object_part> list_multipart_uploaded_parts(
+  virtual std::vector<Multipart_object_part> list_multipart_uploaded_parts(
       const Multipart_object &object, size_t limit = 0);
 
   /**
@@ -207,7 +209,8 @@ class Container {
    * @returns a Multipart_object with the information of the object being
    * uploaded.
    */
-  Multipart_object create_multipart_upload(const std::string &object_name);
+  virtual Multipart_object create_multipart_upload(
+      const std::string &object_name);
 
   /**
    * Uploads a part for an object being uploaded.
@@ -218,9 +221,9 @@ class Container {
    *
    * @returns the part summary of the uploaded part.
    */
-  Multipart_object_part upload_part(const Multipart_object &object,
-                                    size_t part_num, const char *body,
-                                    size_t size);
+  virtual Multipart_object_part upload_part(const Multipart_object &object,
+                                            size_t part_num, const char *body,
+                                            size_t size);
 
   /**
    * Finishes a multipart object upload.
@@ -228,8 +231,9 @@ class Container {
    * @param object: the multipart object to be completed
    * @param parts: the summary of the parts to be included on the object.
    */
-  void commit_multipart_upload(const Multipart_object &object,
-                               const std::vector<Multipart_object_part> &parts);
+  virtual void commit_multipart_upload(
+      const Multipart_object &object,
+      const std::vector<Multipart_object_part> &parts);
 
   /**
    * Aborts a multipart object upload.
@@ -43,6 +43,10 @@ class Object_storage_options;
 class Bucket_options;
 class Config : public storage::Config, public rest::Signed_rest_service_config {
  public:
+  static constexpr std::size_t DEFAULT_MAX_PARTS_IN_FLIGHT = 2;
+  static constexpr std::size_t DEFAULT_READ_AHEAD_BLOCK_SIZE = 4 * 1024 * 1024;
+  static constexpr std::size_t DEFAULT_MAX_READS_IN_FLIGHT = 4;
+
   Config() = delete;
 
   Config(const Config &) = delete;
@@ -60,6 +64,37 @@ class Config : public storage::Config, public rest::Signed_rest_service_config {
   std::size_t part_size() const { return m_part_size; }
   void set_part_size(std::size_t size) { m_part_size = size; }
 
+  /**
+   * Maximum number of parts of a multipart upload which are uploaded in the
+   * background, while the next part is being written. Each of these parts is
+   * held in memory until its upload is finished. If set to 0, parts are
+   * uploaded synchronously.
+   */
+  std::size_t max_parts_in_flight() const { return m_max_parts_in_flight; }
+  void set_max_parts_in_flight(std::size_t parts) {
+    m_max_parts_in_flight = parts;
+  }
+
+  /**
+   * Size of a single block which is fetched in the background when an object
+   * is read sequentially.
+   */
+  std::size_t read_ahead_block_size() const { return m_read_ahead_block_size; }
+  void set_read_ahead_block_size(std::size_t size) {
+    m_read_ahead_block_size = size;
+  }
+
+  /**
+   * Maximum number of blocks which are fetched in the background when an
+   * object is read sequentially, the read-ahead window grows up to this value
+   * as long as reads are sequential. If set to 0, each read is executed
+   * synchronously.
+   */
+  std::size_t max_reads_in_flight() const { return m_max_reads_in_flight; }
+  void set_max_reads_in_flight(std::size_t reads) {
+    m_max_reads_in_flight = reads;
+  }
+
   virtual const std::string &hash() const = 0;
 
   virtual std::unique_ptr<Container> container() const = 0;
@@ -70,6 +105,9 @@ class Config : public storage::Config, public rest::Signed_rest_service_config {
   std::string m_container_name;
   std::string m_config_file;
   std::size_t m_part_size;
+  std::size_t m_max_parts_in_flight = DEFAULT_MAX_PARTS_IN_FLIGHT;
+  std::size_t m_read_ahead_block_size = DEFAULT_READ_AHEAD_BLOCK_SIZE;
+  std::size_t m_max_reads_in_flight = DEFAULT_MAX_READS_IN_FLIGHT;
 
  private:
   std::string describe_url(const std::string &url) const override;
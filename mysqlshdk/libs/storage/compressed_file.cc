@@ -29,6 +29,7 @@
 #include <utility>
 
 #include "mysqlshdk/libs/storage/compression/gz_file.h"
+#include "mysqlshdk/libs/storage/compression/lz4_file.h"
 #include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -38,10 +39,11 @@ namespace storage {
 
 namespace {
 
-#define COMPRESSIONS     \
-  X(NONE, "none", "")    \
-  X(GZIP, "gzip", ".gz") \
-  X(ZSTD, "zstd", ".zst")
+#define COMPRESSIONS      \
+  X(NONE, "none", "")     \
+  X(GZIP, "gzip", ".gz")  \
+  X(ZSTD, "zstd", ".zst") \
+  X(LZ4, "lz4", ".lz4")
 
 }  // namespace
 
@@ -142,7 +144,8 @@ Compression from_extension(const std::string &e) {
   throw std::invalid_argument("Unknown compression type: " + e);
 }
 
-std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c) {
+std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c,
+                                 const Compression_options &options) {
   std::unique_ptr<IFile> result;
 
   switch (c) {
@@ -151,11 +154,17 @@ std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c) {
       break;
 
     case Compression::GZIP:
-      result = std::make_unique<compression::Gz_file>(std::move(file));
+      result =
+          std::make_unique<compression::Gz_file>(std::move(file), options);
       break;
 
     case Compression::ZSTD:
-      result = std::make_unique<compression::Zstd_file>(std::move(file));
+      result =
+          std::make_unique<compression::Zstd_file>(std::move(file), options);
+      break;
+
+    case Compression::LZ4:
+      result = std::make_unique<compression::Lz4_file>(std::move(file));
       break;
 
     default:
@@ -26,7 +26,9 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_COMPRESSED_FILE_H_
 #define MYSQLSHDK_LIBS_STORAGE_COMPRESSED_FILE_H_
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "mysqlshdk/libs/storage/ifile.h"
@@ -34,7 +36,44 @@
 namespace mysqlshdk {
 namespace storage {
 
-enum class Compression { NONE, GZIP, ZSTD };
+enum class Compression { NONE, GZIP, ZSTD, LZ4 };
+
+namespace compression {
+class Gz_thread_pool;
+class Zstd_thread_pool;
+}  // namespace compression
+
+/**
+ * Options used when writing compressed files.
+ */
+struct Compression_options {
+  /**
+   * Number of worker threads used to compress a single file. If set to 0, data
+   * is compressed by the thread which writes it. Gzip files written using
+   * multiple workers are also decompressed using this number of workers.
+   */
+  std::size_t threads = 0;
+
+  /**
+   * If set, zstd workers are taken from this pool, which is shared by all files
+   * using these options.
+   */
+  std::shared_ptr<compression::Zstd_thread_pool> zstd_thread_pool;
+
+  /**
+   * If set, gzip blocks are compressed by workers from this pool, which is
+   * shared by all files using these options. Otherwise, each file creates its
+   * own pool.
+   */
+  std::shared_ptr<compression::Gz_thread_pool> gz_thread_pool;
+
+  /**
+   * If set, data is split into independently decompressable frames holding
+   * this number of uncompressed bytes, and an index of these frames is stored
+   * in the file, allowing to seek() when reading. Used by zstd.
+   */
+  std::size_t frame_size = 0;
+};
 
 class Compressed_file : public IFile {
  public:
@@ -74,6 +113,13 @@ class Compressed_file : public IFile {
    */
   size_t latest_io_size() const;
 
+  /**
+   * Provides the size of uncompressed data, if it can be obtained without
+   * decompressing the whole file. In such case, seek() is supported when
+   * reading. File has to be open for reading.
+   */
+  virtual std::optional<size_t> uncompressed_size() { return {}; }
+
  protected:
   void start_io();
 
@@ -94,7 +140,8 @@ std::string to_string(Compression c);
 std::string get_extension(Compression c);
 Compression from_extension(const std::string &e);
 
-std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c);
+std::unique_ptr<IFile> make_file(std::unique_ptr<IFile> file, Compression c,
+                                 const Compression_options &options = {});
 
 }  // namespace storage
 }  // namespace mysqlshdk
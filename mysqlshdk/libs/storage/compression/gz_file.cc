@@ -26,17 +26,114 @@
 #include "mysqlshdk/libs/storage/compression/gz_file.h"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <utility>
 
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/utils/logger.h"
 
 namespace mysqlshdk {
 namespace storage {
 namespace compression {
 
-Gz_file::Gz_file(std::unique_ptr<IFile> file)
-    : Compressed_file(std::move(file)) {}
+namespace {
+
+constexpr int k_compression_level = 1;
+
+// Header of a gzip member written by a worker. The FEXTRA flag is set, and
+// the extra field holds a single 'MS' subfield, with the size of the whole
+// member stored as a 32-bit little endian integer.
+constexpr uint8_t k_member_header[] = {
+    0x1f, 0x8b,              // ID1, ID2
+    Z_DEFLATED,              // CM
+    0x04,                    // FLG: FEXTRA
+    0x00, 0x00, 0x00, 0x00,  // MTIME: not available
+    0x04,                    // XFL: fastest algorithm
+    0xff,                    // OS: unknown
+    0x08, 0x00,              // XLEN
+    'M',  'S',               // SI1, SI2
+    0x04, 0x00,              // LEN
+};
+
+constexpr size_t k_member_header_size = sizeof(k_member_header) + 4;
+
+// CRC32 and ISIZE
+constexpr size_t k_member_trailer_size = 8;
+
+// sanity check, members written by workers are much smaller than this
+constexpr uint32_t k_max_member_size = 256 * 1024 * 1024;
+
+inline void store_uint32(uint32_t value, uint8_t *out) {
+  out[0] = value & 0xff;
+  out[1] = (value >> 8) & 0xff;
+  out[2] = (value >> 16) & 0xff;
+  out[3] = (value >> 24) & 0xff;
+}
+
+inline uint32_t load_uint32(const uint8_t *in) {
+  return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8) |
+         (static_cast<uint32_t>(in[2]) << 16) |
+         (static_cast<uint32_t>(in[3]) << 24);
+}
+
+/**
+ * Provides size of the member, if the given header was written by a worker.
+ */
+std::optional<uint32_t> member_size(const uint8_t *header) {
+  if (0 != memcmp(header, k_member_header, 3) ||
+      k_member_header[3] != header[3] ||
+      0 != memcmp(header + 10, k_member_header + 10, 6)) {
+    return {};
+  }
+
+  const auto size = load_uint32(header + sizeof(k_member_header));
+
+  if (size < k_member_header_size + k_member_trailer_size ||
+      size > k_max_member_size) {
+    return {};
+  }
+
+  return size;
+}
+
+}  // namespace
+
+Gz_thread_pool::Gz_thread_pool(std::size_t threads) {
+  if (0 == threads) {
+    throw std::invalid_argument(
+        "gzip thread pool requires at least one thread");
+  }
+
+  m_threads.reserve(threads);
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    m_threads.emplace_back(mysqlsh::spawn_scoped_thread([this]() {
+      // empty task is pushed on shutdown
+      while (const auto task = m_tasks.pop()) {
+        task();
+      }
+    }));
+  }
+}
+
+Gz_thread_pool::~Gz_thread_pool() {
+  m_tasks.shutdown(m_threads.size());
+
+  for (auto &thread : m_threads) {
+    thread.join();
+  }
+}
+
+void Gz_thread_pool::add_task(std::function<void()> &&task) {
+  m_tasks.push(std::move(task));
+}
+
+Gz_file::Gz_file(std::unique_ptr<IFile> file,
+                 const Compression_options &options)
+    : Compressed_file(std::move(file)),
+      m_workers(options.threads),
+      m_thread_pool(options.gz_thread_pool) {}
 
 Gz_file::~Gz_file() {
   try {
@@ -47,6 +144,16 @@ Gz_file::~Gz_file() {
 }
 
 ssize_t Gz_file::read(void *buffer, size_t length) {
+  if (m_use_blocks) {
+    const auto bytes = read_blocks(static_cast<char *>(buffer), length);
+
+    // if file holds a member which was not written by a worker, the rest of
+    // the data is read by this thread
+    if (m_use_blocks || bytes > 0) {
+      return bytes;
+    }
+  }
+
   m_stream.next_out = static_cast<Bytef *>(buffer);
   m_stream.avail_out = length;
   int result = Z_STREAM_END;
@@ -85,17 +192,35 @@ ssize_t Gz_file::read(void *buffer, size_t length) {
       consume(consume_bytes);
       update_io(consume_bytes);
     }
-    if (result == Z_STREAM_END || result == Z_BUF_ERROR) {
+    if (result == Z_STREAM_END) {
+      // file may hold multiple members, trailing garbage is ignored
+      const auto next = peek(2);
+
+      if (next.length < 2 || 0x1f != next.ptr[0] || 0x8b != next.ptr[1]) {
+        break;
+      }
+
+      inflateReset(&m_stream);
+    } else if (result == Z_BUF_ERROR) {
       break;
     }
   }
 
   finish_io();
 
-  return length - m_stream.avail_out;
+  const auto bytes = length - m_stream.avail_out;
+  m_offset += bytes;
+
+  return bytes;
 }
 
 ssize_t Gz_file::write(const void *buffer, size_t length) {
+  if (m_use_blocks) {
+    return write_blocks(static_cast<const char *>(buffer), length);
+  }
+
+  m_offset += length;
+
   return do_write(static_cast<Bytef *>(const_cast<void *>(buffer)), length,
                   Z_NO_FLUSH);
 }
@@ -142,17 +267,39 @@ void Gz_file::init_write() {
   }
 }
 
+void Gz_file::init_workers() {
+  if (!m_thread_pool) {
+    m_thread_pool = std::make_shared<Gz_thread_pool>(m_workers);
+  }
+
+  m_use_blocks = true;
+  m_blocks.clear();
+  m_block.reset();
+  m_block_offset = 0;
+}
+
 void Gz_file::open(Mode m) {
   if (!file()->is_open()) {
     file()->open(m);
   }
 
+  m_offset = 0;
+  m_use_blocks = false;
+
   switch (m) {
     case Mode::READ:
       init_read();
+
+      if (m_workers > 0 && has_indexed_member()) {
+        init_workers();
+      }
       break;
     case Mode::WRITE:
       init_write();
+
+      if (m_workers > 0) {
+        init_workers();
+      }
       break;
     case Mode::APPEND:
       throw std::invalid_argument("append not supported for gz file");
@@ -177,7 +324,12 @@ void Gz_file::do_close() {
       assert(result == Z_OK);
     } break;
     case Mode::WRITE: {
-      write_finish();
+      if (m_use_blocks) {
+        write_blocks_finish();
+      } else {
+        write_finish();
+      }
+
       auto result = deflateEnd(&m_stream);
       (void)result;
       assert(result == Z_OK);
@@ -187,12 +339,278 @@ void Gz_file::do_close() {
   }
 
   m_open_mode.reset();
+  m_use_blocks = false;
+  // blocks which are still being processed are not referenced by the workers
+  m_blocks.clear();
+  m_block.reset();
 
   if (file()->is_open()) {
     file()->close();
   }
 }
 
+void Gz_file::deflate_block(Block *block) {
+  z_stream stream{};
+
+  if (Z_OK != deflateInit2(&stream, k_compression_level, Z_DEFLATED,
+                           -MAX_WBITS, 8, Z_DEFAULT_STRATEGY)) {
+    throw std::runtime_error("deflate init failed");
+  }
+
+  const auto &input = block->data;
+  std::string output;
+  output.resize(k_member_header_size +
+                deflateBound(&stream, static_cast<uLong>(input.size())) +
+                k_member_trailer_size);
+
+  const auto out = reinterpret_cast<uint8_t *>(output.data());
+
+  stream.next_in =
+      reinterpret_cast<Bytef *>(const_cast<char *>(input.data()));
+  stream.avail_in = static_cast<uInt>(input.size());
+  stream.next_out = out + k_member_header_size;
+  stream.avail_out =
+      static_cast<uInt>(output.size() - k_member_header_size);
+
+  const auto result = deflate(&stream, Z_FINISH);
+  const auto compressed = stream.total_out;
+  deflateEnd(&stream);
+
+  if (Z_STREAM_END != result) {
+    throw std::runtime_error("deflate: failed to compress a block (" +
+                             std::to_string(result) + ")");
+  }
+
+  const auto size = static_cast<uint32_t>(k_member_header_size + compressed +
+                                          k_member_trailer_size);
+  const auto trailer = out + size - k_member_trailer_size;
+
+  memcpy(out, k_member_header, sizeof(k_member_header));
+  store_uint32(size, out + sizeof(k_member_header));
+  store_uint32(crc32(0, reinterpret_cast<const Bytef *>(input.data()),
+                     static_cast<uInt>(input.size())),
+               trailer);
+  store_uint32(static_cast<uint32_t>(input.size()), trailer + 4);
+
+  output.resize(size);
+  block->data = std::move(output);
+}
+
+void Gz_file::inflate_block(Block *block) {
+  const auto &input = block->data;
+  const auto in = reinterpret_cast<const uint8_t *>(input.data());
+  const auto trailer = in + input.size() - k_member_trailer_size;
+  const auto size = load_uint32(trailer + 4);
+
+  if (size > k_max_member_size) {
+    throw std::runtime_error("inflate: data error (invalid member size)");
+  }
+
+  z_stream stream{};
+
+  if (Z_OK != inflateInit2(&stream, -MAX_WBITS)) {
+    throw std::runtime_error("inflate init failed");
+  }
+
+  // one extra byte, so that there's always some space for the output
+  std::string output;
+  output.resize(size + 1);
+
+  stream.next_in = const_cast<Bytef *>(in + k_member_header_size);
+  stream.avail_in = static_cast<uInt>(input.size() - k_member_header_size -
+                                      k_member_trailer_size);
+  stream.next_out = reinterpret_cast<Bytef *>(output.data());
+  stream.avail_out = static_cast<uInt>(output.size());
+
+  const auto result = inflate(&stream, Z_FINISH);
+  const auto decompressed = stream.total_out;
+  inflateEnd(&stream);
+
+  if (Z_STREAM_END != result || size != decompressed) {
+    throw std::runtime_error("inflate: data error (corrupted block)");
+  }
+
+  output.resize(size);
+
+  if (crc32(0, reinterpret_cast<const Bytef *>(output.data()), size) !=
+      load_uint32(trailer)) {
+    throw std::runtime_error("inflate: data error (incorrect data check)");
+  }
+
+  block->data = std::move(output);
+}
+
+void Gz_file::submit(std::shared_ptr<Block> block, void (*process)(Block *)) {
+  m_blocks.emplace_back(block);
+
+  // task holds the only other reference to the block, file can be closed
+  // while block is being processed
+  m_thread_pool->add_task([block = std::move(block), process]() {
+    try {
+      process(block.get());
+    } catch (...) {
+      block->exception = std::current_exception();
+    }
+
+    {
+      std::lock_guard lock{block->mutex};
+      block->done = true;
+    }
+
+    block->processed.notify_one();
+  });
+}
+
+void Gz_file::wait(Block *block) {
+  {
+    std::unique_lock lock{block->mutex};
+    block->processed.wait(lock, [block]() { return block->done; });
+  }
+
+  if (block->exception) {
+    std::rethrow_exception(block->exception);
+  }
+}
+
+ssize_t Gz_file::write_blocks(const char *buffer, size_t length) {
+  start_io();
+
+  for (size_t remaining = length; remaining > 0;) {
+    if (!m_block) {
+      m_block = std::make_shared<Block>();
+      m_block->data.reserve(k_block_size);
+    }
+
+    const auto bytes =
+        std::min(remaining, k_block_size - m_block->data.size());
+
+    m_block->data.append(buffer, bytes);
+    buffer += bytes;
+    remaining -= bytes;
+
+    if (k_block_size == m_block->data.size()) {
+      submit(std::move(m_block), deflate_block);
+      m_block.reset();
+
+      // limit the number of blocks in flight
+      while (m_blocks.size() > m_workers) {
+        write_block();
+      }
+    }
+  }
+
+  finish_io();
+
+  m_offset += length;
+
+  return length;
+}
+
+void Gz_file::write_block() {
+  const auto block = std::move(m_blocks.front());
+  m_blocks.pop_front();
+
+  wait(block.get());
+
+  const auto size = static_cast<ssize_t>(block->data.size());
+
+  if (file()->write(block->data.data(), size) != size) {
+    throw std::runtime_error("deflate: cannot write");
+  }
+
+  update_io(size);
+}
+
+void Gz_file::write_blocks_finish() {
+  start_io();
+
+  // empty file still needs to hold a single member
+  if (m_block || 0 == m_offset) {
+    submit(m_block ? std::move(m_block) : std::make_shared<Block>(),
+           deflate_block);
+    m_block.reset();
+  }
+
+  while (!m_blocks.empty()) {
+    write_block();
+  }
+
+  finish_io();
+}
+
+bool Gz_file::has_indexed_member() {
+  const auto header = peek(k_member_header_size);
+  return header.length >= k_member_header_size &&
+         member_size(header.ptr).has_value();
+}
+
+bool Gz_file::read_member() {
+  if (!has_indexed_member()) {
+    return false;
+  }
+
+  const size_t size = *member_size(m_source.data());
+
+  while (m_source.size() < size) {
+    const auto available = m_source.size();
+
+    if (peek(size).length == available) {
+      throw std::runtime_error("inflate: data error (truncated block)");
+    }
+  }
+
+  auto block = std::make_shared<Block>();
+  block->data.assign(reinterpret_cast<const char *>(m_source.data()), size);
+  consume(size);
+  update_io(size);
+
+  submit(std::move(block), inflate_block);
+
+  return true;
+}
+
+ssize_t Gz_file::read_blocks(char *buffer, size_t length) {
+  start_io();
+
+  size_t total = 0;
+
+  while (total < length) {
+    if (m_block && m_block_offset < m_block->data.size()) {
+      const auto bytes =
+          std::min(length - total, m_block->data.size() - m_block_offset);
+
+      memcpy(buffer + total, m_block->data.data() + m_block_offset, bytes);
+      m_block_offset += bytes;
+      total += bytes;
+
+      continue;
+    }
+
+    // keep the workers busy
+    while (m_blocks.size() < 2 * m_workers && read_member()) {
+    }
+
+    if (m_blocks.empty()) {
+      // either end of file, or a member not written by a worker
+      m_use_blocks = false;
+      m_block.reset();
+      break;
+    }
+
+    m_block = std::move(m_blocks.front());
+    m_blocks.pop_front();
+    m_block_offset = 0;
+
+    wait(m_block.get());
+  }
+
+  finish_io();
+
+  m_offset += total;
+
+  return total;
+}
+
 }  // namespace compression
 }  // namespace storage
 }  // namespace mysqlshdk
@@ -29,24 +29,77 @@
 #include <zlib.h>
 #include <algorithm>
 #include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
 
 namespace mysqlshdk {
 namespace storage {
 namespace compression {
 
+/**
+ * Pool of compression workers, which can be shared by multiple gzip files.
+ */
+class Gz_thread_pool final {
+ public:
+  Gz_thread_pool() = delete;
+
+  /**
+   * Creates a pool with the given number of threads.
+   *
+   * @param threads Number of threads.
+   *
+   * @throws std::invalid_argument If number of threads is 0.
+   */
+  explicit Gz_thread_pool(std::size_t threads);
+
+  Gz_thread_pool(const Gz_thread_pool &other) = delete;
+  Gz_thread_pool(Gz_thread_pool &&other) = delete;
+
+  Gz_thread_pool &operator=(const Gz_thread_pool &other) = delete;
+  Gz_thread_pool &operator=(Gz_thread_pool &&other) = delete;
+
+  ~Gz_thread_pool();
+
+  std::size_t threads() const { return m_threads.size(); }
+
+ private:
+  friend class Gz_file;
+
+  void add_task(std::function<void()> &&task);
+
+  shcore::Synchronized_queue<std::function<void()>> m_tasks;
+  std::vector<std::thread> m_threads;
+};
+
+/**
+ * Reads and writes gzip files.
+ *
+ * If Compression_options::threads is set, data is split into blocks which are
+ * compressed by the workers as separate gzip members. Each member stores its
+ * size in the extra field of its header. Such file is a regular gzip stream,
+ * and when it is read using multiple threads, members are decompressed by
+ * the workers as well.
+ */
 class Gz_file : public Compressed_file {
  public:
   Gz_file() = delete;
 
-  explicit Gz_file(std::unique_ptr<IFile> file);
+  explicit Gz_file(std::unique_ptr<IFile> file,
+                   const Compression_options &options = {});
 
   Gz_file(const Gz_file &other) = delete;
   Gz_file(Gz_file &&other) = default;
@@ -64,9 +117,7 @@ class Gz_file : public Compressed_file {
     throw std::logic_error("Gz_file::seek() - not supported");
   }
 
-  off64_t tell() const override {
-    return std::max(m_stream.total_in, m_stream.total_out);
-  }
+  off64_t tell() const override { return m_offset; }
 
   ssize_t read(void *buffer, size_t length) override;
   ssize_t write(const void *buffer, size_t length) override;
@@ -77,8 +128,23 @@ class Gz_file : public Compressed_file {
     size_t length;
   };
 
+  /**
+   * Data processed by a worker, holds the uncompressed data of a block and
+   * gets replaced by the compressed member (or vice versa).
+   */
+  struct Block {
+    std::string data;
+    std::exception_ptr exception;
+    bool done = false;
+    std::mutex mutex;
+    std::condition_variable processed;
+  };
+
   static constexpr const size_t CHUNK = 1 << 15;
 
+  // number of uncompressed bytes in a block compressed by a worker
+  static constexpr const size_t k_block_size = 1 << 20;
+
   static constexpr bool is_power_of_2(size_t x) {
     return ((x - 1) & x) == 0 && (x != 0);
   }
@@ -95,10 +161,25 @@ class Gz_file : public Compressed_file {
 
   void init_read();
   void init_write();
+  void init_workers();
   inline ssize_t do_write(void *buffer, size_t length, int flag);
   void write_finish();
   void do_close();
 
+  static void deflate_block(Block *block);
+  static void inflate_block(Block *block);
+
+  void submit(std::shared_ptr<Block> block, void (*process)(Block *));
+  void wait(Block *block);
+
+  ssize_t write_blocks(const char *buffer, size_t length);
+  void write_block();
+  void write_blocks_finish();
+
+  bool has_indexed_member();
+  bool read_member();
+  ssize_t read_blocks(char *buffer, size_t length);
+
   inline Buf_view peek(const size_t length);
 
   void consume(const size_t length) {
@@ -108,6 +189,18 @@ class Gz_file : public Compressed_file {
   z_stream m_stream;
   std::vector<uint8_t> m_source;
   std::optional<Mode> m_open_mode;
+  // number of uncompressed bytes read or written
+  uint64_t m_offset = 0;
+
+  std::size_t m_workers = 0;
+  std::shared_ptr<Gz_thread_pool> m_thread_pool;
+  // whether data is processed in blocks by the workers
+  bool m_use_blocks = false;
+  // blocks being processed by the workers, in order
+  std::deque<std::shared_ptr<Block>> m_blocks;
+  // block being filled when writing, or consumed when reading
+  std::shared_ptr<Block> m_block;
+  size_t m_block_offset = 0;
 };
 
 Gz_file::Buf_view Gz_file::peek(const size_t length) {
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/compression/lz4_file.h"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+namespace {
+
+size_t check(size_t code, const char *context) {
+  if (LZ4F_isError(code)) {
+    throw std::runtime_error(std::string("lz4.") + context + ": " +
+                             LZ4F_getErrorName(code));
+  }
+
+  return code;
+}
+
+}  // namespace
+
+Lz4_file::Lz4_file(std::unique_ptr<IFile> file)
+    : Compressed_file(std::move(file)) {}
+
+Lz4_file::~Lz4_file() {
+  try {
+    if (is_open()) do_close();
+  } catch (const std::runtime_error &e) {
+    log_error("Failed to close lz4 compressed file: %s", e.what());
+  }
+}
+
+ssize_t Lz4_file::read(void *buffer, size_t length) {
+  const auto target = static_cast<char *>(buffer);
+  size_t total = 0;
+
+  start_io();
+
+  while (total < length) {
+    if (m_buffer_offset == m_buffer.size()) {
+      m_buffer.resize(k_read_size);
+      m_buffer_offset = 0;
+
+      const auto bytes = file()->read(m_buffer.data(), m_buffer.size());
+
+      if (bytes < 0) {
+        m_buffer.clear();
+        throw std::runtime_error("lz4.read: cannot read");
+      }
+
+      m_buffer.resize(bytes);
+
+      if (0 == bytes) {
+        if (m_expected > 0) {
+          throw std::runtime_error("lz4.read: unexpected end of file");
+        }
+
+        break;
+      }
+    }
+
+    size_t consumed = m_buffer.size() - m_buffer_offset;
+    size_t produced = length - total;
+
+    m_expected = check(
+        LZ4F_decompress(m_dctx, target + total, &produced,
+                        m_buffer.data() + m_buffer_offset, &consumed, nullptr),
+        "read");
+
+    m_buffer_offset += consumed;
+    total += produced;
+
+    update_io(consumed);
+  }
+
+  finish_io();
+
+  m_offset += total;
+
+  return total;
+}
+
+ssize_t Lz4_file::write(const void *buffer, size_t length) {
+  const auto source = static_cast<const char *>(buffer);
+
+  start_io();
+
+  for (size_t offset = 0; offset < length;) {
+    const auto bytes = std::min(length - offset, k_write_size);
+
+    write_raw(m_buffer.data(),
+              check(LZ4F_compressUpdate(m_cctx, m_buffer.data(),
+                                        m_buffer.size(), source + offset,
+                                        bytes, nullptr),
+                    "write"));
+
+    offset += bytes;
+  }
+
+  finish_io();
+
+  m_offset += length;
+
+  return length;
+}
+
+void Lz4_file::write_raw(const char *data, size_t length) {
+  if (0 == length) {
+    return;
+  }
+
+  const auto bytes = file()->write(data, length);
+
+  if (bytes < 0 || static_cast<size_t>(bytes) != length) {
+    throw std::runtime_error("lz4.write: cannot write");
+  }
+
+  update_io(length);
+}
+
+void Lz4_file::write_finish() {
+  start_io();
+  write_raw(m_buffer.data(),
+            check(LZ4F_compressEnd(m_cctx, m_buffer.data(), m_buffer.size(),
+                                   nullptr),
+                  "write"));
+  finish_io();
+}
+
+void Lz4_file::init_read() {
+  check(LZ4F_createDecompressionContext(&m_dctx, LZ4F_VERSION), "init");
+
+  m_buffer.clear();
+  m_buffer_offset = 0;
+  // file needs to contain at least one frame, empty file is an error
+  m_expected = LZ4F_HEADER_SIZE_MIN;
+}
+
+void Lz4_file::init_write() {
+  check(LZ4F_createCompressionContext(&m_cctx, LZ4F_VERSION), "init");
+
+  LZ4F_preferences_t preferences{};
+  preferences.frameInfo.blockSizeID = LZ4F_max256KB;
+  preferences.frameInfo.blockMode = LZ4F_blockLinked;
+  preferences.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+  // default compression level, uses the fast (non-HC) compressor with the
+  // default acceleration; negative values trade ratio for more speed
+  preferences.compressionLevel = 0;
+
+  // large enough to hold the frame header, the compressed data of a single
+  // call to write() and the frame footer
+  m_buffer.resize(
+      std::max<size_t>(LZ4F_compressBound(k_write_size, &preferences),
+                       LZ4F_HEADER_SIZE_MAX));
+
+  start_io();
+  write_raw(m_buffer.data(),
+            check(LZ4F_compressBegin(m_cctx, m_buffer.data(), m_buffer.size(),
+                                     &preferences),
+                  "init"));
+  finish_io();
+}
+
+void Lz4_file::open(Mode m) {
+  if (!file()->is_open()) {
+    file()->open(m);
+  }
+
+  m_offset = 0;
+
+  switch (m) {
+    case Mode::READ:
+      init_read();
+      break;
+    case Mode::WRITE:
+      init_write();
+      break;
+    case Mode::APPEND:
+      throw std::invalid_argument("append not supported for lz4 file");
+  }
+
+  m_open_mode = m;
+}
+
+bool Lz4_file::is_open() const {
+  return m_open_mode.has_value() && file()->is_open();
+}
+
+void Lz4_file::close() { do_close(); }
+
+void Lz4_file::do_close() {
+  assert(is_open());
+
+  const auto mode = *m_open_mode;
+  // file is not closed again if this fails
+  m_open_mode.reset();
+
+  switch (mode) {
+    case Mode::READ:
+      LZ4F_freeDecompressionContext(m_dctx);
+      m_dctx = nullptr;
+      break;
+    case Mode::WRITE:
+      try {
+        write_finish();
+      } catch (...) {
+        LZ4F_freeCompressionContext(m_cctx);
+        m_cctx = nullptr;
+        throw;
+      }
+
+      LZ4F_freeCompressionContext(m_cctx);
+      m_cctx = nullptr;
+      break;
+    case Mode::APPEND:
+      break;
+  }
+
+  m_buffer.clear();
+  m_buffer.shrink_to_fit();
+
+  if (file()->is_open()) {
+    file()->close();
+  }
+}
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
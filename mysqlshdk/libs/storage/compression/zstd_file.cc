@@ -26,6 +26,7 @@
 #include "mysqlshdk/libs/storage/compression/zstd_file.h"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <utility>
 
@@ -36,8 +37,69 @@ namespace mysqlshdk {
 namespace storage {
 namespace compression {
 
-Zstd_file::Zstd_file(std::unique_ptr<IFile> file)
-    : Compressed_file(std::move(file)) {}
+namespace {
+
+// seek table uses the zstd seekable format, it's stored in a skippable frame
+// at the end of the file, which is ignored by the decompressors
+constexpr uint32_t k_skippable_frame_magic = 0x184D2A5E;
+constexpr uint32_t k_seekable_magic = 0x8F92EAB1;
+constexpr std::size_t k_skippable_frame_header_size = 8;
+constexpr std::size_t k_seek_table_entry_size = 8;
+constexpr std::size_t k_seek_table_checksum_size = 4;
+constexpr std::size_t k_seek_table_footer_size = 9;
+constexpr uint8_t k_seek_table_checksum_flag = 0x80;
+constexpr uint8_t k_seek_table_reserved_bits = 0x7C;
+
+// sizes are stored using 32 bits
+constexpr std::size_t k_max_frame_size = 1024 * 1024 * 1024;
+
+void store_le32(uint8_t *ptr, uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    ptr[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+uint32_t load_le32(const uint8_t *ptr) {
+  uint32_t value = 0;
+
+  for (int i = 0; i < 4; ++i) {
+    value |= static_cast<uint32_t>(ptr[i]) << (8 * i);
+  }
+
+  return value;
+}
+
+}  // namespace
+
+Zstd_thread_pool::Zstd_thread_pool(std::size_t threads) : m_threads(threads) {
+#ifdef HAVE_ZSTD_THREAD_POOL
+  m_pool = ZSTD_createThreadPool(m_threads);
+
+  if (!m_pool) {
+    throw std::runtime_error("zstd thread pool init failed");
+  }
+#endif  // HAVE_ZSTD_THREAD_POOL
+}
+
+Zstd_thread_pool::~Zstd_thread_pool() {
+#ifdef HAVE_ZSTD_THREAD_POOL
+  ZSTD_freeThreadPool(m_pool);
+#endif  // HAVE_ZSTD_THREAD_POOL
+}
+
+bool Zstd_thread_pool::multithreading_supported() {
+  // if library was compiled without support for multi-threading, upper bound
+  // is 0
+  const auto bounds = ZSTD_cParam_getBounds(ZSTD_c_nbWorkers);
+  return !ZSTD_isError(bounds.error) && bounds.upperBound > 0;
+}
+
+Zstd_file::Zstd_file(std::unique_ptr<IFile> file,
+                     const Compression_options &options)
+    : Compressed_file(std::move(file)),
+      m_workers(options.threads),
+      m_thread_pool(options.zstd_thread_pool),
+      m_frame_size(std::min(options.frame_size, k_max_frame_size)) {}
 
 Zstd_file::~Zstd_file() {
   try {
@@ -59,18 +121,259 @@ Zstd_file::Buf_view Zstd_file::peek(const size_t length) {
       m_buffer.resize(avail);  // revert extent_to_fit
     } else {
       m_buffer.resize(avail + bytes_read);
+      m_raw_offset += bytes_read;
     }
   }
   return Buf_view{m_buffer.data(), m_buffer.size()};
 }
 
 ssize_t Zstd_file::read(void *buffer, size_t length) {
+  const auto target = static_cast<char *>(buffer);
+  size_t replayed = 0;
+
+  if (m_replay > 0) {
+    // seek() moved back to the data which was already decompressed
+    replayed = std::min(length, m_replay);
+    std::memcpy(target, m_history.data() + m_history.size() - m_replay,
+                replayed);
+    m_replay -= replayed;
+    m_offset += replayed;
+  }
+
   ZSTD_outBuffer obuf;
-  obuf.dst = buffer;
-  obuf.size = length;
+  obuf.dst = target + replayed;
+  obuf.size = length - replayed;
   obuf.pos = 0;
 
-  return (*this.*m_read_f)(&obuf);
+  if (0 == obuf.size) {
+    start_io();
+    finish_io();
+    return replayed;
+  }
+
+  const auto bytes = (*this.*m_read_f)(&obuf);
+
+  if (!m_frames.empty() && bytes > 0) {
+    remember(target + replayed, bytes);
+  }
+
+  return replayed + bytes;
+}
+
+off64_t Zstd_file::seek(off64_t offset) {
+  if (!m_open_mode.has_value() || Mode::READ != *m_open_mode) {
+    throw std::logic_error("Zstd_file::seek() - not supported");
+  }
+
+  load_seek_table();
+
+  if (m_frames.empty()) {
+    throw std::logic_error("Zstd_file::seek() - file is not seekable");
+  }
+
+  const auto &last = m_frames.back();
+  const auto target = std::min<uint64_t>(std::max<off64_t>(offset, 0),
+                                         last.offset + last.size);
+  const uint64_t decompressed = m_offset + m_replay;
+
+  if (target <= decompressed && decompressed - target <= m_history.size()) {
+    // data is still available
+    m_replay = decompressed - target;
+    m_offset = target;
+    return m_offset;
+  }
+
+  m_offset = decompressed;
+  m_replay = 0;
+
+  // first frame starts at 0, there's always a frame which contains the target
+  const auto frame =
+      std::prev(std::upper_bound(m_frames.begin(), m_frames.end(), target,
+                                 [](uint64_t o, const Frame &f) {
+                                   return o < f.offset;
+                                 }));
+
+  if (target < m_offset || m_offset < frame->offset) {
+    seek_to_frame(*frame);
+  }
+
+  discard(target - m_offset);
+
+  return m_offset;
+}
+
+std::optional<size_t> Zstd_file::uncompressed_size() {
+  if (!m_open_mode.has_value() || Mode::READ != *m_open_mode) {
+    return {};
+  }
+
+  load_seek_table();
+
+  if (m_frames.empty()) {
+    return {};
+  }
+
+  return m_frames.back().offset + m_frames.back().size;
+}
+
+void Zstd_file::load_seek_table() {
+  if (m_seek_table_loaded) {
+    return;
+  }
+
+  m_seek_table_loaded = true;
+
+  const auto read_frames = [this]() {
+    std::vector<Frame> frames;
+    const uint64_t file_size = file()->file_size();
+    uint8_t footer[k_seek_table_footer_size];
+
+    if (file_size < k_skippable_frame_header_size + sizeof(footer)) {
+      return frames;
+    }
+
+    read_raw(file_size - sizeof(footer), footer, sizeof(footer));
+
+    const auto descriptor = footer[4];
+
+    if (load_le32(footer + 5) != k_seekable_magic ||
+        (descriptor & k_seek_table_reserved_bits)) {
+      return frames;
+    }
+
+    const uint64_t count = load_le32(footer);
+    const auto entry_size =
+        k_seek_table_entry_size + ((descriptor & k_seek_table_checksum_flag)
+                                       ? k_seek_table_checksum_size
+                                       : 0);
+    const auto table_size =
+        k_skippable_frame_header_size + count * entry_size + sizeof(footer);
+
+    if (0 == count || table_size > file_size) {
+      return frames;
+    }
+
+    std::vector<uint8_t> table(table_size);
+    read_raw(file_size - table_size, table.data(), table.size());
+
+    if (load_le32(table.data()) != k_skippable_frame_magic ||
+        load_le32(table.data() + 4) !=
+            table_size - k_skippable_frame_header_size) {
+      return frames;
+    }
+
+    frames.reserve(count);
+
+    Frame frame;
+    auto entry = table.data() + k_skippable_frame_header_size;
+
+    for (uint64_t i = 0; i < count; ++i, entry += entry_size) {
+      frame.compressed_size = load_le32(entry);
+      frame.size = load_le32(entry + 4);
+
+      frames.emplace_back(frame);
+
+      frame.compressed_offset += frame.compressed_size;
+      frame.offset += frame.size;
+    }
+
+    if (frame.compressed_offset + table_size != file_size) {
+      // frames do not cover the whole file
+      frames.clear();
+    }
+
+    return frames;
+  };
+
+  try {
+    m_frames = read_frames();
+
+    if (m_read_f != &Zstd_file::do_read_mmap) {
+      // move back to where decompression stopped
+      file()->seek(m_raw_offset);
+    }
+  } catch (const std::logic_error &) {
+    // underlying file does not support seek()
+    m_frames.clear();
+  }
+}
+
+void Zstd_file::read_raw(uint64_t offset, uint8_t *data, size_t length) {
+  if (m_read_f == &Zstd_file::do_read_mmap) {
+    // whole file is mapped, avoid changing the current offset
+    auto *mfile = static_cast<backend::File *>(file());
+    size_t avail = 0;
+    const auto current = mfile->mmap_will_read(&avail);
+    const auto base = current - mfile->tell();
+
+    if (!current ||
+        offset + length > static_cast<uint64_t>(mfile->tell()) + avail) {
+      throw std::runtime_error("zstd.read: failed to read the seek table");
+    }
+
+    std::memcpy(data, base + offset, length);
+  } else {
+    file()->seek(offset);
+
+    size_t total = 0;
+
+    while (total < length) {
+      const auto bytes = file()->read(data + total, length - total);
+
+      if (bytes <= 0) {
+        throw std::runtime_error("zstd.read: failed to read the seek table");
+      }
+
+      total += bytes;
+    }
+  }
+}
+
+void Zstd_file::seek_to_frame(const Frame &frame) {
+  const auto status = ZSTD_DCtx_reset(m_dctx, ZSTD_reset_session_only);
+
+  if (ZSTD_isError(status)) {
+    throw std::runtime_error(std::string("zstd.seek: ") +
+                             ZSTD_getErrorName(status));
+  }
+
+  // frames are followed by the seek table, offset is always within the file
+  file()->seek(frame.compressed_offset);
+
+  if (m_read_f != &Zstd_file::do_read_mmap) {
+    m_buffer.clear();
+    m_raw_offset = frame.compressed_offset;
+  }
+
+  m_offset = frame.offset;
+  m_history.clear();
+  m_replay = 0;
+}
+
+void Zstd_file::discard(size_t length) {
+  std::vector<char> buffer(std::min<size_t>(length, CHUNK));
+
+  while (length > 0) {
+    const auto bytes = read(buffer.data(), std::min(length, buffer.size()));
+
+    if (bytes <= 0) {
+      break;
+    }
+
+    length -= bytes;
+  }
+}
+
+void Zstd_file::remember(const char *data, size_t length) {
+  if (length >= k_rewind_size) {
+    m_history.assign(data + length - k_rewind_size, k_rewind_size);
+  } else {
+    m_history.append(data, length);
+
+    if (m_history.size() > k_rewind_size) {
+      m_history.erase(0, m_history.size() - k_rewind_size);
+    }
+  }
 }
 
 ssize_t Zstd_file::do_read(ZSTD_outBuffer *obuf) {
@@ -138,6 +441,10 @@ ssize_t Zstd_file::do_read_mmap(ZSTD_outBuffer *obuf) {
 }
 
 ssize_t Zstd_file::write(const void *buffer, size_t length) {
+  if (m_frame_size) {
+    return write_frames(static_cast<const char *>(buffer), length);
+  }
+
   ZSTD_inBuffer ibuf;
   ibuf.size = length;
   ibuf.pos = 0;
@@ -160,6 +467,15 @@ bool Zstd_file::flush() {
 }
 
 void Zstd_file::write_finish() {
+  if (m_frame_size) {
+    if (m_frame_data_size > 0 || m_frames.empty()) {
+      end_frame();
+    }
+
+    write_seek_table();
+    return;
+  }
+
   ZSTD_inBuffer ibuf;
   ibuf.size = 0;
   ibuf.pos = 0;
@@ -168,6 +484,105 @@ void Zstd_file::write_finish() {
   (*this.*m_write_f)(&ibuf, ZSTD_e_end);
 }
 
+ssize_t Zstd_file::write_frames(const char *buffer, size_t length) {
+  size_t written = 0;
+
+  while (written < length) {
+    ZSTD_inBuffer ibuf;
+    ibuf.size = std::min<uint64_t>(length - written,
+                                   m_frame_size - m_frame_data_size);
+    ibuf.pos = 0;
+    ibuf.src = buffer + written;
+
+    (*this.*m_write_f)(&ibuf, ZSTD_e_continue);
+
+    written += ibuf.size;
+    m_frame_data_size += ibuf.size;
+    m_offset += ibuf.size;
+
+    if (m_frame_data_size >= m_frame_size) {
+      end_frame();
+    }
+  }
+
+  return length;
+}
+
+void Zstd_file::end_frame() {
+  ZSTD_inBuffer ibuf;
+  ibuf.size = 0;
+  ibuf.pos = 0;
+  ibuf.src = nullptr;
+
+  (*this.*m_write_f)(&ibuf, ZSTD_e_end);
+
+  Frame frame;
+
+  if (!m_frames.empty()) {
+    const auto &previous = m_frames.back();
+    frame.compressed_offset =
+        previous.compressed_offset + previous.compressed_size;
+    frame.offset = previous.offset + previous.size;
+  }
+
+  frame.compressed_size = m_raw_offset - frame.compressed_offset;
+  frame.size = m_frame_data_size;
+
+  m_frames.emplace_back(frame);
+  m_frame_data_size = 0;
+}
+
+void Zstd_file::write_seek_table() {
+  std::vector<uint8_t> table(k_skippable_frame_header_size +
+                             m_frames.size() * k_seek_table_entry_size +
+                             k_seek_table_footer_size);
+  auto ptr = table.data();
+
+  store_le32(ptr, k_skippable_frame_magic);
+  ptr += 4;
+  store_le32(ptr, table.size() - k_skippable_frame_header_size);
+  ptr += 4;
+
+  for (const auto &frame : m_frames) {
+    store_le32(ptr, frame.compressed_size);
+    ptr += 4;
+    store_le32(ptr, frame.size);
+    ptr += 4;
+  }
+
+  store_le32(ptr, m_frames.size());
+  ptr += 4;
+  // no checksums
+  *ptr++ = 0;
+  store_le32(ptr, k_seekable_magic);
+
+  write_raw(table.data(), table.size());
+}
+
+void Zstd_file::write_raw(const uint8_t *data, size_t length) {
+  start_io();
+
+  if (m_write_f == &Zstd_file::do_write_mmap) {
+    auto *mfile = static_cast<backend::File *>(file());
+    const auto dst = mfile->mmap_will_write(length, nullptr);
+
+    if (!dst) {
+      throw std::runtime_error(
+          std::string("Error reserving space on mmapped file"));
+    }
+
+    std::memcpy(dst, data, length);
+    mfile->mmap_did_write(length);
+  } else if (file()->write(data, length) < 0) {
+    throw std::runtime_error("zstd.write: error writing compressed data");
+  }
+
+  update_io(length);
+  m_raw_offset += length;
+
+  finish_io();
+}
+
 ssize_t Zstd_file::do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
   ZSTD_outBuffer obuf;
 
@@ -193,6 +608,7 @@ ssize_t Zstd_file::do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
         throw std::runtime_error("zstd.write: error writing compressed data");
 
       update_io(obuf.pos);
+      m_raw_offset += obuf.pos;
 
       obuf.pos = 0;
     }
@@ -229,6 +645,7 @@ ssize_t Zstd_file::do_write_mmap(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
                                ZSTD_getErrorName(status));
     } else {
       update_io(obuf.pos);
+      m_raw_offset += obuf.pos;
       obuf.dst = mfile->mmap_did_write(obuf.pos, &obuf.size);
       obuf.pos = 0;
     }
@@ -249,6 +666,8 @@ void Zstd_file::init_write() {
     }
     ZSTD_initCStream(m_cctx, m_clevel);
 
+    init_workers();
+
     auto *mfile = dynamic_cast<backend::File *>(file());
 
     // try to enable mmap if available
@@ -263,6 +682,45 @@ void Zstd_file::init_write() {
   }
 }
 
+void Zstd_file::init_workers() {
+  if (0 == m_workers || !Zstd_thread_pool::multithreading_supported()) {
+    return;
+  }
+
+  // data is compressed asynchronously, write() returns once data is queued
+  // for compression, flush() and close() block until all pending jobs are
+  // finished
+  const auto status = ZSTD_CCtx_setParameter(
+      m_cctx, ZSTD_c_nbWorkers, static_cast<int>(m_workers));
+
+  if (ZSTD_isError(status)) {
+    log_warning("Failed to enable multi-threaded zstd compression: %s",
+                ZSTD_getErrorName(status));
+    return;
+  }
+
+  if (m_frame_size) {
+    // each frame ends with a flush which waits for all pending jobs, frame is
+    // split into (at least) one job per worker, so that all of them are busy;
+    // library raises this value if it's below the supported minimum
+    const auto job_size = ZSTD_CCtx_setParameter(
+        m_cctx, ZSTD_c_jobSize,
+        static_cast<int>(std::max<std::size_t>(1, m_frame_size / m_workers)));
+
+    if (ZSTD_isError(job_size)) {
+      log_warning("Failed to set the size of zstd compression jobs: %s",
+                  ZSTD_getErrorName(job_size));
+    }
+  }
+
+#ifdef HAVE_ZSTD_THREAD_POOL
+  if (m_thread_pool) {
+    // workers are shared with other files, pool has to outlive the context
+    ZSTD_CCtx_refThreadPool(m_cctx, m_thread_pool->m_pool);
+  }
+#endif  // HAVE_ZSTD_THREAD_POOL
+}
+
 void Zstd_file::init_read() {
   if (!m_dctx) {
     m_dctx = ZSTD_createDStream();
@@ -301,6 +759,12 @@ void Zstd_file::open(Mode m) {
 
   m_open_mode = m;
   m_offset = 0;
+  m_raw_offset = 0;
+  m_frames.clear();
+  m_frame_data_size = 0;
+  m_seek_table_loaded = false;
+  m_history.clear();
+  m_replay = 0;
 }
 
 bool Zstd_file::is_open() const {
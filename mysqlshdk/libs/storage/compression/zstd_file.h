@@ -26,9 +26,15 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_COMPRESSION_ZSTD_FILE_H_
 #define MYSQLSHDK_LIBS_STORAGE_COMPRESSION_ZSTD_FILE_H_
 
+#ifndef ZSTD_STATIC_LINKING_ONLY
+// required by ZSTD_threadPool
+#define ZSTD_STATIC_LINKING_ONLY
+#endif  // ZSTD_STATIC_LINKING_ONLY
 #include <zstd.h>
+
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -42,11 +48,57 @@ namespace mysqlshdk {
 namespace storage {
 namespace compression {
 
+#if ZSTD_VERSION_NUMBER >= 10500
+#define HAVE_ZSTD_THREAD_POOL
+#endif  // ZSTD_VERSION_NUMBER >= 10500
+
+/**
+ * Pool of compression workers, which can be shared by multiple zstd files.
+ */
+class Zstd_thread_pool final {
+ public:
+  Zstd_thread_pool() = delete;
+
+  /**
+   * Creates a pool with the given number of threads.
+   *
+   * @param threads Number of threads.
+   *
+   * @throws std::runtime_error If pool could not be created.
+   */
+  explicit Zstd_thread_pool(std::size_t threads);
+
+  Zstd_thread_pool(const Zstd_thread_pool &other) = delete;
+  Zstd_thread_pool(Zstd_thread_pool &&other) = delete;
+
+  Zstd_thread_pool &operator=(const Zstd_thread_pool &other) = delete;
+  Zstd_thread_pool &operator=(Zstd_thread_pool &&other) = delete;
+
+  ~Zstd_thread_pool();
+
+  /**
+   * Checks if zstd library supports multi-threaded compression.
+   */
+  static bool multithreading_supported();
+
+  std::size_t threads() const { return m_threads; }
+
+ private:
+  friend class Zstd_file;
+
+  std::size_t m_threads;
+
+#ifdef HAVE_ZSTD_THREAD_POOL
+  ZSTD_threadPool *m_pool = nullptr;
+#endif  // HAVE_ZSTD_THREAD_POOL
+};
+
 class Zstd_file : public Compressed_file {
  public:
   Zstd_file() = delete;
 
-  explicit Zstd_file(std::unique_ptr<IFile> file);
+  explicit Zstd_file(std::unique_ptr<IFile> file,
+                     const Compression_options &options = {});
 
   Zstd_file(const Zstd_file &other) = delete;
   Zstd_file(Zstd_file &&other) = default;
@@ -60,9 +112,12 @@ class Zstd_file : public Compressed_file {
   bool is_open() const override;
   void close() override;
 
-  off64_t seek(off64_t) override {
-    throw std::logic_error("Zstd_file::seek() - not supported");
-  }
+  /**
+   * Seeks to the given offset of uncompressed data. Supported only when
+   * reading a file which holds an index of frames (see
+   * Compression_options::frame_size).
+   */
+  off64_t seek(off64_t offset) override;
 
   off64_t tell() const override { return m_offset; }
 
@@ -71,12 +126,28 @@ class Zstd_file : public Compressed_file {
   ssize_t read(void *buffer, size_t length) override;
   ssize_t write(const void *buffer, size_t length) override;
 
+  std::optional<size_t> uncompressed_size() override;
+
  private:
   struct Buf_view {
     uint8_t *ptr;
     size_t length;
   };
 
+  /**
+   * Independently decompressable frame.
+   */
+  struct Frame {
+    uint64_t compressed_offset = 0;
+    uint64_t compressed_size = 0;
+    uint64_t offset = 0;
+    uint64_t size = 0;
+  };
+
+  // number of decompressed bytes which are kept, so that read can be restarted
+  // from a slightly earlier offset without decompressing the whole frame
+  static constexpr const size_t k_rewind_size = 4096;
+
   static constexpr const size_t CHUNK = 1 << 15;
 
   static constexpr bool is_power_of_2(size_t x) {
@@ -101,8 +172,21 @@ class Zstd_file : public Compressed_file {
 
   void init_read();
   void init_write();
+  void init_workers();
   void write_finish();
 
+  ssize_t write_frames(const char *buffer, size_t length);
+  void end_frame();
+  void write_seek_table();
+  void write_raw(const uint8_t *data, size_t length);
+
+  void load_seek_table();
+  void read_raw(uint64_t offset, uint8_t *data, size_t length);
+  void set_raw_offset(uint64_t offset);
+  void seek_to_frame(const Frame &frame);
+  void discard(size_t length);
+  void remember(const char *data, size_t length);
+
   void do_close();
 
   ssize_t do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op);
@@ -119,9 +203,23 @@ class Zstd_file : public Compressed_file {
   ZSTD_CStream *m_cctx = nullptr;
   ZSTD_DStream *m_dctx = nullptr;
   int m_clevel = 1;
+  std::size_t m_workers = 0;
+  std::shared_ptr<Zstd_thread_pool> m_thread_pool;
   std::vector<uint8_t> m_buffer;
   size_t m_decompress_read_size = 0;
   std::optional<Mode> m_open_mode;
+
+  // frames of the file, if empty file is not seekable
+  std::vector<Frame> m_frames;
+  std::size_t m_frame_size = 0;
+  // number of uncompressed bytes in the current frame
+  uint64_t m_frame_data_size = 0;
+  // offset of the underlying file
+  uint64_t m_raw_offset = 0;
+  bool m_seek_table_loaded = false;
+  // recently decompressed data, replayed after a seek to an earlier offset
+  std::string m_history;
+  size_t m_replay = 0;
 };
 
 }  // namespace compression
@@ -39,10 +39,18 @@
 #endif  // !_WIN32
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <filesystem>
 #include <ios>
 #include <map>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
@@ -63,9 +71,9 @@ namespace {
  *    - m_mutex_hooks (per instance): protects access to the hooks features:
  *        m_hook_list and m_level_hook_list
  *    - g_mutex (global): protects access to the (also global) variable
- *        g_output_format but also to the file system
+ *        g_output_format
  *
- * NOTE: m_mutex_hooks is locked while g_mutex is locked (check do_log)
+ * Access to the log file is controlled by the Async_writer.
  */
 std::recursive_mutex g_mutex;
 std::string g_output_format;
@@ -125,6 +133,420 @@ std::string check_logfile_permissions(const std::string &filepath) {
 
 }  // namespace
 
+/**
+ * Asynchronous backend of the log file.
+ *
+ * Threads which are logging store the formatted entries in their own ring
+ * buffers, without taking any locks. A background thread periodically moves
+ * the entries to the log file, ordered by the sequence numbers assigned when
+ * they were logged. Entries which do not fit in a buffer are written
+ * synchronously, together with the buffered ones.
+ *
+ * Sequence number is assigned before the entry is buffered, entries whose
+ * numbers were assigned after the writing has started are held back until the
+ * next write, so entries logged one after another are always written in that
+ * order. Entries logged concurrently by multiple threads can be written in any
+ * order.
+ */
+class Logger::Async_writer final {
+ public:
+  explicit Async_writer(Logger *logger) : m_logger(logger) {
+    register_writer(this);
+    m_thread = std::thread([this]() { run(); });
+  }
+
+  Async_writer(const Async_writer &) = delete;
+  Async_writer(Async_writer &&) = delete;
+
+  Async_writer &operator=(const Async_writer &) = delete;
+  Async_writer &operator=(Async_writer &&) = delete;
+
+  ~Async_writer() {
+    {
+      std::lock_guard lock{m_wakeup_mutex};
+      m_stop = true;
+    }
+
+    m_wakeup.notify_one();
+    m_thread.join();
+
+    unregister_writer(this);
+    flush();
+  }
+
+  /**
+   * Buffers the entry, if flush_now is set, waits until it's written.
+   */
+  void write(std::string_view entry, bool flush_now) {
+    const auto sequence = m_sequence++;
+    const auto buffer = thread_buffer();
+
+    if (!buffer || !buffer->push(sequence, entry)) {
+      std::lock_guard lock{m_flush_mutex};
+      m_batch.emplace_back(sequence, entry);
+      drain();
+      m_logger->flush_file();
+      return;
+    }
+
+    if (flush_now) {
+      flush();
+    } else if (buffer->used() > Ring_buffer::k_capacity / 2) {
+      m_flush_requested = true;
+      m_wakeup.notify_one();
+    }
+  }
+
+  /**
+   * Writes all the buffered entries. If wait is false and another thread is
+   * writing at the moment, does nothing.
+   */
+  void flush(bool wait = true) {
+    std::unique_lock lock{m_flush_mutex, std::defer_lock};
+
+    if (wait) {
+      lock.lock();
+    } else if (!lock.try_lock()) {
+      return;
+    }
+
+    drain(wait);
+    m_logger->flush_file();
+  }
+
+  /**
+   * Used on the abnormal termination paths. If wait is false, writers which
+   * are in use at the moment are skipped.
+   */
+  static void flush_all(bool wait = true) {
+    auto &w = writers();
+    std::unique_lock lock{w.mutex, std::defer_lock};
+
+    if (wait) {
+      lock.lock();
+    } else if (!lock.try_lock()) {
+      return;
+    }
+
+    for (const auto writer : w.list) {
+      writer->flush(false);
+    }
+  }
+
+ private:
+  static constexpr auto k_flush_interval = std::chrono::milliseconds(100);
+  // threads above this limit write synchronously
+  static constexpr std::size_t k_max_buffers = 256;
+
+  /**
+   * Single producer, single consumer ring buffer holding the entries logged
+   * by a single thread.
+   */
+  class Ring_buffer final {
+   public:
+    static constexpr std::size_t k_capacity = 64 * 1024;
+
+    Ring_buffer() : m_data(std::make_unique<char[]>(k_capacity)) {}
+
+    bool push(uint64_t sequence, std::string_view entry) {
+      const Header header{sequence, entry.size()};
+      const auto size = sizeof(header) + entry.size();
+      const auto head = m_head.load(std::memory_order_relaxed);
+
+      if (k_capacity - (head - m_tail.load(std::memory_order_acquire)) <
+          size) {
+        return false;
+      }
+
+      copy_in(head, &header, sizeof(header));
+      copy_in(head + sizeof(header), entry.data(), entry.size());
+
+      m_head.store(head + size, std::memory_order_release);
+
+      return true;
+    }
+
+    template <class F>
+    void pop_all(F &&f) {
+      auto tail = m_tail.load(std::memory_order_relaxed);
+      const auto head = m_head.load(std::memory_order_acquire);
+
+      while (tail < head) {
+        Header header;
+        copy_out(tail, &header, sizeof(header));
+
+        std::string entry(header.size, '\0');
+        copy_out(tail + sizeof(header), entry.data(), header.size);
+
+        f(header.sequence, std::move(entry));
+
+        tail += sizeof(header) + header.size;
+      }
+
+      m_tail.store(tail, std::memory_order_release);
+    }
+
+    std::size_t used() const {
+      return m_head.load(std::memory_order_relaxed) -
+             m_tail.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Assigns this buffer to the calling thread, if it's not used.
+     */
+    bool acquire() {
+      bool expected = false;
+      return m_owned.compare_exchange_strong(expected, true,
+                                             std::memory_order_acquire);
+    }
+
+    void release() { m_owned.store(false, std::memory_order_release); }
+
+   private:
+    struct Header {
+      uint64_t sequence;
+      std::size_t size;
+    };
+
+    void copy_in(uint64_t pos, const void *data, std::size_t size) {
+      const auto offset = pos % k_capacity;
+      const auto first = std::min(size, k_capacity - offset);
+
+      ::memcpy(m_data.get() + offset, data, first);
+      ::memcpy(m_data.get(), static_cast<const char *>(data) + first,
+               size - first);
+    }
+
+    void copy_out(uint64_t pos, void *data, std::size_t size) const {
+      const auto offset = pos % k_capacity;
+      const auto first = std::min(size, k_capacity - offset);
+
+      ::memcpy(data, m_data.get() + offset, first);
+      ::memcpy(static_cast<char *>(data) + first, m_data.get(), size - first);
+    }
+
+    alignas(64) std::atomic<uint64_t> m_head{0};
+    alignas(64) std::atomic<uint64_t> m_tail{0};
+    std::atomic<bool> m_owned{true};
+    std::unique_ptr<char[]> m_data;
+  };
+
+  struct Registration {
+    uint64_t writer_id;
+    std::shared_ptr<Ring_buffer> buffer;
+  };
+
+  // buffers used by the calling thread, released once the thread exits
+  struct Thread_buffers {
+    ~Thread_buffers() {
+      for (const auto &r : registrations) {
+        r.buffer->release();
+      }
+    }
+
+    std::vector<Registration> registrations;
+  };
+
+  static inline thread_local Thread_buffers s_thread_buffers;
+  static inline std::atomic<uint64_t> s_next_id{0};
+
+  struct Writers {
+    std::mutex mutex;
+    std::vector<Async_writer *> list;
+  };
+
+  static Writers &writers() {
+    // never destroyed, loggers can be destroyed during the static destruction
+    static const auto s_writers = new Writers();
+    return *s_writers;
+  }
+
+  static void register_writer(Async_writer *writer) {
+    static std::once_flag s_handlers_installed;
+
+    std::call_once(s_handlers_installed, []() {
+      std::atexit([]() { Async_writer::flush_all(); });
+
+      static std::terminate_handler s_previous_handler = nullptr;
+
+      s_previous_handler = std::set_terminate([]() {
+        Async_writer::flush_all();
+
+        if (s_previous_handler) {
+          s_previous_handler();
+        }
+
+        std::abort();
+      });
+
+      for (const auto signo : {SIGABRT, SIGSEGV}) {
+        const auto previous =
+            std::signal(signo, &Async_writer::on_fatal_signal);
+
+        if (SIG_ERR != previous) {
+          previous_signal_handler(signo) = previous;
+        }
+      }
+    });
+
+    auto &w = writers();
+    std::lock_guard lock{w.mutex};
+    w.list.emplace_back(writer);
+  }
+
+  using Signal_handler = void (*)(int);
+
+  static Signal_handler &previous_signal_handler(int signo) {
+    static Signal_handler s_abort = SIG_DFL;
+    static Signal_handler s_segv = SIG_DFL;
+
+    return SIGABRT == signo ? s_abort : s_segv;
+  }
+
+  /**
+   * Best effort attempt to write the buffered entries on abort() or a crash,
+   * entries are not written if any of the locks is held at the moment. Signal
+   * is then raised again, to be handled by the previous handler.
+   */
+  static void on_fatal_signal(int signo) {
+    flush_all(false);
+
+    std::signal(signo, previous_signal_handler(signo));
+    std::raise(signo);
+  }
+
+  static void unregister_writer(Async_writer *writer) {
+    auto &w = writers();
+    std::lock_guard lock{w.mutex};
+    w.list.erase(std::remove(w.list.begin(), w.list.end(), writer),
+                 w.list.end());
+  }
+
+  Ring_buffer *thread_buffer() {
+    auto &registrations = s_thread_buffers.registrations;
+
+    for (const auto &r : registrations) {
+      if (r.writer_id == m_id) {
+        return r.buffer.get();
+      }
+    }
+
+    std::shared_ptr<Ring_buffer> buffer;
+
+    {
+      std::lock_guard lock{m_buffers_mutex};
+
+      for (const auto &b : m_buffers) {
+        // reuse buffers of the threads which have finished
+        if (b->acquire()) {
+          buffer = b;
+          break;
+        }
+      }
+
+      if (!buffer) {
+        if (m_buffers.size() >= k_max_buffers) {
+          return nullptr;
+        }
+
+        buffer = std::make_shared<Ring_buffer>();
+        m_buffers.emplace_back(buffer);
+      }
+    }
+
+    // IDs are never reused, entries of the writers which no longer exist are
+    // harmless, just keep their number in check
+    constexpr std::size_t k_max_registrations = 16;
+
+    if (registrations.size() >= k_max_registrations) {
+      registrations.front().buffer->release();
+      registrations.erase(registrations.begin());
+    }
+
+    registrations.push_back({m_id, buffer});
+
+    return buffer.get();
+  }
+
+  /**
+   * Writes the buffered entries, requires m_flush_mutex to be locked. If wait
+   * is false and the list of buffers is being modified, does nothing.
+   */
+  void drain(bool wait = true) {
+    // entries with lower sequence numbers can still be on their way to the
+    // buffers, but all of them have been assigned a number below this one
+    const auto limit = m_sequence.load();
+    std::vector<std::shared_ptr<Ring_buffer>> buffers;
+
+    {
+      std::unique_lock lock{m_buffers_mutex, std::defer_lock};
+
+      if (wait) {
+        lock.lock();
+      } else if (!lock.try_lock()) {
+        return;
+      }
+
+      buffers = m_buffers;
+    }
+
+    for (const auto &buffer : buffers) {
+      buffer->pop_all([this](uint64_t sequence, std::string &&entry) {
+        m_batch.emplace_back(sequence, std::move(entry));
+      });
+    }
+
+    std::sort(m_batch.begin(), m_batch.end(),
+              [](const auto &l, const auto &r) { return l.first < r.first; });
+
+    // entries logged after the writing has started are held back, otherwise
+    // they could be written before the entries logged earlier by the threads
+    // whose buffers have already been emptied
+    const auto end = std::partition_point(
+        m_batch.begin(), m_batch.end(),
+        [limit](const auto &entry) { return entry.first < limit; });
+
+    for (auto it = m_batch.begin(); it != end; ++it) {
+      m_logger->write_to_file(it->second);
+    }
+
+    m_batch.erase(m_batch.begin(), end);
+  }
+
+  void run() {
+    std::unique_lock lock{m_wakeup_mutex};
+
+    while (!m_stop) {
+      m_wakeup.wait_for(lock, k_flush_interval,
+                        [this]() { return m_stop || m_flush_requested; });
+      m_flush_requested = false;
+
+      lock.unlock();
+      flush();
+      lock.lock();
+    }
+  }
+
+  Logger *m_logger;
+  const uint64_t m_id = ++s_next_id;
+  std::atomic<uint64_t> m_sequence{0};
+
+  std::mutex m_buffers_mutex;
+  std::vector<std::shared_ptr<Ring_buffer>> m_buffers;
+
+  // held while the log file is being written
+  std::mutex m_flush_mutex;
+  // entries which are about to be written or were held back
+  std::vector<std::pair<uint64_t, std::string>> m_batch;
+
+  std::mutex m_wakeup_mutex;
+  std::condition_variable m_wakeup;
+  bool m_stop = false;
+  std::atomic<bool> m_flush_requested{false};
+
+  std::thread m_thread;
+};
+
 void Logger::attach_log_hook(Log_hook hook, void *user_data, bool catch_all) {
   if (hook) {
     std::lock_guard l{m_mutex_hooks};
@@ -233,22 +655,10 @@ void Logger::do_log(const Log_entry &entry) {
 
 void Logger::do_log(const std::shared_ptr<shcore::Logger> &logger,
                     const Log_entry &entry) {
-  std::lock_guard lg{g_mutex};
-
-  if (entry.level <= logger->m_log_level) {
-#ifdef _WIN32
-    if (logger->m_log_file.is_open()) {
-      const auto s = format_message(entry);
-      logger->m_log_file.write(s.c_str(), s.length());
-      logger->m_log_file.flush();
-    }
-#else
-    if (logger->m_log_file) {
-      const auto s = format_message(entry);
-      fwrite(s.c_str(), s.length(), 1, logger->m_log_file);
-      fflush(logger->m_log_file);
-    }
-#endif
+  if (entry.level <= logger->m_log_level && logger->m_async_writer) {
+    // errors are written immediately, in case the process is about to crash
+    logger->m_async_writer->write(format_message(entry),
+                                  entry.level <= LOG_ERROR);
   }
 
   std::lock_guard lh{logger->m_mutex_hooks};
@@ -259,6 +669,28 @@ void Logger::do_log(const std::shared_ptr<shcore::Logger> &logger,
   }
 }
 
+void Logger::flush() {
+  if (m_async_writer) {
+    m_async_writer->flush();
+  }
+}
+
+void Logger::write_to_file(std::string_view data) {
+#ifdef _WIN32
+  m_log_file.write(data.data(), data.length());
+#else
+  fwrite(data.data(), data.length(), 1, m_log_file);
+#endif
+}
+
+void Logger::flush_file() {
+#ifdef _WIN32
+  m_log_file.flush();
+#else
+  fflush(m_log_file);
+#endif
+}
+
 bool Logger::will_log(LOG_LEVEL level) const {
   if (level <= m_log_level) return true;
 
@@ -425,6 +857,8 @@ Logger::Logger(const char *filename, bool use_stderr) : m_dont_log(0) {
           "' for writing: " + shcore::errno_to_string(errno));
     }
 #endif
+
+    m_async_writer = std::make_unique<Async_writer>(this);
   }
 
   if (use_stderr) {
@@ -433,6 +867,9 @@ Logger::Logger(const char *filename, bool use_stderr) : m_dont_log(0) {
 }
 
 Logger::~Logger() {
+  // writes the remaining entries
+  m_async_writer.reset();
+
 #ifdef _WIN32
   if (m_log_file.is_open()) {
     m_log_file.close();
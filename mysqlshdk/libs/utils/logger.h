@@ -148,9 +148,21 @@ class SHCORE_PUBLIC Logger final {
     return m_initialization_warning;
   }
 
+  /**
+   * Entries are written to the log file asynchronously, this writes all the
+   * entries which were logged so far.
+   */
+  void flush();
+
  private:
+  class Async_writer;
+
   Logger(const char *filename, bool use_stderr);
 
+  void write_to_file(std::string_view data);
+
+  void flush_file();
+
   static void out_to_stderr(const Log_entry &entry, void *);
 
   static std::string format_message(const Log_entry &entry);
@@ -173,6 +185,7 @@ class SHCORE_PUBLIC Logger final {
   FILE *m_log_file = nullptr;
 #endif
   std::string m_log_file_name;
+  std::unique_ptr<Async_writer> m_async_writer;
 
   mutable std::mutex m_mutex_hooks;
   std::list<std::tuple<Log_hook, void *, bool>> m_hook_list;
@@ -35,6 +35,7 @@
 #include <vector>
 
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
 
 namespace shcore {
 
@@ -166,7 +167,7 @@ class Thread_pool final {
 
   volatile bool m_all_tasks_pushed = false;
 
-  Synchronized_queue<Task> m_worker_tasks;
+  Work_stealing_queue<Task> m_worker_tasks;
 
   Synchronized_queue<std::function<void()>> m_main_thread_tasks;
 
@@ -26,7 +26,9 @@
 #ifndef MYSQLSHDK_LIBS_UTILS_THREADS_H_
 #define MYSQLSHDK_LIBS_UTILS_THREADS_H_
 
+#include <algorithm>
 #include <atomic>
+#include <exception>
 #include <functional>
 #include <string>
 #include <thread>
@@ -79,6 +81,64 @@ OutputT map_reduce(InputIter begin, InputIter end, MapF map, ReduceF reduce) {
   return result;
 }
 
+/**
+ * Calls fn(i) for each i in [0, count), using at most max_threads worker
+ * threads, returns once all calls are finished.
+ *
+ * Calls are not executed in any particular order, each one should store its
+ * result in a slot reserved for its index, so that the caller can merge the
+ * results in a deterministic order.
+ *
+ * If a call throws, the remaining items are not processed and the exception
+ * thrown by the call with the lowest index is rethrown in the caller's thread.
+ */
+template <class F>
+void parallel_for(std::size_t count, std::size_t max_threads, F fn) {
+  if (0 == count) return;
+
+  const auto threads = std::min(count, std::max<std::size_t>(max_threads, 1));
+  std::atomic<std::size_t> next{0};
+  std::atomic<bool> failed{false};
+  std::vector<std::exception_ptr> errors(count);
+  std::vector<std::thread> workers;
+
+  const auto work = [&]() {
+    for (auto i = next++; i < count && !failed; i = next++) {
+      try {
+        fn(i);
+      } catch (...) {
+        errors[i] = std::current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  try {
+    workers.reserve(threads);
+
+    for (std::size_t t = 0; t < threads; ++t) {
+      workers.emplace_back(mysqlsh::spawn_scoped_thread(work));
+    }
+  } catch (...) {
+    // couldn't start a thread, stop the ones which are already running
+    failed = true;
+
+    for (auto &w : workers) {
+      w.join();
+    }
+
+    throw;
+  }
+
+  for (auto &w : workers) {
+    w.join();
+  }
+
+  for (const auto &e : errors) {
+    if (e) std::rethrow_exception(e);
+  }
+}
+
 }  // namespace utils
 }  // namespace mysqlshdk
 
@@ -53,6 +53,17 @@ void Buffered_input::open(const std::string &filepath_) {
   }
 }
 
+void Buffered_input::open(const char *data, size_t size, size_t offset) {
+  close();
+
+  m_fd = -1;
+  m_in_memory = true;
+  m_eof = false;
+  m_pos = reinterpret_cast<byte *>(const_cast<char *>(data));
+  m_end = m_pos + size;
+  m_bytes_processed = offset;
+}
+
 void Buffered_input::close() {
   if (m_fd > 0) {
 #ifdef _WIN32
@@ -61,6 +72,8 @@ void Buffered_input::close() {
     ::close(m_fd);
 #endif
   }
+
+  m_in_memory = false;
 }
 
 std::string Buffered_input::get_double_quoted_string() {
@@ -92,6 +105,15 @@ void Buffered_input::fill_buffer() {
   }
 
   m_pos = m_buffer;
+
+  if (m_in_memory) {
+    // whole block was already consumed
+    m_end = m_buffer;
+    m_eof = true;
+    *m_pos = '\0';
+    return;
+  }
+
 #ifdef _WIN32
   int bytes = ::_read(m_fd, m_buffer, BUFFER_SIZE);
 #else
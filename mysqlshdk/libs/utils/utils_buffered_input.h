@@ -53,6 +53,17 @@ class Buffered_input {
 
   void open(const std::string &filepath_);
 
+  /**
+   * Reads from the given memory block instead of a file. The memory has to
+   * remain valid until the input is closed or reopened.
+   *
+   * @param data Start of the block.
+   * @param size Size of the block.
+   * @param offset Offset of the block in the original input, used to report
+   *        positions.
+   */
+  void open(const char *data, size_t size, size_t offset = 0);
+
   bool eof() { return m_eof; }
 
   byte peek() {
@@ -91,6 +102,7 @@ class Buffered_input {
   static constexpr const size_t BUFFER_SIZE = 1 << 16;
   int m_fd = 0;
   bool m_eof = false;
+  bool m_in_memory = false;
   byte m_buffer[BUFFER_SIZE];
   byte *m_pos = m_buffer;
   byte *m_end = m_buffer;
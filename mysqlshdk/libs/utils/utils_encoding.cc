@@ -27,13 +27,288 @@
 
 #include <openssl/evp.h>
 #include <cassert>
+#include <cstdint>
 #include <memory>
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UTILS_ENCODING_SSE2
+#include <emmintrin.h>
+// AVX2 is not a part of the baseline, kernel is compiled for that target and
+// selected at runtime
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define UTILS_ENCODING_AVX2
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define UTILS_ENCODING_NEON
+#include <arm_neon.h>
+#endif
+
 namespace shcore {
 namespace {
 using BIO_ptr = std::unique_ptr<BIO, decltype(&::BIO_free)>;
+
+constexpr char k_base64_alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+constexpr char k_hex_digits[] = "0123456789ABCDEF";
+
+/**
+ * Encodes the remaining bytes, adds padding if needed.
+ */
+std::size_t encode_base64_scalar(const unsigned char *source,
+                                 std::size_t length, char *target) {
+  const auto begin = target;
+
+  for (; length >= 3; length -= 3, source += 3) {
+    const uint32_t v = (source[0] << 16) | (source[1] << 8) | source[2];
+
+    *target++ = k_base64_alphabet[(v >> 18) & 0x3F];
+    *target++ = k_base64_alphabet[(v >> 12) & 0x3F];
+    *target++ = k_base64_alphabet[(v >> 6) & 0x3F];
+    *target++ = k_base64_alphabet[v & 0x3F];
+  }
+
+  if (length > 0) {
+    const uint32_t v =
+        (source[0] << 16) | (length > 1 ? source[1] << 8 : 0);
+
+    *target++ = k_base64_alphabet[(v >> 18) & 0x3F];
+    *target++ = k_base64_alphabet[(v >> 12) & 0x3F];
+    *target++ = length > 1 ? k_base64_alphabet[(v >> 6) & 0x3F] : '=';
+    *target++ = '=';
+  }
+
+  return target - begin;
+}
+
+std::size_t encode_hex_scalar(const unsigned char *source, std::size_t length,
+                              char *target) {
+  for (std::size_t i = 0; i < length; ++i) {
+    *target++ = k_hex_digits[source[i] >> 4];
+    *target++ = k_hex_digits[source[i] & 0x0F];
+  }
+
+  return 2 * length;
+}
+
+using Encoder = std::size_t (*)(const unsigned char *, std::size_t, char *);
+
+#if defined(UTILS_ENCODING_SSE2)
+
+/**
+ * Converts each of the nibbles to a hexadecimal digit.
+ */
+inline __m128i hex_digits_sse2(__m128i nibbles) {
+  // '0' + n, 'A' - '0' - 10 is added to the values greater than 9
+  const auto digits = _mm_add_epi8(nibbles, _mm_set1_epi8('0'));
+  const auto letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)),
+                                     _mm_set1_epi8('A' - '0' - 10));
+  return _mm_add_epi8(digits, letters);
+}
+
+std::size_t encode_hex_sse2(const unsigned char *source, std::size_t length,
+                            char *target) {
+  const auto mask = _mm_set1_epi8(0x0F);
+  std::size_t i = 0;
+
+  for (; i + 16 <= length; i += 16) {
+    const auto block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+    const auto high =
+        hex_digits_sse2(_mm_and_si128(_mm_srli_epi16(block, 4), mask));
+    const auto low = hex_digits_sse2(_mm_and_si128(block, mask));
+
+    // high nibble of each byte is written first
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(target + 2 * i),
+                     _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(target + 2 * i + 16),
+                     _mm_unpackhi_epi8(high, low));
+  }
+
+  return 2 * i + encode_hex_scalar(source + i, length - i, target + 2 * i);
+}
+
+#endif  // UTILS_ENCODING_SSE2
+
+#if defined(UTILS_ENCODING_AVX2)
+
+/**
+ * Vectorized base64 encoding, based on the algorithm described in:
+ * W. Mula, D. Lemire, "Faster Base64 Encoding and Decoding Using AVX2
+ * Instructions", ACM Transactions on the Web 12 (3), 2018.
+ *
+ * Each 128-bit lane holds 12 bytes of input, which are split into 16 6-bit
+ * values and then translated into the characters of the alphabet.
+ */
+__attribute__((target("avx2"))) std::size_t encode_base64_avx2(
+    const unsigned char *source, std::size_t length, char *target) {
+  const auto begin = target;
+
+  // each 32-bit word holds bytes [b, a, c, b] of the input triple [a, b, c]
+  const auto shuffle = _mm256_setr_epi8(
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,  //
+      1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  // offsets added to the 6-bit values to get the characters
+  const auto offsets = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+  // 16 bytes are loaded for each of the lanes, only 12 are used
+  while (length >= 28) {
+    const auto input = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(source))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 12)), 1);
+    const auto in = _mm256_shuffle_epi8(input, shuffle);
+
+    // first and third value of each word
+    const auto t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    const auto t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    // second and fourth value of each word
+    const auto t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    const auto t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const auto values = _mm256_or_si256(t1, t3);
+
+    // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+    auto index = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+    index = _mm256_or_si256(
+        index, _mm256_and_si256(
+                   _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values),
+                   _mm256_set1_epi8(13)));
+
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i *>(target),
+        _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, index)));
+
+    source += 24;
+    length -= 24;
+    target += 32;
+  }
+
+  return target - begin + encode_base64_scalar(source, length, target);
+}
+
+__attribute__((target("avx2"))) inline __m256i hex_digits_avx2(
+    __m256i nibbles) {
+  const auto digits = _mm256_add_epi8(nibbles, _mm256_set1_epi8('0'));
+  const auto letters =
+      _mm256_and_si256(_mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9)),
+                       _mm256_set1_epi8('A' - '0' - 10));
+  return _mm256_add_epi8(digits, letters);
+}
+
+__attribute__((target("avx2"))) std::size_t encode_hex_avx2(
+    const unsigned char *source, std::size_t length, char *target) {
+  const auto mask = _mm256_set1_epi8(0x0F);
+  std::size_t i = 0;
+
+  for (; i + 32 <= length; i += 32) {
+    const auto block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+    const auto high =
+        hex_digits_avx2(_mm256_and_si256(_mm256_srli_epi16(block, 4), mask));
+    const auto low = hex_digits_avx2(_mm256_and_si256(block, mask));
+    // unpack works within the lanes: [0..7, 16..23], [8..15, 24..31]
+    const auto first = _mm256_unpacklo_epi8(high, low);
+    const auto second = _mm256_unpackhi_epi8(high, low);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(target + 2 * i),
+                        _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(target + 2 * i + 32),
+                        _mm256_permute2x128_si256(first, second, 0x31));
+  }
+
+  return 2 * i + encode_hex_sse2(source + i, length - i, target + 2 * i);
+}
+
+#endif  // UTILS_ENCODING_AVX2
+
+#if defined(UTILS_ENCODING_NEON)
+
+std::size_t encode_base64_neon(const unsigned char *source, std::size_t length,
+                               char *target) {
+  const auto begin = target;
+  const uint8x16x4_t alphabet =
+      vld1q_u8_x4(reinterpret_cast<const uint8_t *>(k_base64_alphabet));
+  const auto mask = vdupq_n_u8(0x3F);
+
+  for (; length >= 48; length -= 48, source += 48, target += 64) {
+    // de-interleaves the triples, val[0] holds the first bytes, etc.
+    const auto in = vld3q_u8(source);
+    uint8x16x4_t out;
+
+    out.val[0] = vshrq_n_u8(in.val[0], 2);
+    out.val[1] = vandq_u8(
+        vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+    out.val[2] = vandq_u8(
+        vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+    out.val[3] = vandq_u8(in.val[2], mask);
+
+    for (auto &v : out.val) {
+      v = vqtbl4q_u8(alphabet, v);
+    }
+
+    vst4q_u8(reinterpret_cast<uint8_t *>(target), out);
+  }
+
+  return target - begin + encode_base64_scalar(source, length, target);
+}
+
+std::size_t encode_hex_neon(const unsigned char *source, std::size_t length,
+                            char *target) {
+  const auto digits = vld1q_u8(reinterpret_cast<const uint8_t *>(k_hex_digits));
+  std::size_t i = 0;
+
+  for (; i + 16 <= length; i += 16) {
+    const auto block = vld1q_u8(source + i);
+    uint8x16x2_t out;
+
+    out.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(block, 4));
+    out.val[1] = vqtbl1q_u8(digits, vandq_u8(block, vdupq_n_u8(0x0F)));
+
+    // interleaves the digits, high nibble of each byte is written first
+    vst2q_u8(reinterpret_cast<uint8_t *>(target + 2 * i), out);
+  }
+
+  return 2 * i + encode_hex_scalar(source + i, length - i, target + 2 * i);
+}
+
+#endif  // UTILS_ENCODING_NEON
+
+Encoder base64_encoder() {
+#if defined(UTILS_ENCODING_AVX2)
+  if (__builtin_cpu_supports("avx2")) {
+    return encode_base64_avx2;
+  }
+#elif defined(UTILS_ENCODING_NEON)
+  return encode_base64_neon;
+#endif
+
+  return encode_base64_scalar;
+}
+
+Encoder hex_encoder() {
+#if defined(UTILS_ENCODING_AVX2)
+  if (__builtin_cpu_supports("avx2")) {
+    return encode_hex_avx2;
+  }
+#endif
+
+#if defined(UTILS_ENCODING_SSE2)
+  return encode_hex_sse2;
+#elif defined(UTILS_ENCODING_NEON)
+  return encode_hex_neon;
+#else
+  return encode_hex_scalar;
+#endif
 }
 
+}  // namespace
+
 bool decode_base64(const std::string &source, std::string *target) {
   assert(target);
   //--- Unencodes the Public Key Data
@@ -76,4 +351,17 @@ bool encode_base64(const unsigned char *source, int source_length,
   return false;
 }
 
+std::size_t encode_base64(const char *source, std::size_t length,
+                          char *target) {
+  static const auto encoder = base64_encoder();
+  return encoder(reinterpret_cast<const unsigned char *>(source), length,
+                 target);
+}
+
+std::size_t encode_hex(const char *source, std::size_t length, char *target) {
+  static const auto encoder = hex_encoder();
+  return encoder(reinterpret_cast<const unsigned char *>(source), length,
+                 target);
+}
+
 }  // namespace shcore
@@ -26,6 +26,7 @@
 #ifndef MYSQLSHDK_LIBS_UTILS_ENCODING_H_
 #define MYSQLSHDK_LIBS_UTILS_ENCODING_H_
 
+#include <cstddef>
 #include <string>
 
 namespace shcore {
@@ -39,6 +40,40 @@ namespace shcore {
 bool decode_base64(const std::string &source, std::string *target);
 bool encode_base64(const unsigned char *source, int source_length,
                    std::string *encoded);
+
+/**
+ * Number of characters needed to encode the given number of bytes using
+ * base64.
+ */
+constexpr std::size_t base64_encoded_length(std::size_t length) {
+  return (length + 2) / 3 * 4;
+}
+
+/**
+ * Encodes data using base64 (padded, without line breaks), directly into the
+ * given buffer. Uses SIMD instructions if they are supported by the CPU.
+ *
+ * @param source data to be encoded
+ * @param length length of the data
+ * @param target buffer with at least base64_encoded_length(length) bytes
+ *
+ * @returns number of characters written
+ */
+std::size_t encode_base64(const char *source, std::size_t length,
+                          char *target);
+
+/**
+ * Encodes data using upper case hexadecimal digits (like the HEX() SQL
+ * function), directly into the given buffer. Uses SIMD instructions if they
+ * are supported by the CPU.
+ *
+ * @param source data to be encoded
+ * @param length length of the data
+ * @param target buffer with at least 2 * length bytes
+ *
+ * @returns number of characters written
+ */
+std::size_t encode_hex(const char *source, std::size_t length, char *target);
 }  // namespace shcore
 
 #endif  // MYSQLSHDK_LIBS_UTILS_ENCODING_H_
@@ -25,57 +25,143 @@
 
 #include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
 #include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <iterator>
 #include <sstream>
 #include <tuple>
 #include <utility>
-#include "mysqlshdk/libs/utils/utils_lexing.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SQL_SPLITTER_SSE2
+#include <emmintrin.h>
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define SQL_SPLITTER_NEON
+#include <arm_neon.h>
+#endif
+
 namespace mysqlshdk {
 namespace utils {
 
 namespace {
 
-template <const char skip_table[256], const char quote>
-inline char *span_string(char *p, const char *end, bool no_backslash_escapes) {
-  char skip_table_backslash[256];
-  if (no_backslash_escapes) {
-    std::memcpy(skip_table_backslash, skip_table, 256);
-    skip_table_backslash[static_cast<unsigned char>('\\')] = 1;
+/**
+ * Finds the first occurrence of any of the N given characters. Where SIMD
+ * instructions are available, input is compared 16 bytes at a time, so that
+ * long runs of characters which are not interesting to the splitter (i.e.
+ * values of an extended INSERT) are skipped in bulk.
+ */
+template <size_t N>
+class Char_finder final {
+ public:
+  explicit Char_finder(const std::array<char, N> &chars) : m_chars(chars) {
+#if defined(SQL_SPLITTER_SSE2)
+    for (size_t i = 0; i < N; ++i) m_vectors[i] = _mm_set1_epi8(m_chars[i]);
+#elif defined(SQL_SPLITTER_NEON)
+    for (size_t i = 0; i < N; ++i) {
+      m_vectors[i] = vdupq_n_u8(static_cast<uint8_t>(m_chars[i]));
+    }
+#endif
   }
 
-  auto target_table = no_backslash_escapes ? skip_table_backslash : skip_table;
+  /**
+   * Returns pointer to the first matching character in [p, end), or a
+   * pointer >= end if there's none.
+   */
+  char *find(char *p, const char *end) const {
+#if defined(SQL_SPLITTER_SSE2)
+    while (end - p >= 16) {
+      const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+      auto matches = _mm_cmpeq_epi8(block, m_vectors[0]);
+
+      for (size_t i = 1; i < N; ++i) {
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, m_vectors[i]));
+      }
 
-  // p must be inside the single quote string (after the ')
-  int last_ch = 0;
-  for (;;) {
-    // Tight-loop to span until end or closing quote
-    while (p < end &&
-           target_table[last_ch = static_cast<unsigned char>(*p)] > 0) {
-      p += target_table[last_ch];
+      if (const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches))) {
+#ifdef _WIN32
+        unsigned long x = 0;
+        (void)_BitScanForward(&x, mask);
+#else
+        const auto x = __builtin_ctz(mask);
+#endif
+        return p + x;
+      }
+
+      p += 16;
+    }
+#elif defined(SQL_SPLITTER_NEON)
+    while (end - p >= 16) {
+      const auto block = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+      auto matches = vceqq_u8(block, m_vectors[0]);
+
+      for (size_t i = 1; i < N; ++i) {
+        matches = vorrq_u8(matches, vceqq_u8(block, m_vectors[i]));
+      }
+
+      // narrow the 128-bit result to a 64-bit mask with 4 bits per byte
+      const uint64_t mask = vget_lane_u64(
+          vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)),
+          0);
+
+      if (mask) return p + (__builtin_ctzll(mask) >> 2);
+
+      p += 16;
     }
+#endif
 
-    // Now check why we exited the loop
-    if (last_ch == '\0' || p >= end) {
-      // there was a '\0', but the string is not over, continue spanning
-      if (p < end) {
-        ++p;
-        continue;
+    for (; p < end; ++p) {
+      for (const auto c : m_chars) {
+        if (*p == c) return p;
       }
-      // string is over and we didn't see a ', so it's an unterminated string
-      // if the last char we saw was an escape we need to remember escaping
-      // the first char of the next block
+    }
+
+    return p;
+  }
+
+ private:
+  std::array<char, N> m_chars;
+#if defined(SQL_SPLITTER_SSE2)
+  __m128i m_vectors[N];
+#elif defined(SQL_SPLITTER_NEON)
+  uint8x16_t m_vectors[N];
+#endif
+};
+
+template <const char quote>
+inline char *span_string(char *p, const char *end, bool no_backslash_escapes) {
+  // if backslash escapes are disabled, look just for the quote
+  const Char_finder<2> finder{{quote, no_backslash_escapes ? quote : '\\'}};
+
+  // p must be inside the quoted string (after the opening quote)
+  for (;;) {
+    p = finder.find(p, end);
+
+    if (p >= end) {
+      // string is over and we didn't see a quote, so it's an unterminated
+      // string, if the last char we saw was an escape, p is past the end
       return nullptr;
     }
-    // the only other possible way to exit the loop must be the end quote
-    assert(last_ch == quote);
+
+    if (*p == '\\') {
+      // skip the escaped character
+      p += 2;
+      continue;
+    }
+
     // continue if there's another quote following the quote
     if (*(p + 1) == quote) {
       p += 2;
       continue;
     }
+
     return p + 1;
   }
 }
@@ -243,6 +329,14 @@ bool Sql_splitter::next_range(Sql_splitter::Range *out_range,
     }
   }
 
+  // characters which may change the state of the splitter once a statement
+  // has started, everything else is skipped in bulk
+  const auto new_statement_finder = [this]() {
+    return Char_finder<8>{
+        {m_delimiter[0], '\\', '\'', '"', '`', '/', '#', '-'}};
+  };
+  auto statement_finder = new_statement_finder();
+
   size_t line_count = 0;
   char *next_bol = bos;  // beginning of next line
   while (next_bol < m_end) {
@@ -286,6 +380,14 @@ bool Sql_splitter::next_range(Sql_splitter::Range *out_range,
       auto ctx = context();
       if (ctx == Context::kNone || ctx == Context::kStatement ||
           ctx == Context::kCommentConditional) {
+        if (ctx == Context::kStatement) {
+          p = statement_finder.find(p, eol);
+          if (p >= eol) {
+            p = eol;
+            continue;
+          }
+        }
+
         if (ctx == Context::kCommentConditional) {
           if ((eol - p) > 2 && *p == '*' && *(p + 1) == '/') {
             pop();
@@ -407,6 +509,7 @@ bool Sql_splitter::next_range(Sql_splitter::Range *out_range,
                   char *end = skip_not_blanks(p, eol);
                   set_delimiter(std::string(p, end - p));
                 }
+                statement_finder = new_statement_finder();
                 bos = p = next_bol;
                 pop();
                 last_line_was_delimiter = true;
@@ -505,8 +608,7 @@ bool Sql_splitter::next_range(Sql_splitter::Range *out_range,
           break;
 
         case Context::kSQuoteString:
-          p = span_string<internal::k_quoted_string_span_skips_sq, '\''>(
-              p, eol, m_no_backslash_escapes);
+          p = span_string<'\''>(p, eol, m_no_backslash_escapes);
           if (!p) {  // closing quote missing
             if (has_complete_line) {
               p = eol;
@@ -519,8 +621,7 @@ bool Sql_splitter::next_range(Sql_splitter::Range *out_range,
           break;
 
         case Context::kDQuoteString:
-          p = span_string<internal::k_quoted_string_span_skips_dq, '"'>(
-              p, eol, m_no_backslash_escapes);
+          p = span_string<'"'>(p, eol, m_no_backslash_escapes);
           if (!p) {  // closing quote missing
             if (has_complete_line) {
               p = eol;
@@ -0,0 +1,515 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
+#define MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+namespace shcore {
+
+namespace detail {
+
+/**
+ * Indexes of the local queues, threads release them when they exit, so that
+ * they can be reused by other consumers.
+ */
+class Work_stealing_slots final {
+ public:
+  explicit Work_stealing_slots(std::size_t max) : m_max(max) {}
+
+  /**
+   * Returns a free index, or max if all of them are in use.
+   */
+  std::size_t acquire() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_free.empty()) {
+      const auto index = m_free.back();
+      m_free.pop_back();
+      return index;
+    }
+
+    if (m_count < m_max) {
+      return m_count++;
+    }
+
+    return m_max;
+  }
+
+  void release(std::size_t index) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_free.emplace_back(index);
+  }
+
+  /**
+   * Number of indexes which were ever used.
+   */
+  std::size_t count() const { return m_count; }
+
+ private:
+  const std::size_t m_max;
+  std::mutex m_mutex;
+  std::vector<std::size_t> m_free;
+  std::atomic<std::size_t> m_count{0};
+};
+
+struct Work_stealing_registration {
+  uint64_t queue_id;
+  // index of the local queue, k_no_local_queue if thread uses the global one
+  std::size_t index;
+  std::weak_ptr<Work_stealing_slots> slots;
+};
+
+/**
+ * Local queues of the calling thread, as registered by the queues it consumed.
+ */
+class Work_stealing_registrations final {
+ public:
+  Work_stealing_registrations() = default;
+  Work_stealing_registrations(const Work_stealing_registrations &) = delete;
+  Work_stealing_registrations(Work_stealing_registrations &&) = delete;
+
+  Work_stealing_registrations &operator=(const Work_stealing_registrations &) =
+      delete;
+  Work_stealing_registrations &operator=(Work_stealing_registrations &&) =
+      delete;
+
+  ~Work_stealing_registrations() {
+    for (const auto &r : m_entries) {
+      release(r);
+    }
+  }
+
+  const Work_stealing_registration *find(uint64_t queue_id) const {
+    for (const auto &r : m_entries) {
+      if (r.queue_id == queue_id) {
+        return &r;
+      }
+    }
+
+    return nullptr;
+  }
+
+  void add(Work_stealing_registration r) {
+    // drop the entries of the queues which no longer exist
+    m_entries.erase(
+        std::remove_if(m_entries.begin(), m_entries.end(),
+                       [](const auto &e) { return e.slots.expired(); }),
+        m_entries.end());
+    m_entries.emplace_back(std::move(r));
+  }
+
+ private:
+  static void release(const Work_stealing_registration &r) {
+    if (const auto slots = r.slots.lock()) {
+      slots->release(r.index);
+    }
+  }
+
+  std::vector<Work_stealing_registration> m_entries;
+};
+
+inline thread_local Work_stealing_registrations g_work_stealing_registrations;
+
+inline std::atomic<uint64_t> g_work_stealing_queue_id{0};
+
+}  // namespace detail
+
+/**
+ * Multiple producer, multiple consumer queue which can be used in place of
+ * Synchronized_queue by a set of worker threads.
+ *
+ * Each thread which consumes from the queue gets its own local queue, items
+ * pushed by a consumer thread are stored there, while items pushed by other
+ * threads (i.e. the main thread) are stored in a global injection queue.
+ * Consumers take items from their local queue first, then move a batch of
+ * items from the global queue, and once both are empty, they steal items from
+ * the local queues of other consumers. This way consumers mostly contend on
+ * their own locks instead of on a single lock shared by everyone.
+ *
+ * Priorities have the same meaning as in Synchronized_queue: an item is never
+ * returned if there's an item with a higher priority in any of the queues.
+ * Order of items with the same priority is FIFO within each of the queues,
+ * but is not guaranteed across the queues.
+ */
+template <class T>
+class Work_stealing_queue final {
+ public:
+  Work_stealing_queue() = default;
+  Work_stealing_queue(const Work_stealing_queue &other) = delete;
+  Work_stealing_queue(Work_stealing_queue &&other) = delete;
+
+  Work_stealing_queue &operator=(const Work_stealing_queue &other) = delete;
+  Work_stealing_queue &operator=(Work_stealing_queue &&other) = delete;
+
+  ~Work_stealing_queue() = default;
+
+  template <class U = T>
+  void push(U &&r, Queue_priority p = Queue_priority::MEDIUM) {
+    const auto lane = k_max_priority - map_priority(p);
+
+    // counters are updated first, so they never underflow
+    item_added(lane);
+
+    if (const auto local = local_queue(false)) {
+      local->push(std::forward<U>(r), lane);
+    } else {
+      m_global.push(std::forward<U>(r), lane);
+    }
+
+    if (m_sleepers > 0) {
+      // synchronize with a consumer which is about to wait
+      { std::lock_guard<std::mutex> lock(m_sleep_mutex); }
+      m_task_ready.notify_one();
+    }
+  }
+
+  T pop() {
+    while (true) {
+      if (auto r = try_take()) {
+        return std::move(*r);
+      }
+
+      std::unique_lock<std::mutex> lock(m_sleep_mutex);
+      ++m_sleepers;
+      m_task_ready.wait(lock, [this]() { return !empty(); });
+      --m_sleepers;
+    }
+  }
+
+  std::optional<T> try_pop(std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (true) {
+      if (auto r = try_take()) {
+        return r;
+      }
+
+      std::unique_lock<std::mutex> lock(m_sleep_mutex);
+      ++m_sleepers;
+      const auto ready = m_task_ready.wait_until(
+          lock, deadline, [this]() { return !empty(); });
+      --m_sleepers;
+
+      if (!ready) {
+        return {};
+      }
+    }
+  }
+
+  /**
+   * Method that push to the queue n guard objects that signals to consumer
+   * threads to complete operation.
+   *
+   * @param n number of consumer threads.
+   */
+  void shutdown(int64_t n) {
+    for (int64_t i = 0; i < n; i++) {
+      item_added(k_shutdown_lane);
+      m_global.push(T(), k_shutdown_lane);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_sleep_mutex);
+    }
+    m_task_ready.notify_all();
+  }
+
+  size_t size() const { return m_size; }
+
+  /**
+   * Number of local queues, consumer threads reuse queues of the threads
+   * which already exited.
+   */
+  size_t local_queues() const { return m_slots->count(); }
+
+ private:
+  using Priority_t = std::underlying_type_t<Queue_priority>;
+
+  static constexpr Priority_t map_priority(Queue_priority p) {
+    return static_cast<Priority_t>(p);
+  }
+
+  static constexpr Priority_t k_shutdown_priority = 0;
+  static constexpr Priority_t k_max_priority =
+      map_priority(Queue_priority::HIGH);
+  static constexpr std::size_t k_shutdown_lane =
+      k_max_priority - k_shutdown_priority;
+  static constexpr std::size_t k_lanes = k_shutdown_lane + 1;
+
+  // consumers above this limit use just the global queue
+  static constexpr std::size_t k_max_local_queues = 256;
+  static constexpr std::size_t k_no_local_queue = k_max_local_queues;
+  // maximum number of items moved from the global queue at once
+  static constexpr std::size_t k_max_batch = 16;
+
+  class alignas(64) Lanes final {
+   public:
+    template <class U>
+    void push(U &&u, std::size_t lane) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_lanes[lane].emplace_back(std::forward<U>(u));
+      ++m_sizes[lane];
+    }
+
+    std::optional<T> pop(std::size_t lane) {
+      if (0 == m_sizes[lane]) {
+        return {};
+      }
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return unsynchronized_pop(lane);
+    }
+
+    /**
+     * Pops an item, moves up to max - 1 following items to the given queue.
+     */
+    std::optional<T> pop_batch(std::size_t lane, std::size_t max,
+                               Lanes *target) {
+      if (0 == m_sizes[lane]) {
+        return {};
+      }
+
+      std::vector<T> batch;
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto &queue = m_lanes[lane];
+        const auto count = std::min(max, queue.size());
+
+        if (0 == count) {
+          return {};
+        }
+
+        batch.reserve(count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+          batch.emplace_back(std::move(queue.front()));
+          queue.pop_front();
+        }
+
+        m_sizes[lane] -= count;
+      }
+
+      if (batch.size() > 1) {
+        std::lock_guard<std::mutex> lock(target->m_mutex);
+        auto &queue = target->m_lanes[lane];
+
+        for (auto it = std::next(batch.begin()); it != batch.end(); ++it) {
+          queue.emplace_back(std::move(*it));
+        }
+
+        target->m_sizes[lane] += batch.size() - 1;
+      }
+
+      return std::move(batch.front());
+    }
+
+    std::size_t size(std::size_t lane) const { return m_sizes[lane]; }
+
+   private:
+    std::optional<T> unsynchronized_pop(std::size_t lane) {
+      auto &queue = m_lanes[lane];
+
+      if (queue.empty()) {
+        return {};
+      }
+
+      auto r = std::move(queue.front());
+      queue.pop_front();
+      --m_sizes[lane];
+
+      return r;
+    }
+
+    std::mutex m_mutex;
+    std::array<std::deque<T>, k_lanes> m_lanes;
+    std::array<std::atomic<std::size_t>, k_lanes> m_sizes{};
+  };
+
+  inline bool empty() const { return 0 == m_size; }
+
+  inline void item_added(std::size_t lane) {
+    ++m_lane_sizes[lane];
+    ++m_size;
+  }
+
+  inline void item_removed(std::size_t lane) {
+    --m_lane_sizes[lane];
+    --m_size;
+  }
+
+  /**
+   * Index of the local queue of the calling thread, registers a new one if
+   * requested. The index is released when the thread exits.
+   */
+  std::size_t local_index(bool register_thread) {
+    auto &registrations = detail::g_work_stealing_registrations;
+
+    if (const auto r = registrations.find(m_id)) {
+      return r->index;
+    }
+
+    if (!register_thread) {
+      return k_no_local_queue;
+    }
+
+    const auto index = m_slots->acquire();
+
+    if (k_no_local_queue == index) {
+      // not released, consumers above the limit use the global queue
+      registrations.add({m_id, index, {}});
+    } else {
+      if (!m_locals[index].load(std::memory_order_acquire)) {
+        // queues of the released indexes are reused, along with their items
+        m_local_storage[index] = std::make_unique<Lanes>();
+        m_locals[index].store(m_local_storage[index].get(),
+                              std::memory_order_release);
+      }
+
+      registrations.add({m_id, index, m_slots});
+    }
+
+    return index;
+  }
+
+  Lanes *local_queue(bool register_thread) {
+    const auto index = local_index(register_thread);
+    return k_no_local_queue == index
+               ? nullptr
+               : m_locals[index].load(std::memory_order_acquire);
+  }
+
+  std::optional<T> try_take() {
+    if (empty()) {
+      return {};
+    }
+
+    const auto index = local_index(true);
+    const auto local = k_no_local_queue == index
+                           ? nullptr
+                           : m_locals[index].load(std::memory_order_acquire);
+    const auto locals = m_slots->count();
+
+    for (std::size_t lane = 0; lane < k_lanes; ++lane) {
+      if (0 == m_lane_sizes[lane]) {
+        continue;
+      }
+
+      std::optional<T> r;
+
+      if (local) {
+        r = local->pop(lane);
+
+        if (!r) {
+          // share the global queue with the other consumers
+          const auto batch = std::clamp<std::size_t>(
+              m_global.size(lane) / (locals + 1), 1, k_max_batch);
+          r = m_global.pop_batch(lane, batch, local);
+        }
+      } else {
+        r = m_global.pop(lane);
+      }
+
+      if (!r) {
+        r = steal(lane, index, locals);
+      }
+
+      if (r) {
+        item_removed(lane);
+        return r;
+      }
+
+      // item is being pushed or was taken by another thread in the meantime,
+      // lanes with a lower priority cannot be used until it's settled
+      break;
+    }
+
+    std::this_thread::yield();
+    return {};
+  }
+
+  std::optional<T> steal(std::size_t lane, std::size_t self,
+                         std::size_t locals) {
+    if (0 == locals) {
+      return {};
+    }
+
+    // start with the next queue, so that victims are spread between thieves
+    const auto start = k_no_local_queue == self ? 0 : self + 1;
+
+    for (std::size_t i = 0; i < locals; ++i) {
+      const auto victim = (start + i) % locals;
+
+      if (victim == self) {
+        continue;
+      }
+
+      if (const auto queue = m_locals[victim].load(std::memory_order_acquire)) {
+        if (auto r = queue->pop(lane)) {
+          return r;
+        }
+      }
+    }
+
+    return {};
+  }
+
+  const uint64_t m_id = ++detail::g_work_stealing_queue_id;
+
+  Lanes m_global;
+
+  std::array<std::atomic<Lanes *>, k_max_local_queues> m_locals{};
+  std::array<std::unique_ptr<Lanes>, k_max_local_queues> m_local_storage;
+  const std::shared_ptr<detail::Work_stealing_slots> m_slots =
+      std::make_shared<detail::Work_stealing_slots>(k_max_local_queues);
+
+  std::array<std::atomic<std::size_t>, k_lanes> m_lane_sizes{};
+  std::atomic<std::size_t> m_size{0};
+
+  std::mutex m_sleep_mutex;
+  std::condition_variable m_task_ready;
+  std::atomic<std::size_t> m_sleepers{0};
+};
+
+}  // namespace shcore
+
+#endif  // MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
@@ -604,6 +604,50 @@ int object_assign(PyShObjObject *self, Py_ssize_t index, PyObject *value) {
   return -1;
 }
 
+int object_getbuffer(PyShObjObject *self, Py_buffer *view, int flags) {
+  view->obj = nullptr;
+
+  if (PyBUF_WRITABLE == (flags & PyBUF_WRITABLE)) {
+    Python_context::set_python_error(PyExc_BufferError,
+                                     "object is not writable");
+    return -1;
+  }
+
+  try {
+    const auto buffer = self->object->get()->buffer();
+    // shape needs to remain valid until the buffer is released
+    const auto shape =
+        new Py_ssize_t[1]{static_cast<Py_ssize_t>(buffer.length)};
+
+    view->obj = reinterpret_cast<PyObject *>(self);
+    Py_INCREF(view->obj);
+
+    view->buf = const_cast<void *>(buffer.data);
+    view->len = shape[0] * buffer.item_size;
+    view->readonly = 1;
+    view->itemsize = buffer.item_size;
+    view->format = PyBUF_FORMAT == (flags & PyBUF_FORMAT)
+                       ? const_cast<char *>(buffer.format)
+                       : nullptr;
+    view->ndim = 1;
+    view->shape = PyBUF_ND == (flags & PyBUF_ND) ? shape : nullptr;
+    view->strides =
+        PyBUF_STRIDES == (flags & PyBUF_STRIDES) ? &view->itemsize : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = shape;
+
+    return 0;
+  } catch (...) {
+    translate_python_exception();
+  }
+
+  return -1;
+}
+
+void object_releasebuffer(PyShObjObject *, Py_buffer *view) {
+  delete[] static_cast<Py_ssize_t *>(view->internal);
+}
+
 PyMethodDef PyShObjMethods[] = {
     {"__callmethod__", (PyCFunction)object_callmethod, METH_VARARGS, call_doc},
     {"__dir__", (PyCFunction)object_dir_method, METH_NOARGS, nullptr},
@@ -623,6 +667,12 @@ PySequenceMethods PyShObject_as_sequence = {
     0   // ssizeargfunc sq_inplace_repeat;
 };
 
+PyBufferProcs PyShObj_as_buffer = {
+    (getbufferproc)object_getbuffer,          // getbufferproc bf_getbuffer;
+    (releasebufferproc)object_releasebuffer,  // releasebufferproc
+                                              // bf_releasebuffer;
+};
+
 PyMappingMethods PyShObjMappingMethods = {
     (lenfunc)NULL,                  // PyMappingMethods.mp_length
     (getattrofunc)object_getattro,  // PyMappingMethods.mp_subscript
@@ -845,6 +895,109 @@ PyTypeObject PyShObjIndexedObjectType = {
 #endif
 };
 
+PyTypeObject PyShObjBufferObjectType = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)  // PyObject_VAR_HEAD
+    "shell.Object",  // char *tp_name; /* For printing, in format
+                     // "<module>.<name>" */
+    sizeof(PyShObjObject),
+    0,  // int tp_basicsize, tp_itemsize; /* For allocation */
+
+    /* Methods to implement standard operations */
+
+    (destructor)object_dealloc,  // destructor tp_dealloc;
+    0,                           // printfunc tp_print;
+    0,                           // getattrfunc tp_getattr;
+    0,                           // setattrfunc tp_setattr;
+    0,  //  PyAsyncMethods *tp_as_async; // void *tp_reserved;
+    0,  // (reprfunc)dict_repr, // reprfunc tp_repr;
+
+    /* Method suites for standard classes */
+
+    0,                        // PyNumberMethods *tp_as_number;
+    &PyShObject_as_sequence,  // PySequenceMethods *tp_as_sequence;
+    0,                        //  PyMappingMethods *tp_as_mapping;
+
+    /* More standard operations (here for binary compatibility) */
+
+    0,                              //  hashfunc tp_hash;
+    0,                              // ternaryfunc tp_call;
+    (reprfunc)object_printable,     // reprfunc tp_str;
+    (getattrofunc)object_getattro,  // getattrofunc tp_getattro;
+    (setattrofunc)object_setattro,  //  setattrofunc tp_setattro;
+
+    /* Functions to access object as input/output buffer */
+    &PyShObj_as_buffer,  // PyBufferProcs *tp_as_buffer;
+
+    /* Flags to define presence of optional/expanded features */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,  //  long tp_flags;
+
+    PyShObjDoc,  // char *tp_doc; /* Documentation string */
+
+    /* Assigned meaning in release 2.0 */
+    /* call function for all accessible objects */
+    0,  // traverseproc tp_traverse;
+
+    /* delete references to contained objects */
+    0,  // inquiry tp_clear;
+
+    /* Assigned meaning in release 2.1 */
+    /* rich comparisons */
+    (richcmpfunc)object_rich_compare,  // richcmpfunc tp_richcompare;
+
+    /* weak reference enabler */
+    0,  // long tp_weakdictoffset;
+
+    /* Added in release 2.2 */
+    /* Iterators */
+    0,  // getiterfunc tp_iter;
+    0,  // iternextfunc tp_iternext;
+
+    /* Attribute descriptor and subclassing stuff */
+    PyShObjMethods,             // struct PyMethodDef *tp_methods;
+    0,                          // struct PyMemberDef *tp_members;
+    0,                          //  struct PyGetSetDef *tp_getset;
+    &PyShObjIndexedObjectType,  // struct _typeobject *tp_base;
+    0,                          // PyObject *tp_dict;
+    0,                          // descrgetfunc tp_descr_get;
+    0,                          // descrsetfunc tp_descr_set;
+    0,                          // long tp_dictoffset;
+    (initproc)object_init,      // initproc tp_init;
+    PyType_GenericAlloc,        // allocfunc tp_alloc;
+    PyType_GenericNew,          // newfunc tp_new;
+    0,  // freefunc tp_free; /* Low-level free-memory routine */
+    0,  // inquiry tp_is_gc; /* For PyObject_IS_GC */
+    0,  // PyObject *tp_bases;
+    0,  // PyObject *tp_mro; /* method resolution order */
+    0,  // PyObject *tp_cache;
+    0,  // PyObject *tp_subclasses;
+    0,  // PyObject *tp_weakdict;
+    0   // tp_del
+#if PY_VERSION_HEX >= 0x02060000
+    ,
+    0  // tp_version_tag
+#endif
+#if PY_VERSION_HEX >= 0x03040000
+    ,
+    0  // tp_finalize
+#endif
+#if PY_VERSION_HEX >= 0x03080000
+    ,
+    0  // tp_vectorcall
+#if PY_VERSION_HEX < 0x03090000
+    ,
+    0  // tp_print
+#endif
+#endif
+#if PY_VERSION_HEX >= 0x030C0000
+    ,
+    0  // tp_watched
+#endif
+#if PY_VERSION_HEX >= 0x030D0000
+    ,
+    0  // tp_versions_used
+#endif
+};
+
 #if PY_VERSION_HEX >= 0x03080000 && PY_VERSION_HEX < 0x03090000
 #ifdef __clang__
 #pragma clang diagnostic pop
@@ -855,7 +1008,8 @@ PyObject *object_rich_compare(PyShObjObject *self, PyObject *other, int op) {
   if (Py_EQ == op) {
     const auto type = Py_TYPE(other);
 
-    if (type == &PyShObjObjectType || type == &PyShObjIndexedObjectType) {
+    if (type == &PyShObjObjectType || type == &PyShObjIndexedObjectType ||
+        type == &PyShObjBufferObjectType) {
       if (object_compare(self, (PyShObjObject *)other) == 0) {
         Py_RETURN_TRUE;
       }
@@ -899,12 +1053,25 @@ void Python_context::init_shell_object_type() {
 
   _shell_indexed_object_class = py::Store{
       PyDict_GetItemString(PyModule_GetDict(module.get()), "IndexedObject")};
+
+  // Initializes the buffer object, a subclass of the indexed object
+  if (PyType_Ready(&PyShObjBufferObjectType) < 0) {
+    throw std::runtime_error(
+        "Could not initialize Shcore Buffer Object type in python");
+  }
+
+  Py_INCREF(&PyShObjBufferObjectType);
+
+  PyModule_AddObject(module.get(), "BufferObject",
+                     reinterpret_cast<PyObject *>(&PyShObjBufferObjectType));
 }
 
 py::Release shcore::wrap(const std::shared_ptr<Object_bridge> &object) {
   PyShObjObject *wrapper;
 
-  if (object->is_indexed())
+  if (object->is_buffer())
+    wrapper = PyObject_New(PyShObjObject, &PyShObjBufferObjectType);
+  else if (object->is_indexed())
     wrapper = PyObject_New(PyShObjObject, &PyShObjIndexedObjectType);
   else
     wrapper = PyObject_New(PyShObjObject, &PyShObjObjectType);
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures the overhead of a log call when many threads are logging.
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int k_entries = 200000;
+
+/**
+ * Each thread logs its share of the entries, returns average duration of a
+ * call in nanoseconds.
+ */
+double run(int threads, const std::function<void(int, int)> &log) {
+  std::vector<std::thread> workers;
+  const auto per_thread = k_entries / threads;
+
+  const auto t_start = std::chrono::steady_clock::now();
+
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back(mysqlsh::spawn_scoped_thread([t, per_thread, &log]() {
+      for (int i = 0; i < per_thread; ++i) {
+        log(t, i);
+      }
+    }));
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  // each thread executes its calls one after another
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - t_start)
+             .count() /
+         per_thread;
+}
+
+/**
+ * Reference: entry is formatted in the same way as by the logger, then written
+ * synchronously under a global lock, the way log file was written before.
+ */
+double synchronous(int threads, const std::string &path) {
+  std::mutex mutex;
+  FILE *file = fopen(path.c_str(), "a");
+
+  const auto result = run(threads, [&mutex, file](int t, int i) {
+    const auto now = time(nullptr);
+    struct tm tm;
+#ifdef _WIN32
+    gmtime_s(&tm, &now);
+#else   // !_WIN32
+    gmtime_r(&now, &tm);
+#endif  // !_WIN32
+
+    char timestamp[32];
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &tm);
+
+    char buffer[128];
+    snprintf(buffer, sizeof(buffer), "Dump: thread %d, chunk %d done", t, i);
+
+    std::string entry = timestamp;
+    entry.append(": Debug3: ");
+    entry.append(buffer);
+    entry.append("\n");
+
+    std::lock_guard lock{mutex};
+    fwrite(entry.c_str(), entry.length(), 1, file);
+    fflush(file);
+  });
+
+  fclose(file);
+
+  return result;
+}
+
+double asynchronous(int threads, const std::string &path) {
+  mysqlsh::Scoped_logger logger(
+      shcore::Logger::create_instance(path.c_str(), false,
+                                      shcore::Logger::LOG_DEBUG3));
+
+  const auto result = run(threads, [](int t, int i) {
+    log_debug3("Dump: thread %d, chunk %d done", t, i);
+  });
+
+  // include the time needed to write the remaining entries
+  const auto t_start = std::chrono::steady_clock::now();
+  shcore::current_logger()->flush();
+
+  return result + std::chrono::duration<double, std::nano>(
+                      std::chrono::steady_clock::now() - t_start)
+                          .count() /
+                      (k_entries / threads);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::vector<int> threads;
+
+  for (int i = 1; i < argc; ++i) {
+    threads.emplace_back(std::atoi(argv[i]));
+  }
+
+  if (threads.empty()) {
+    threads = {1, 8, 32, 64};
+  }
+
+  const auto path =
+      shcore::path::join_path(shcore::path::tmpdir(), "bench_logger.log");
+
+  for (const auto t : threads) {
+    const auto before = synchronous(t, path);
+    const auto after = asynchronous(t, path);
+
+    std::cout << t << " threads: synchronous " << before
+              << "ns per call, asynchronous " << after << "ns per call\n";
+  }
+
+  shcore::delete_file(path);
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures how the worker queues behave when many threads are consuming.
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Task = std::function<void()>;
+
+constexpr int k_tasks = 1000000;
+
+// amount of work done by each task, to simulate a short operation
+void work() {
+  static thread_local volatile uint64_t sink = 0;
+
+  for (int i = 0; i < 64; ++i) {
+    sink = sink + i;
+  }
+}
+
+/**
+ * Main thread injects all the tasks, workers just consume them.
+ */
+template <typename Queue>
+double injected(int threads) {
+  Queue queue;
+  std::vector<std::thread> workers;
+
+  const auto t_start = std::chrono::steady_clock::now();
+
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&queue]() {
+      while (auto task = queue.pop()) {
+        task();
+      }
+    });
+  }
+
+  for (int i = 0; i < k_tasks; ++i) {
+    queue.push(work);
+  }
+
+  queue.shutdown(threads);
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - t_start)
+      .count();
+}
+
+/**
+ * Main thread injects a few tasks, each one is split by workers into
+ * subtasks, like in case of dumper chunking the tables.
+ */
+template <typename Queue>
+double spawned(int threads) {
+  constexpr int k_subtasks = 1000;
+  Queue queue;
+  std::vector<std::thread> workers;
+  std::atomic<int> remaining{k_tasks};
+
+  const auto done = [&queue, &remaining, threads]() {
+    if (0 == --remaining) {
+      queue.shutdown(threads);
+    }
+  };
+
+  const auto t_start = std::chrono::steady_clock::now();
+
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&queue]() {
+      while (auto task = queue.pop()) {
+        task();
+      }
+    });
+  }
+
+  for (int i = 0; i < k_tasks / k_subtasks; ++i) {
+    queue.push([&queue, &done]() {
+      for (int j = 1; j < k_subtasks; ++j) {
+        queue.push(
+            [&done]() {
+              work();
+              done();
+            },
+            shcore::Queue_priority::HIGH);
+      }
+
+      work();
+      done();
+    });
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - t_start)
+      .count();
+}
+
+void report(const std::string &scenario, int threads,
+            const std::function<double(int)> &before,
+            const std::function<double(int)> &after) {
+  const auto b = before(threads);
+  const auto a = after(threads);
+
+  std::cout << scenario << ", " << threads << " threads: Synchronized_queue "
+            << b << "ms (" << k_tasks / b << " tasks/ms), Work_stealing_queue "
+            << a << "ms (" << k_tasks / a << " tasks/ms)\n";
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  using Before = shcore::Synchronized_queue<Task>;
+  using After = shcore::Work_stealing_queue<Task>;
+
+  std::vector<int> threads;
+
+  for (int i = 1; i < argc; ++i) {
+    threads.emplace_back(std::atoi(argv[i]));
+  }
+
+  if (threads.empty()) {
+    threads = {1, 8, 32, 64};
+  }
+
+  for (const auto t : threads) {
+    report("injected", t, injected<Before>, injected<After>);
+    report("spawned", t, spawned<Before>, spawned<After>);
+  }
+}
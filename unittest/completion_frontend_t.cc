@@ -973,7 +973,8 @@ TEST_F(Completer_frontend, js_devapi_table) {
   EXPECT_AFTER_TAB(DB_PRODUCTTABLE ".select().execute().fe",
                    DB_PRODUCTTABLE ".select().execute().fetch");
   EXPECT_AFTER_TAB_TAB(DB_PRODUCTTABLE ".select().execute().fetch",
-                       strv({"fetchAll()", "fetchOne()", "fetchOneObject()"}));
+                       strv({"fetchAll()", "fetchBatch()", "fetchColumns()",
+                             "fetchOne()", "fetchOneObject()"}));
 
   EXPECT_TAB_DOES_NOTHING(DB_PRODUCTTABLE ".select().bind().s");
   EXPECT_TAB_DOES_NOTHING(DB_PRODUCTTABLE ".select().bind(.s");
@@ -1506,7 +1507,8 @@ TEST_F(Completer_frontend, py_devapi_table) {
                    DB_PRODUCTTABLE ".select().execute().fetch_");
   EXPECT_AFTER_TAB_TAB(
       DB_PRODUCTTABLE ".select().execute().fetch_",
-      strv({"fetch_all()", "fetch_one()", "fetch_one_object()"}));
+      strv({"fetch_all()", "fetch_batch()", "fetch_columns()", "fetch_one()",
+            "fetch_one_object()"}));
 
   EXPECT_TAB_DOES_NOTHING(DB_PRODUCTTABLE ".select().bind().s");
   EXPECT_TAB_DOES_NOTHING(DB_PRODUCTTABLE ".select().bind(.s");
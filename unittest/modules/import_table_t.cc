@@ -23,9 +23,11 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <algorithm>
 #include <iostream>
 #include <queue>
 #include <random>
+#include <vector>
 
 #include "gtest_clean.h"
 
@@ -1038,5 +1040,97 @@ TEST(import_table, twochar_aa_line_terminator_same_as_row_data) {
   shcore::delete_file(path, true);
 }
 
+TEST(import_table, file_find_same_as_generic_find) {
+  // data spans multiple buffers, terminators and escapes are sparse, so that
+  // large parts of the buffers are skipped
+  std::mt19937 gen(20241017);
+  std::uniform_int_distribution<int> dist(0, 199);
+  std::string test_string;
+  test_string.reserve(kBufferSize * 5);
+
+  for (int i = 0; i < kBufferSize * 5; ++i) {
+    const auto r = dist(gen);
+
+    if (r < 2) {
+      test_string += '\\';
+    } else if (r < 4) {
+      test_string += '\n';
+    } else if (r < 6) {
+      test_string += 'a';
+    } else if (r < 8) {
+      test_string += 'b';
+    } else {
+      test_string += static_cast<char>('c' + r % 20);
+    }
+  }
+
+  const std::string path{"import_table_file_find.dump"};
+  shcore::create_file(path, test_string, true);
+
+  for (const std::string line_terminator : {"\n", "ab", "a\\b", "\n\n"}) {
+    SCOPED_TRACE(line_terminator);
+
+    for (const auto escape : {'\0', '\\'}) {
+      SCOPED_TRACE(escape);
+
+      std::vector<size_t> expected;
+
+      {
+        auto row = test_string.begin();
+        const auto last = test_string.end();
+
+        while (row != last) {
+          row = escape ? skip_rows(row, last, line_terminator, 1, escape)
+                       : skip_rows(row, last, line_terminator, 1);
+          expected.emplace_back(row - test_string.begin());
+        }
+      }
+
+      {
+        auto fh_ptr = mysqlshdk::storage::make_file(path);
+        File_handler fh{fh_ptr.get()};
+        auto [row, last] = fh.iterators(line_terminator.size());
+        std::vector<size_t> actual;
+
+        while (row != last) {
+          row = escape ? skip_rows(row, last, line_terminator, 1, escape)
+                       : skip_rows(row, last, line_terminator, 1);
+          actual.emplace_back(row.offset());
+        }
+
+        EXPECT_EQ(expected, actual);
+      }
+
+      {
+        auto fh_ptr = mysqlshdk::storage::make_file(path);
+        File_handler fh{fh_ptr.get()};
+        std::queue<File_import_info> r;
+        auto [first, last] = fh.iterators(line_terminator.size());
+
+        if (escape) {
+          chunk_by_max_bytes(first, last, line_terminator, escape,
+                             kBufferSize / 3, &r, File_import_info());
+        } else {
+          chunk_by_max_bytes(first, last, line_terminator, kBufferSize / 3,
+                             &r, File_import_info());
+        }
+
+        EXPECT_FALSE(r.empty());
+
+        while (!r.empty()) {
+          const auto end = r.front().range.second;
+          r.pop();
+
+          EXPECT_NE(expected.end(),
+                    std::find(expected.begin(), expected.end(), end))
+              << "chunk does not end at the row boundary: " << end;
+        }
+      }
+    }
+  }
+
+  shcore::delete_file(path, true);
+}
+
 }  // namespace import_table
 }  // namespace mysqlsh
@@ -26,12 +26,16 @@
 #include "modules/util/dump/instance_cache.h"
 
 #include <array>
+#include <atomic>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils.h"
 
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/utils/threads.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "modules/util/dump/indexes.h"
@@ -4464,6 +4468,133 @@ TEST_F(Instance_cache_test, stats) {
   }
 }
 
+TEST_F(Instance_cache_test, parallel_metadata) {
+  {
+    // setup
+    for (const auto schema : {"first", "second", "third"}) {
+      const std::string s = schema;
+
+      m_session->execute("CREATE SCHEMA " + s + ";");
+      m_session->execute("CREATE TABLE " + s +
+                         ".one (id INT PRIMARY KEY, data INT, UNIQUE (data), "
+                         "g INT AS (id + 1));");
+      m_session->execute("CREATE TABLE " + s +
+                         ".two (id INT NOT NULL, UNIQUE INDEX (id)) "
+                         "PARTITION BY HASH(id) PARTITIONS 2;");
+      m_session->execute("CREATE VIEW " + s + ".three AS SELECT * FROM " + s +
+                         ".one;");
+      m_session->execute("CREATE TRIGGER " + s + ".t1 AFTER DELETE ON " + s +
+                         ".one FOR EACH ROW BEGIN END;");
+      m_session->execute("CREATE TRIGGER " + s + ".t2 AFTER DELETE ON " + s +
+                         ".one FOR EACH ROW PRECEDES t1 BEGIN END;");
+    }
+  }
+
+  const auto columns = [](const Instance_cache::Table &table) {
+    std::vector<std::string> names;
+
+    for (const auto column : table.columns) {
+      names.emplace_back(column->name);
+    }
+
+    return names;
+  };
+
+  Filtering_options filters;
+  const auto expected = Instance_cache_builder(m_session, filters)
+                            .metadata({})
+                            .triggers()
+                            .build();
+
+  std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions;
+
+  for (int i = 0; i < 3; ++i) {
+    sessions.emplace_back(connect_session());
+  }
+
+  std::atomic<std::size_t> executed{0};
+  const auto cache =
+      Instance_cache_builder(m_session, filters)
+          .executor(
+              [&sessions,
+               &executed](std::vector<Instance_cache_builder::Task> &&tasks) {
+                std::atomic<std::size_t> next{0};
+
+                mysqlshdk::utils::parallel_for(
+                    sessions.size(), sessions.size(), [&](std::size_t s) {
+                      mysqlsh::Mysql_thread mysql_thread;
+
+                      for (auto i = next++; i < tasks.size(); i = next++) {
+                        tasks[i](sessions[s]);
+                        ++executed;
+                      }
+                    });
+              },
+              sessions.size())
+          .metadata({})
+          .triggers()
+          .build();
+
+  for (const auto &session : sessions) {
+    session->close();
+  }
+
+  // schemas are split into shards, each type of metadata is fetched by a
+  // separate task
+  EXPECT_LT(3u, executed.load());
+
+  EXPECT_EQ(expected.filtered.triggers, cache.filtered.triggers);
+  EXPECT_EQ(expected.total.triggers, cache.total.triggers);
+
+  for (const auto schema : {"first", "second", "third"}) {
+    SCOPED_TRACE(schema);
+
+    const auto &e = expected.schemas.at(schema);
+    const auto &a = cache.schemas.at(schema);
+
+    for (const auto table : {"one", "two"}) {
+      SCOPED_TRACE(table);
+
+      const auto &et = e.tables.at(table);
+      const auto &at = a.tables.at(table);
+
+      EXPECT_EQ(columns(et), columns(at));
+      EXPECT_EQ(et.all_columns.size(), at.all_columns.size());
+      ASSERT_EQ(et.indexes.size(), at.indexes.size());
+
+      for (const auto &index : et.indexes) {
+        EXPECT_EQ(index.second.columns_sql(),
+                  at.indexes.at(index.first).columns_sql());
+      }
+
+      ASSERT_EQ(!!et.primary_key, !!at.primary_key);
+
+      if (et.primary_key) {
+        EXPECT_EQ(et.primary_key->columns_sql(), at.primary_key->columns_sql());
+      }
+
+      EXPECT_EQ(et.primary_key_equivalents.size(),
+                at.primary_key_equivalents.size());
+      EXPECT_EQ(et.triggers, at.triggers);
+      ASSERT_EQ(et.partitions.size(), at.partitions.size());
+
+      for (std::size_t i = 0; i < et.partitions.size(); ++i) {
+        EXPECT_EQ(et.partitions[i].name, at.partitions[i].name);
+      }
+    }
+
+    const auto &ev = e.views.at("three");
+    const auto &av = a.views.at("three");
+
+    EXPECT_EQ(columns(ev), columns(av));
+    EXPECT_EQ(ev.character_set_client, av.character_set_client);
+    EXPECT_EQ(ev.collation_connection, av.collation_connection);
+  }
+
+  EXPECT_EQ((std::vector<std::string>{"t2", "t1"}),
+            cache.schemas.at("first").tables.at("one").triggers);
+}
+
 }  // namespace tests
 }  // namespace dump
 }  // namespace mysqlsh
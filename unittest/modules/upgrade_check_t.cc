@@ -1262,6 +1262,45 @@ TEST_F(MySQL_upgrade_check_test, JSON_output_format) {
   }
 }
 
+TEST_F(MySQL_upgrade_check_test, parallel_execution) {
+  SKIP_IF_NOT_5_7_UP_TO(Version(MYSH_VERSION));
+
+  Util util(_interactive_shell->shell_context().get());
+  const auto connection_options = shcore::get_connection_options(_mysql_uri);
+
+  PrepareTestDatabase("parallel_upgrade_check");
+
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_NO_THROW(session->execute(
+        "create table parallel_upgrade_check.t" + std::to_string(i) +
+        " (a int primary key) engine=InnoDB;"));
+  }
+
+  // clear stdout/stderr garbage
+  reset_shell();
+
+  shcore::Option_pack_ref<Upgrade_check_options> options;
+  options->output_format = "JSON";
+
+  EXPECT_NO_THROW(util.check_for_server_upgrade(connection_options, options));
+  const auto serial = output_handler.std_out;
+
+  wipe_all();
+  options->threads = 4;
+
+  EXPECT_NO_THROW(util.check_for_server_upgrade(connection_options, options));
+
+  // output is the same, regardless of the number of threads
+  EXPECT_EQ(serial, output_handler.std_out);
+
+  Upgrade_check_options invalid;
+  EXPECT_THROW(Upgrade_check_options::options().unpack(
+                   shcore::make_dict("threads", 0), &invalid),
+               std::invalid_argument);
+
+  ASSERT_NO_THROW(session->execute("drop schema parallel_upgrade_check;"));
+}
+
 TEST_F(MySQL_upgrade_check_test, server_version_not_supported) {
   Version shell_version(MYSH_VERSION);
   // session established with 8.0 server
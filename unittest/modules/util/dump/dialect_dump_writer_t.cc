@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/dump/dialect_dump_writer.h"
+#include "mysqlshdk/libs/db/mutable_result.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+using mysqlshdk::db::Type;
+
+// per-character implementation which was used before the kernels were added
+
+template <class T>
+bool needs_escape(char c) {
+  switch (c) {
+    case '\0':
+    case '\b':
+    case '\n':
+    case '\r':
+    case '\t':
+    case 0x1A:
+      return true;
+
+    default:
+      return c == T::fields_escaped_by[0] || c == T::fields_terminated_by[0] ||
+             c == T::lines_terminated_by[0] || c == T::fields_enclosed_by[0];
+  }
+}
+
+template <class T>
+std::string escape(const std::string &s) {
+  std::string result;
+
+  for (const auto c : s) {
+    char to_write = 0;
+
+    switch (c) {
+      case '\0':
+        to_write = '0';
+        break;
+
+      case '\b':
+        to_write = 'b';
+        break;
+
+      case '\n':
+        to_write = 'n';
+        break;
+
+      case '\r':
+        to_write = 'r';
+        break;
+
+      case '\t':
+        to_write = 't';
+        break;
+
+      case 0x1A:
+        to_write = 'Z';
+        break;
+
+      default:
+        if (needs_escape<T>(c)) {
+          to_write = c;
+        }
+        break;
+    }
+
+    if (0 != to_write) {
+      result += T::fields_escaped_by[0];
+      result += to_write;
+    } else {
+      result += c;
+    }
+  }
+
+  return result;
+}
+
+std::string random_string(std::mt19937 *gen) {
+  const auto length = std::uniform_int_distribution<std::size_t>{0, 300}(*gen);
+  std::uniform_int_distribution<int> kind{0, 9};
+  std::uniform_int_distribution<int> printable{0x20, 0x7E};
+  std::uniform_int_distribution<int> any{0, 255};
+  std::string result;
+
+  result.reserve(length);
+
+  for (std::size_t i = 0; i < length; ++i) {
+    // mostly characters which are not escaped, with some control characters
+    // and bytes which are not valid ASCII
+    const auto k = kind(*gen);
+    result += static_cast<char>(k < 8 ? printable(*gen) : any(*gen));
+  }
+
+  return result;
+}
+
+template <class T>
+void test_kernels() {
+  const auto reference =
+      detail::escape_finder<T>(detail::Escape_kernel::SCALAR);
+  // extra space before the data, to check unaligned loads
+  std::string buffer(80, 'a');
+
+  for (const auto kernel : detail::supported_escape_kernels()) {
+    SCOPED_TRACE(static_cast<int>(kernel));
+
+    const auto find = detail::escape_finder<T>(kernel);
+
+    for (std::size_t offset = 0; offset < 3; ++offset) {
+      SCOPED_TRACE("offset: " + std::to_string(offset));
+
+      const auto begin = buffer.data() + offset;
+
+      // all lengths, processed by both the vectorized and the scalar loop
+      for (std::size_t length = 0; length <= 70; ++length) {
+        const auto end = begin + length;
+
+        ASSERT_EQ(end, find(begin, end));
+
+        for (std::size_t pos = 0; pos < length; ++pos) {
+          begin[pos] = T::fields_terminated_by[0];
+          ASSERT_EQ(begin + pos, find(begin, end))
+              << "length: " << length << ", position: " << pos;
+
+          // second character which needs to be escaped is not reported
+          if (pos + 1 < length) {
+            begin[length - 1] = '\n';
+            ASSERT_EQ(begin + pos, find(begin, end))
+                << "length: " << length << ", position: " << pos;
+            begin[length - 1] = 'a';
+          }
+
+          begin[pos] = 'a';
+        }
+      }
+
+      // all characters at each position
+      constexpr std::size_t length = 70;
+      const auto end = begin + length;
+
+      for (std::size_t pos = 0; pos < length; ++pos) {
+        for (int c = 0; c < 256; ++c) {
+          begin[pos] = static_cast<char>(c);
+
+          const auto expected = needs_escape<T>(begin[pos]) ? begin + pos : end;
+
+          ASSERT_EQ(expected, reference(begin, end));
+          ASSERT_EQ(expected, find(begin, end))
+              << "position: " << pos << ", character: " << c;
+        }
+
+        begin[pos] = 'a';
+      }
+    }
+  }
+}
+
+template <class Writer, class T>
+void test_writer() {
+  std::mt19937 gen{2024};
+  mysqlshdk::db::Mutable_result result{{Type::String, Type::String}};
+  std::string expected;
+
+  for (int i = 0; i < 500; ++i) {
+    auto first = random_string(&gen);
+    auto second = random_string(&gen);
+
+    expected += T::fields_enclosed_by;
+    expected += escape<T>(first);
+    expected += T::fields_enclosed_by;
+    expected += T::fields_terminated_by;
+    expected += T::fields_enclosed_by;
+    expected += escape<T>(second);
+    expected += T::fields_enclosed_by;
+    expected += T::lines_terminated_by;
+
+    result.append(std::move(first), std::move(second));
+  }
+
+  mysqlshdk::storage::backend::Memory_file file{"data"};
+  file.open(mysqlshdk::storage::Mode::WRITE);
+
+  Writer writer;
+  writer.set_output_file(&file);
+  writer.open();
+  writer.write_preamble(result.get_metadata());
+
+  while (const auto row = result.fetch_one()) {
+    writer.write_row(row);
+  }
+
+  writer.write_postamble();
+  writer.close();
+  file.close();
+
+  EXPECT_EQ(expected, file.content());
+}
+
+}  // namespace
+
+TEST(Dialect_dump_writer_test, supported_kernels) {
+  const auto &kernels = detail::supported_escape_kernels();
+
+  ASSERT_FALSE(kernels.empty());
+  EXPECT_EQ(detail::Escape_kernel::SCALAR, kernels.front());
+
+  for (const auto kernel :
+       {detail::Escape_kernel::SCALAR, detail::Escape_kernel::SSE2,
+        detail::Escape_kernel::AVX2, detail::Escape_kernel::NEON}) {
+    if (std::find(kernels.begin(), kernels.end(), kernel) == kernels.end()) {
+      EXPECT_THROW(detail::escape_finder<detail::csv_traits>(kernel),
+                   std::invalid_argument);
+    } else {
+      EXPECT_NE(nullptr, detail::escape_finder<detail::csv_traits>(kernel));
+    }
+  }
+}
+
+TEST(Dialect_dump_writer_test, escape_kernels) {
+  test_kernels<detail::default_traits>();
+  test_kernels<detail::csv_traits>();
+  test_kernels<detail::tsv_traits>();
+  test_kernels<detail::csv_unix_traits>();
+}
+
+TEST(Dialect_dump_writer_test, escape_fields) {
+  test_writer<Default_dump_writer, detail::default_traits>();
+  test_writer<Csv_dump_writer, detail::csv_traits>();
+  test_writer<Tsv_dump_writer, detail::tsv_traits>();
+  test_writer<Csv_unix_dump_writer, detail::csv_unix_traits>();
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
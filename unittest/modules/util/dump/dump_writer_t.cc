@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+#include "modules/util/dump/dialect_dump_writer.h"
+#include "modules/util/dump/dump_writer.h"
+#include "mysqlshdk/libs/db/mutable_result.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+using mysqlshdk::db::Type;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+class Counting_file : public Memory_file {
+ public:
+  using Memory_file::Memory_file;
+
+  ssize_t write(const void *buffer, size_t length) override {
+    ++m_writes;
+    return Memory_file::write(buffer, length);
+  }
+
+  std::size_t writes() const { return m_writes; }
+
+ private:
+  std::size_t m_writes = 0;
+};
+
+struct Dump_result {
+  std::string data;
+  std::string index;
+  std::size_t writes = 0;
+  Dump_write_result total;
+  Dump_write_result rows;
+};
+
+}  // namespace
+
+TEST(Dump_writer_test, batched_rows) {
+  std::mt19937 gen{2024};
+  std::uniform_int_distribution<std::size_t> length{0, 300};
+  mysqlshdk::db::Mutable_result result{{Type::Integer, Type::String}};
+
+  // enough data for multiple batches and multiple entries in the index file
+  for (int i = 0; i < 50000; ++i) {
+    result.append(i,
+                  std::string(length(gen), static_cast<char>('a' + i % 26)));
+  }
+
+  const auto dump = [&result](std::size_t write_block_size) {
+    Dump_result r;
+    Counting_file data{"data"};
+    auto index_file = std::make_unique<Memory_file>("data.idx");
+    const auto index = index_file.get();
+
+    data.open(Mode::WRITE);
+
+    {
+      Default_dump_writer writer;
+      writer.m_write_block_size = write_block_size;
+      writer.set_output_file(&data);
+      writer.set_index_file(std::move(index_file));
+      writer.open();
+
+      r.total += writer.write_preamble(result.get_metadata());
+
+      result.reset();
+
+      while (const auto row = result.fetch_one()) {
+        r.rows += writer.write_row(row);
+      }
+
+      r.total += r.rows;
+      r.total += writer.write_postamble();
+      writer.close();
+
+      r.index = index->content();
+    }
+
+    data.close();
+
+    r.data = data.content();
+    r.writes = data.writes();
+
+    return r;
+  };
+
+  // each row is written to the output file
+  const auto unbatched = dump(0);
+  const auto batched = dump(Default_dump_writer().m_write_block_size);
+
+  EXPECT_EQ(unbatched.data, batched.data);
+  EXPECT_EQ(unbatched.index, batched.index);
+  // index holds an offset for every 1MiB of data and the total size
+  EXPECT_EQ(0u, batched.index.size() % sizeof(uint64_t));
+  EXPECT_EQ(batched.data.size() / (1024 * 1024) + 1,
+            batched.index.size() / sizeof(uint64_t));
+
+  EXPECT_EQ(unbatched.rows.rows_written(), batched.rows.rows_written());
+  EXPECT_EQ(unbatched.rows.data_bytes(), batched.rows.data_bytes());
+  EXPECT_EQ(unbatched.total.rows_written(), batched.total.rows_written());
+  EXPECT_EQ(unbatched.total.data_bytes(), batched.total.data_bytes());
+  EXPECT_EQ(unbatched.total.bytes_written(), batched.total.bytes_written());
+  EXPECT_EQ(batched.data.size(), batched.total.bytes_written());
+  EXPECT_EQ(batched.data.size(), batched.total.data_bytes());
+
+  EXPECT_EQ(50000u, batched.rows.rows_written());
+  EXPECT_LT(batched.writes, unbatched.writes / 1000);
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/instance_cache_snapshot.h"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+Instance_cache::Column column(const std::string &name, bool nullable,
+                              bool generated = false) {
+  Instance_cache::Column c;
+  c.name = name;
+  c.quoted_name = "`" + name + "`";
+  c.nullable = nullable;
+  c.generated = generated;
+  c.type = mysqlshdk::db::Type::Integer;
+  return c;
+}
+
+Instance_cache cache() {
+  Instance_cache cache;
+
+  auto &schema = cache.schemas["first"];
+  schema.checksum = "4:1234,3:5678";
+
+  auto &table = schema.tables["one"];
+  table.create_time = "2024-01-01 00:00:00";
+  table.set_columns({column("id", false), column("data", true),
+                     column("hash", false), column("g", true, true)});
+  table.all_columns[1].csv_unsafe = true;
+  table.all_columns[1].type = mysqlshdk::db::Type::Bytes;
+  table.all_columns[2].auto_increment = true;
+  table.add_index("PRIMARY", {&table.all_columns[0]});
+  table.add_index("a", {&table.all_columns[1], &table.all_columns[2]});
+  table.add_index("b", {&table.all_columns[2]});
+
+  auto &view = schema.views["two"];
+  view.set_columns({column("id", false)});
+
+  // no checksum, not stored
+  cache.schemas["second"].tables["three"].set_columns({column("id", true)});
+
+  return cache;
+}
+
+std::vector<std::string> names(
+    const std::vector<const Instance_cache::Column *> &columns) {
+  std::vector<std::string> result;
+
+  for (const auto c : columns) {
+    result.emplace_back(c->name);
+  }
+
+  return result;
+}
+
+}  // namespace
+
+TEST(Instance_cache_snapshot, round_trip) {
+  const auto restored = deserialize_snapshot(serialize_snapshot(cache()));
+
+  ASSERT_EQ(1, restored.schemas.size());
+
+  const auto &schema = restored.schemas.at("first");
+  EXPECT_EQ("4:1234,3:5678", schema.checksum);
+  ASSERT_EQ(1, schema.tables.size());
+  ASSERT_EQ(1, schema.views.size());
+
+  const auto &table = schema.tables.at("one");
+  EXPECT_EQ("2024-01-01 00:00:00", table.create_time);
+  ASSERT_EQ(4, table.all_columns.size());
+  EXPECT_EQ((std::vector<std::string>{"id", "data", "hash"}),
+            names(table.columns));
+
+  EXPECT_EQ("`data`", table.all_columns[1].quoted_name);
+  EXPECT_TRUE(table.all_columns[1].csv_unsafe);
+  EXPECT_TRUE(table.all_columns[1].nullable);
+  EXPECT_EQ(mysqlshdk::db::Type::Bytes, table.all_columns[1].type);
+  EXPECT_TRUE(table.all_columns[2].auto_increment);
+  EXPECT_FALSE(table.all_columns[2].nullable);
+  EXPECT_TRUE(table.all_columns[3].generated);
+
+  ASSERT_EQ(3, table.indexes.size());
+  ASSERT_NE(nullptr, table.primary_key);
+  EXPECT_EQ("`id`", table.primary_key->columns_sql());
+  EXPECT_EQ(&table.all_columns[0], table.primary_key->columns()[0]);
+  ASSERT_EQ(1, table.primary_key_equivalents.size());
+  EXPECT_EQ("`hash`", table.primary_key_equivalents[0]->columns_sql());
+  ASSERT_EQ(1, table.unique_keys.size());
+  EXPECT_EQ("`data`,`hash`", table.unique_keys[0]->columns_sql());
+
+  const auto &view = schema.views.at("two");
+  EXPECT_EQ("", view.create_time);
+  EXPECT_EQ((std::vector<std::string>{"id"}), names(view.columns));
+  EXPECT_TRUE(view.indexes.empty());
+}
+
+TEST(Instance_cache_snapshot, invalid_data) {
+  const auto data = serialize_snapshot(cache());
+
+  EXPECT_THROW(deserialize_snapshot(""), std::runtime_error);
+  EXPECT_THROW(deserialize_snapshot("MSHCACHF" + data.substr(8)),
+               std::runtime_error);
+
+  // version
+  auto modified = data;
+  modified[8] = 2;
+  EXPECT_THROW(deserialize_snapshot(modified), std::runtime_error);
+
+  for (std::size_t size = 0; size < data.size(); ++size) {
+    SCOPED_TRACE(size);
+    EXPECT_THROW(deserialize_snapshot(data.substr(0, size)),
+                 std::runtime_error);
+  }
+
+  EXPECT_THROW(deserialize_snapshot(data + "x"), std::runtime_error);
+
+  // huge number of columns, must not be used to allocate memory
+  const std::string header =
+      "MSHCACHE\x01"
+      // one schema "s" with checksum "c" and one table "t" with no create time
+      "\x01\x01s\x01" "c\x01\x01t\x00";
+  EXPECT_THROW(deserialize_snapshot(header + "\x80\x80\x80\x80\x80\x20"),
+               std::runtime_error);
+  EXPECT_THROW(deserialize_snapshot(header + "\x02\x01x"),
+               std::runtime_error);
+}
+
+TEST(Instance_cache_snapshot, save_and_load) {
+  const auto tmpdir = getenv("TMPDIR");
+  const auto path = shcore::path::join_path(tmpdir ? tmpdir : ".",
+                                            "instance_cache_snapshot_t.bin");
+
+  shcore::delete_file(path);
+
+  Instance_cache restored;
+  EXPECT_FALSE(load_snapshot(path, &restored));
+
+  save_snapshot(cache(), path);
+  EXPECT_FALSE(shcore::is_file(path + ".tmp"));
+
+  ASSERT_TRUE(load_snapshot(path, &restored));
+  EXPECT_EQ(1, restored.schemas.size());
+  EXPECT_EQ(4,
+            restored.schemas.at("first").tables.at("one").all_columns.size());
+
+  shcore::create_file(path, "invalid", true);
+  EXPECT_THROW(load_snapshot(path, &restored), std::runtime_error);
+
+  shcore::delete_file(path);
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
@@ -191,6 +191,9 @@ class Mysqlsh_extension_test : public Command_line_test {
   }
 
   static void wipe_log_file() {
+    // write the buffered entries, so they do not appear after the file is
+    // truncated
+    shcore::current_logger()->flush();
     const auto log = shcore::current_logger()->logfile_name();
 
     {
@@ -209,6 +212,7 @@ class Mysqlsh_extension_test : public Command_line_test {
   }
 
   static std::string read_log_file() {
+    shcore::current_logger()->flush();
     return shcore::get_text_file(shcore::current_logger()->logfile_name(),
                                  false);
   }
@@ -34,6 +34,22 @@ using mysqlshdk::storage::backend::object_storage::Directory;
 namespace mysqlshdk {
 namespace aws {
 
+namespace {
+
+// multipart uploads are tested with parts uploaded synchronously and in the
+// background
+constexpr std::size_t k_parts_in_flight[] = {
+    0, S3_bucket_config::DEFAULT_MAX_PARTS_IN_FLIGHT};
+
+void expect_uploaded_parts(std::size_t expected, std::size_t parts_in_flight,
+                           std::size_t actual) {
+  // parts uploaded in the background may still be in flight
+  EXPECT_GE(expected, actual);
+  EXPECT_LE(expected - std::min(expected, parts_in_flight), actual);
+}
+
+}  // namespace
+
 class Object_storage_test : public Aws_s3_tests {};
 
 TEST_P(Object_storage_test, directory_list_files) {
@@ -189,49 +205,55 @@ TEST_P(Object_storage_test, file_write_simple_upload) {
 TEST_P(Object_storage_test, file_write_multipart_upload) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
-  auto config = get_config();
-  config->set_part_size(k_min_part_size);
-  S3_bucket bucket(config);
-  Directory root(config, "test");
-
-  auto file = root.file("sample\".txt");
-
-  const auto data = multipart_file_data();
-  size_t offset = 0;
-  int writes = 0;
-
-  file->open(Mode::WRITE);
-
-  while (offset < k_multipart_file_size) {
-    ++writes;
-    offset += file->write(
-        data.data() + offset,
-        std::min(k_min_part_size + 1, k_multipart_file_size - offset));
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
+
+    auto config = get_config();
+    config->set_part_size(k_min_part_size);
+    config->set_max_parts_in_flight(parts_in_flight);
+    S3_bucket bucket(config);
+    Directory root(config, "test");
+
+    auto file = root.file("sample\".txt");
+
+    const auto data = multipart_file_data();
+    size_t offset = 0;
+    int writes = 0;
+
+    file->open(Mode::WRITE);
+
+    while (offset < k_multipart_file_size) {
+      ++writes;
+      offset += file->write(
+          data.data() + offset,
+          std::min(k_min_part_size + 1, k_multipart_file_size - offset));
+    }
+
+    auto uploads = bucket.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
+    auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
+    // Last part is still on the buffer
+    expect_uploaded_parts(writes - 1, parts_in_flight, parts.size());
+
+    file->close();
+    EXPECT_THROW_LIKE(
+        bucket.list_multipart_uploaded_parts(uploads[0]), Response_error,
+        "Failed to list uploaded parts for object 'test/sample\".txt': ");
+    uploads = bucket.list_multipart_uploads();
+    EXPECT_TRUE(uploads.empty());
+
+    file->open(Mode::READ);
+    std::string buffer;
+    buffer.resize(k_multipart_file_size + 5);
+    size_t read = file->read(buffer.data(), buffer.size());
+    EXPECT_EQ(k_multipart_file_size, read);
+    buffer.resize(read);
+    EXPECT_EQ(data, buffer);
+    file->close();
+
+    bucket.delete_object("test/sample\".txt");
   }
-
-  auto uploads = bucket.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
-  auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(writes - 1, parts.size());  // Last part is still on the buffer
-
-  file->close();
-  EXPECT_THROW_LIKE(
-      bucket.list_multipart_uploaded_parts(uploads[0]), Response_error,
-      "Failed to list uploaded parts for object 'test/sample\".txt': ");
-  uploads = bucket.list_multipart_uploads();
-  EXPECT_TRUE(uploads.empty());
-
-  file->open(Mode::READ);
-  std::string buffer;
-  buffer.resize(k_multipart_file_size + 5);
-  size_t read = file->read(buffer.data(), buffer.size());
-  EXPECT_EQ(k_multipart_file_size, read);
-  buffer.resize(read);
-  EXPECT_EQ(data, buffer);
-  file->close();
-
-  bucket.delete_object("test/sample\".txt");
 }
 
 TEST_P(Object_storage_test, file_append_new_file) {
@@ -265,71 +287,82 @@ TEST_P(Object_storage_test, file_append_new_file) {
 TEST_P(Object_storage_test, file_append_resume_interrupted_upload) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
-  auto config = get_config();
-  config->set_part_size(k_min_part_size);
-  S3_bucket bucket(config);
-  Directory root(config);
-
-  auto initial_file = root.file("sample.txt");
-
-  const auto data = multipart_file_data();
-  size_t offset = 0;
-  int writes = 0;
-
-  initial_file->open(Mode::WRITE);
-
-  while (offset + k_min_part_size + 1 < k_multipart_file_size) {
-    ++writes;
-    offset += initial_file->write(data.data() + offset, k_min_part_size + 1);
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
+
+    // initial upload is synchronous, so that it's interrupted at a known point
+    auto initial_config = get_config();
+    initial_config->set_part_size(k_min_part_size);
+    initial_config->set_max_parts_in_flight(0);
+
+    auto config = get_config();
+    config->set_part_size(k_min_part_size);
+    config->set_max_parts_in_flight(parts_in_flight);
+    S3_bucket bucket(config);
+    Directory root(config);
+
+    auto initial_file = Directory(initial_config).file("sample.txt");
+
+    const auto data = multipart_file_data();
+    size_t offset = 0;
+    int writes = 0;
+
+    initial_file->open(Mode::WRITE);
+
+    while (offset + k_min_part_size + 1 < k_multipart_file_size) {
+      ++writes;
+      offset += initial_file->write(data.data() + offset, k_min_part_size + 1);
+    }
+
+    auto uploads = bucket.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("sample.txt", uploads[0].name.c_str());
+    auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
+    EXPECT_EQ(writes, parts.size());
+
+    // INTERRUPTION: We stop writing to initial_file as it got interrupted
+    // At this point the file is an active multipart upload:
+    // Sent Parts: part1, ..., partN
+    // Buffered (lost): data which did not fit into a part
+
+    // RESUME THE UPLOAD
+    auto final_file = root.file("sample.txt");
+
+    final_file->open(Mode::APPEND);
+    offset = final_file->file_size();
+
+    while (offset < k_multipart_file_size) {
+      ++writes;
+      offset += final_file->write(
+          data.data() + offset,
+          std::min(k_min_part_size + 1, k_multipart_file_size - offset));
+    }
+
+    uploads = bucket.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("sample.txt", uploads[0].name.c_str());
+    parts = bucket.list_multipart_uploaded_parts(uploads[0]);
+    // Last part is still on the buffer
+    expect_uploaded_parts(writes - 1, parts_in_flight, parts.size());
+
+    final_file->close();
+    EXPECT_THROW_LIKE(
+        bucket.list_multipart_uploaded_parts(uploads[0]), Response_error,
+        "Failed to list uploaded parts for object 'sample.txt': ");
+    uploads = bucket.list_multipart_uploads();
+    EXPECT_TRUE(uploads.empty());
+
+    final_file->open(Mode::READ);
+    std::string buffer;
+    buffer.resize(k_multipart_file_size + 5);
+    size_t read = final_file->read(buffer.data(), buffer.size());
+    EXPECT_EQ(k_multipart_file_size, read);
+    buffer.resize(read);
+    EXPECT_EQ(data, buffer);
+    final_file->close();
+
+    bucket.delete_object("sample.txt");
   }
-
-  auto uploads = bucket.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("sample.txt", uploads[0].name.c_str());
-  auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(writes, parts.size());
-
-  // INTERRUPTION: We stop writing to initial_file as it got interrupted
-  // At this point the file is an active multipart upload:
-  // Sent Parts: part1, ..., partN
-  // Buffered (lost): data which did not fit into a part
-
-  // RESUME THE UPLOAD
-  auto final_file = root.file("sample.txt");
-
-  final_file->open(Mode::APPEND);
-  offset = final_file->file_size();
-
-  while (offset < k_multipart_file_size) {
-    ++writes;
-    offset += final_file->write(
-        data.data() + offset,
-        std::min(k_min_part_size + 1, k_multipart_file_size - offset));
-  }
-
-  uploads = bucket.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("sample.txt", uploads[0].name.c_str());
-  parts = bucket.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(writes - 1, parts.size());  // Last part is still on the buffer
-
-  final_file->close();
-  EXPECT_THROW_LIKE(bucket.list_multipart_uploaded_parts(uploads[0]),
-                    Response_error,
-                    "Failed to list uploaded parts for object 'sample.txt': ");
-  uploads = bucket.list_multipart_uploads();
-  EXPECT_TRUE(uploads.empty());
-
-  final_file->open(Mode::READ);
-  std::string buffer;
-  buffer.resize(k_multipart_file_size + 5);
-  size_t read = final_file->read(buffer.data(), buffer.size());
-  EXPECT_EQ(k_multipart_file_size, read);
-  buffer.resize(read);
-  EXPECT_EQ(data, buffer);
-  final_file->close();
-
-  bucket.delete_object("sample.txt");
 }
 
 TEST_P(Object_storage_test, file_append_existing_file) {
@@ -370,24 +403,34 @@ TEST_P(Object_storage_test, file_append_existing_file) {
 TEST_P(Object_storage_test, file_write_multipart_errors) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
-  auto config = get_config();
-  config->set_part_size(3);
-  S3_bucket bucket(config);
-  Directory root(config);
-  // Now APPEND should be allowed
-  auto mpo1 = bucket.create_multipart_upload("sample.txt");
-  auto file = root.file("sample.txt");
-
-  file->open(Mode::APPEND);
-
-  bucket.abort_multipart_upload(mpo1);
-
-  EXPECT_THROW_LIKE(file->write("67890", 5), shcore::Exception,
-                    "Failed to upload part 1 for object 'sample.txt': ");
-
-  // write has failed and file state has been reset, there's not going to be any
-  // more communication with the server
-  EXPECT_NO_THROW(file->close());
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
+
+    auto config = get_config();
+    config->set_part_size(3);
+    config->set_max_parts_in_flight(parts_in_flight);
+    S3_bucket bucket(config);
+    Directory root(config);
+    // Now APPEND should be allowed
+    auto mpo1 = bucket.create_multipart_upload("sample.txt");
+    auto file = root.file("sample.txt");
+
+    file->open(Mode::APPEND);
+
+    bucket.abort_multipart_upload(mpo1);
+
+    // parts uploaded in the background report errors with a delay
+    EXPECT_THROW_LIKE(
+        {
+          file->write("67890", 5);
+          file->close();
+        },
+        shcore::Exception, "Failed to upload part 1 for object 'sample.txt': ");
+
+    // upload has failed and file state has been reset, there's not going to be
+    // any more communication with the server
+    EXPECT_NO_THROW(file->close());
+  }
 }
 
 TEST_P(Object_storage_test, file_writing) {
@@ -508,43 +551,49 @@ TEST_P(Object_storage_test, file_rename) {
 TEST_P(Object_storage_test, file_auto_cancel_multipart_upload) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
-  auto config = get_config();
-  config->set_part_size(k_min_part_size);
-  S3_bucket bucket(config);
-  Directory root(config, "test");
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
 
-  auto file = root.file("sample\".txt");
+    auto config = get_config();
+    config->set_part_size(k_min_part_size);
+    config->set_max_parts_in_flight(parts_in_flight);
+    S3_bucket bucket(config);
+    Directory root(config, "test");
 
-  const auto data = multipart_file_data();
-  size_t offset = 0;
-  int writes = 0;
+    auto file = root.file("sample\".txt");
 
-  file->open(Mode::WRITE);
+    const auto data = multipart_file_data();
+    size_t offset = 0;
+    int writes = 0;
 
-  while (offset < k_multipart_file_size) {
-    ++writes;
-    offset += file->write(
-        data.data() + offset,
-        std::min(k_min_part_size + 1, k_multipart_file_size - offset));
-  }
+    file->open(Mode::WRITE);
 
-  const auto uploads = bucket.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
+    while (offset < k_multipart_file_size) {
+      ++writes;
+      offset += file->write(
+          data.data() + offset,
+          std::min(k_min_part_size + 1, k_multipart_file_size - offset));
+    }
 
-  const auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(writes - 1, parts.size());  // Last part is still on the buffer
+    const auto uploads = bucket.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
 
-  // release the file, simulating abnormal situation (close() was not called,
-  // destructor should clean up the upload)
-  file.reset();
+    const auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
+    // Last part is still on the buffer
+    expect_uploaded_parts(writes - 1, parts_in_flight, parts.size());
 
-  EXPECT_THROW_LIKE(bucket.list_multipart_uploaded_parts(uploads[0]),
-                    Response_error,
-                    "Failed to list uploaded parts for object "
-                    "'test/sample\".txt': ");
+    // release the file, simulating abnormal situation (close() was not called,
+    // destructor should clean up the upload)
+    file.reset();
 
-  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+    EXPECT_THROW_LIKE(bucket.list_multipart_uploaded_parts(uploads[0]),
+                      Response_error,
+                      "Failed to list uploaded parts for object "
+                      "'test/sample\".txt': ");
+
+    EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+  }
 }
 
 INSTANTIATE_TEST_SUITE_P(Aws_s3, Object_storage_test, suffixes(),
@@ -35,6 +35,22 @@ using mysqlshdk::storage::backend::object_storage::Directory;
 namespace mysqlshdk {
 namespace azure {
 
+namespace {
+
+// multipart uploads are tested with parts uploaded synchronously and in the
+// background
+constexpr std::size_t k_parts_in_flight[] = {
+    0, Blob_storage_config::DEFAULT_MAX_PARTS_IN_FLIGHT};
+
+void expect_uploaded_parts(std::size_t expected, std::size_t parts_in_flight,
+                           std::size_t actual) {
+  // parts uploaded in the background may still be in flight
+  EXPECT_GE(expected, actual);
+  EXPECT_LE(expected - std::min(expected, parts_in_flight), actual);
+}
+
+}  // namespace
+
 class Azure_blob_storage_tests : public Azure_tests {
  public:
   static std::string s_container_name;
@@ -196,50 +212,56 @@ TEST_F(Azure_blob_storage_tests, file_write_simple_upload) {
 TEST_F(Azure_blob_storage_tests, file_write_multipart_upload) {
   SKIP_IF_NO_AZURE_CONFIGURATION;
 
-  auto config = get_config();
-  config->set_part_size(k_min_part_size);
-  Blob_container container(config);
-  Directory root(config, "test");
-
-  auto file = root.file("sample\".txt");
-
-  const auto data = multipart_file_data();
-  size_t offset = 0;
-  int writes = 0;
-
-  file->open(Mode::WRITE);
-
-  while (offset < k_multipart_file_size) {
-    ++writes;
-    offset += file->write(
-        data.data() + offset,
-        std::min(k_min_part_size + 1, k_multipart_file_size - offset));
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
+
+    auto config = get_config();
+    config->set_part_size(k_min_part_size);
+    config->set_max_parts_in_flight(parts_in_flight);
+    Blob_container container(config);
+    Directory root(config, "test");
+
+    auto file = root.file("sample\".txt");
+
+    const auto data = multipart_file_data();
+    size_t offset = 0;
+    int writes = 0;
+
+    file->open(Mode::WRITE);
+
+    while (offset < k_multipart_file_size) {
+      ++writes;
+      offset += file->write(
+          data.data() + offset,
+          std::min(k_min_part_size + 1, k_multipart_file_size - offset));
+    }
+
+    auto uploads = container.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
+    auto parts = container.list_multipart_uploaded_parts(uploads[0]);
+    // Last part is still on the buffer
+    expect_uploaded_parts(writes - 1, parts_in_flight, parts.size());
+
+    file->close();
+
+    // NOTE: In Asure this will not fail, will just give an empty list
+    parts = container.list_multipart_uploaded_parts(uploads[0]);
+    EXPECT_TRUE(parts.empty());
+    uploads = container.list_multipart_uploads();
+    EXPECT_TRUE(uploads.empty());
+
+    file->open(Mode::READ);
+    std::string buffer;
+    buffer.resize(k_multipart_file_size + 5);
+    size_t read = file->read(buffer.data(), buffer.size());
+    EXPECT_EQ(k_multipart_file_size, read);
+    buffer.resize(read);
+    EXPECT_EQ(data, buffer);
+    file->close();
+
+    container.delete_object("test/sample\".txt");
   }
-
-  auto uploads = container.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
-  auto parts = container.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(writes - 1, parts.size());  // Last part is still on the buffer
-
-  file->close();
-
-  // NOTE: In Asure this will not fail, will just give an empty list
-  parts = container.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_TRUE(parts.empty());
-  uploads = container.list_multipart_uploads();
-  EXPECT_TRUE(uploads.empty());
-
-  file->open(Mode::READ);
-  std::string buffer;
-  buffer.resize(k_multipart_file_size + 5);
-  size_t read = file->read(buffer.data(), buffer.size());
-  EXPECT_EQ(k_multipart_file_size, read);
-  buffer.resize(read);
-  EXPECT_EQ(data, buffer);
-  file->close();
-
-  container.delete_object("test/sample\".txt");
 }
 
 TEST_F(Azure_blob_storage_tests, file_append_new_file) {
@@ -273,71 +295,82 @@ TEST_F(Azure_blob_storage_tests, file_append_new_file) {
 TEST_F(Azure_blob_storage_tests, file_append_resume_interrupted_upload) {
   SKIP_IF_NO_AZURE_CONFIGURATION;
 
-  auto config = get_config();
-  config->set_part_size(k_min_part_size);
-  Blob_container container(config);
-  Directory root(config);
-
-  auto initial_file = root.file("sample.txt");
-
-  const auto data = multipart_file_data();
-  size_t offset = 0;
-  int writes = 0;
-
-  initial_file->open(Mode::WRITE);
-
-  while (offset + k_min_part_size + 1 < k_multipart_file_size) {
-    ++writes;
-    offset += initial_file->write(data.data() + offset, k_min_part_size + 1);
-  }
-
-  auto uploads = container.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("sample.txt", uploads[0].name.c_str());
-  auto parts = container.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(writes, parts.size());
-
-  // INTERRUPTION: We stop writing to initial_file as it got interrupted
-  // At this point the file is an active multipart upload:
-  // Sent Parts: part1, ..., partN
-  // Buffered (lost): data which did not fit into a part
-
-  // RESUME THE UPLOAD
-  auto final_file = root.file("sample.txt");
-
-  final_file->open(Mode::APPEND);
-  offset = final_file->file_size();
-
-  while (offset < k_multipart_file_size) {
-    ++writes;
-    offset += final_file->write(
-        data.data() + offset,
-        std::min(k_min_part_size + 1, k_multipart_file_size - offset));
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
+
+    // initial upload is synchronous, so that it's interrupted at a known point
+    auto initial_config = get_config();
+    initial_config->set_part_size(k_min_part_size);
+    initial_config->set_max_parts_in_flight(0);
+
+    auto config = get_config();
+    config->set_part_size(k_min_part_size);
+    config->set_max_parts_in_flight(parts_in_flight);
+    Blob_container container(config);
+    Directory root(config);
+
+    auto initial_file = Directory(initial_config).file("sample.txt");
+
+    const auto data = multipart_file_data();
+    size_t offset = 0;
+    int writes = 0;
+
+    initial_file->open(Mode::WRITE);
+
+    while (offset + k_min_part_size + 1 < k_multipart_file_size) {
+      ++writes;
+      offset += initial_file->write(data.data() + offset, k_min_part_size + 1);
+    }
+
+    auto uploads = container.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("sample.txt", uploads[0].name.c_str());
+    auto parts = container.list_multipart_uploaded_parts(uploads[0]);
+    EXPECT_EQ(writes, parts.size());
+
+    // INTERRUPTION: We stop writing to initial_file as it got interrupted
+    // At this point the file is an active multipart upload:
+    // Sent Parts: part1, ..., partN
+    // Buffered (lost): data which did not fit into a part
+
+    // RESUME THE UPLOAD
+    auto final_file = root.file("sample.txt");
+
+    final_file->open(Mode::APPEND);
+    offset = final_file->file_size();
+
+    while (offset < k_multipart_file_size) {
+      ++writes;
+      offset += final_file->write(
+          data.data() + offset,
+          std::min(k_min_part_size + 1, k_multipart_file_size - offset));
+    }
+
+    uploads = container.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("sample.txt", uploads[0].name.c_str());
+    parts = container.list_multipart_uploaded_parts(uploads[0]);
+    // Last part is still on the buffer
+    expect_uploaded_parts(writes - 1, parts_in_flight, parts.size());
+
+    final_file->close();
+    // NOTE: In Asure this will not fail, will just give an empty list
+    parts = container.list_multipart_uploaded_parts(uploads[0]);
+    EXPECT_TRUE(parts.empty());
+    uploads = container.list_multipart_uploads();
+    EXPECT_TRUE(uploads.empty());
+
+    final_file->open(Mode::READ);
+    std::string buffer;
+    buffer.resize(k_multipart_file_size + 5);
+    size_t read = final_file->read(buffer.data(), buffer.size());
+    EXPECT_EQ(k_multipart_file_size, read);
+    buffer.resize(read);
+    EXPECT_EQ(data, buffer);
+    final_file->close();
+
+    container.delete_object("sample.txt");
   }
-
-  uploads = container.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("sample.txt", uploads[0].name.c_str());
-  parts = container.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(writes - 1, parts.size());  // Last part is still on the buffer
-
-  final_file->close();
-  // NOTE: In Asure this will not fail, will just give an empty list
-  parts = container.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_TRUE(parts.empty());
-  uploads = container.list_multipart_uploads();
-  EXPECT_TRUE(uploads.empty());
-
-  final_file->open(Mode::READ);
-  std::string buffer;
-  buffer.resize(k_multipart_file_size + 5);
-  size_t read = final_file->read(buffer.data(), buffer.size());
-  EXPECT_EQ(k_multipart_file_size, read);
-  buffer.resize(read);
-  EXPECT_EQ(data, buffer);
-  final_file->close();
-
-  container.delete_object("sample.txt");
 }
 
 TEST_F(Azure_blob_storage_tests, file_append_existing_file) {
@@ -378,48 +411,53 @@ TEST_F(Azure_blob_storage_tests, file_append_existing_file) {
 TEST_F(Azure_blob_storage_tests, file_write_multipart_errors) {
   SKIP_IF_NO_AZURE_CONFIGURATION;
 
-  output_handler.set_log_level(shcore::Logger::LOG_LEVEL::LOG_DEBUG2);
-
-  auto config = get_config();
-  config->set_part_size(3);
-  Blob_container container(config);
-  Directory root(config);
-  auto mpo1 = container.create_multipart_upload("sample.txt");
-  auto mpop1 = container.upload_part(mpo1, 1, "123", 3);
-
-  // Now APPEND should be allowed
-  auto file = root.file("sample.txt");
-
-  file->open(Mode::APPEND);
-
-  container.abort_multipart_upload(mpo1);
-
-  // In azure additional chunks continue writing OK, but the internal chunk list
-  // on the file is invalid because the abort operation wiped them out, the
-  // failure will arise when a commit (file close) is attempted
-  file->write("456", 3);
-
-  EXPECT_THROW_MSG_CONTAINS(
-      file->close(), shcore::Error,
-      "Failed to commit multipart upload for object 'sample.txt': The "
-      "specified block list is invalid.");
-
-  // CORNER CASE: The abort was done only after multipart object was started,
-  // even that puts a first blok, it is ignored as it is just a placeholder to
-  // get the object listed as a multipart upload.
-  mpo1 = container.create_multipart_upload("sample.txt");
-  file = root.file("sample.txt");
-  file->open(Mode::APPEND);
-  file->write("123", 3);
-  file->close();
-
-  file->open(Mode::READ);
-  char buffer[10];
-  size_t read = file->read(buffer, 10);
-  EXPECT_EQ(3, read);
-  std::string final_data(buffer, read);
-  EXPECT_STREQ("123", final_data.c_str());
-  file->close();
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
+
+    output_handler.set_log_level(shcore::Logger::LOG_LEVEL::LOG_DEBUG2);
+
+    auto config = get_config();
+    config->set_part_size(3);
+    config->set_max_parts_in_flight(parts_in_flight);
+    Blob_container container(config);
+    Directory root(config);
+    auto mpo1 = container.create_multipart_upload("sample.txt");
+    auto mpop1 = container.upload_part(mpo1, 1, "123", 3);
+
+    // Now APPEND should be allowed
+    auto file = root.file("sample.txt");
+
+    file->open(Mode::APPEND);
+
+    container.abort_multipart_upload(mpo1);
+
+    // In azure additional chunks continue writing OK, but the internal chunk
+    // list on the file is invalid because the abort operation wiped them out,
+    // the failure will arise when a commit (file close) is attempted
+    file->write("456", 3);
+
+    EXPECT_THROW_MSG_CONTAINS(
+        file->close(), shcore::Error,
+        "Failed to commit multipart upload for object 'sample.txt': The "
+        "specified block list is invalid.");
+
+    // CORNER CASE: The abort was done only after multipart object was started,
+    // even that puts a first blok, it is ignored as it is just a placeholder to
+    // get the object listed as a multipart upload.
+    mpo1 = container.create_multipart_upload("sample.txt");
+    file = root.file("sample.txt");
+    file->open(Mode::APPEND);
+    file->write("123", 3);
+    file->close();
+
+    file->open(Mode::READ);
+    char buffer[10];
+    size_t read = file->read(buffer, 10);
+    EXPECT_EQ(3, read);
+    std::string final_data(buffer, read);
+    EXPECT_STREQ("123", final_data.c_str());
+    file->close();
+  }
 }
 
 TEST_F(Azure_blob_storage_tests, file_writing) {
@@ -514,43 +552,49 @@ TEST_F(Azure_blob_storage_tests, file_rename) {
 TEST_F(Azure_blob_storage_tests, file_auto_cancel_multipart_upload) {
   SKIP_IF_NO_AZURE_CONFIGURATION;
 
-  auto config = get_config();
-  config->set_part_size(k_min_part_size);
-  Blob_container container(config);
-  Directory root(config, "test");
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
 
-  auto file = root.file("sample\".txt");
+    auto config = get_config();
+    config->set_part_size(k_min_part_size);
+    config->set_max_parts_in_flight(parts_in_flight);
+    Blob_container container(config);
+    Directory root(config, "test");
 
-  const auto data = multipart_file_data();
-  size_t offset = 0;
-  int writes = 0;
+    auto file = root.file("sample\".txt");
 
-  file->open(Mode::WRITE);
+    const auto data = multipart_file_data();
+    size_t offset = 0;
+    int writes = 0;
 
-  while (offset < k_multipart_file_size) {
-    ++writes;
-    offset += file->write(
-        data.data() + offset,
-        std::min(k_min_part_size + 1, k_multipart_file_size - offset));
-  }
+    file->open(Mode::WRITE);
 
-  const auto uploads = container.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
+    while (offset < k_multipart_file_size) {
+      ++writes;
+      offset += file->write(
+          data.data() + offset,
+          std::min(k_min_part_size + 1, k_multipart_file_size - offset));
+    }
 
-  const auto parts = container.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(writes - 1, parts.size());  // Last part is still on the buffer
+    const auto uploads = container.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
 
-  // release the file, simulating abnormal situation (close() was not called,
-  // destructor should clean up the upload)
-  file.reset();
+    const auto parts = container.list_multipart_uploaded_parts(uploads[0]);
+    // Last part is still on the buffer
+    expect_uploaded_parts(writes - 1, parts_in_flight, parts.size());
 
-  EXPECT_THROW_MSG_CONTAINS(
-      container.list_multipart_uploaded_parts(uploads[0]), Response_error,
-      "Failed to list uploaded parts for object 'test/sample\".txt': The "
-      "specified blob does not exist.");
+    // release the file, simulating abnormal situation (close() was not called,
+    // destructor should clean up the upload)
+    file.reset();
 
-  EXPECT_TRUE(container.list_multipart_uploads().empty());
+    EXPECT_THROW_MSG_CONTAINS(
+        container.list_multipart_uploaded_parts(uploads[0]), Response_error,
+        "Failed to list uploaded parts for object 'test/sample\".txt': The "
+        "specified blob does not exist.");
+
+    EXPECT_TRUE(container.list_multipart_uploads().empty());
+  }
 }
 }  // namespace azure
 }  // namespace mysqlshdk
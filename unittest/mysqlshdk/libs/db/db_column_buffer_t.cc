@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/db/column_buffer.h"
+#include "mysqlshdk/libs/db/mutable_result.h"
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+const std::vector<Type> k_types = {
+    Type::Integer, Type::UInteger, Type::Float, Type::Double, Type::String,
+    Type::Bytes,   Type::Decimal,  Type::Json,  Type::Date,   Type::Null,
+};
+
+void add_rows(Mutable_result *result, int64_t rows) {
+  for (int64_t i = 0; i < rows; ++i) {
+    if (i % 3) {
+      result->append(-i, static_cast<uint64_t>(i), static_cast<float>(i) / 4,
+                     static_cast<double>(i) / 8, std::string(i % 10, 'x'),
+                     std::string("\0\1", 2), std::to_string(i) + ".5",
+                     "{\"a\": " + std::to_string(i) + "}", "2024-01-01",
+                     nullptr);
+    } else {
+      result->append(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+                     nullptr, nullptr, nullptr, nullptr);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(Column_buffer, layout) {
+  EXPECT_EQ(Column_buffer::Layout::Int64, Column_buffer::layout(Type::Integer));
+  EXPECT_EQ(Column_buffer::Layout::UInt64,
+            Column_buffer::layout(Type::UInteger));
+  EXPECT_EQ(Column_buffer::Layout::UInt64, Column_buffer::layout(Type::Bit));
+  EXPECT_EQ(Column_buffer::Layout::Double, Column_buffer::layout(Type::Float));
+  EXPECT_EQ(Column_buffer::Layout::Double, Column_buffer::layout(Type::Double));
+  EXPECT_EQ(Column_buffer::Layout::Binary,
+            Column_buffer::layout(Type::Decimal));
+  EXPECT_EQ(Column_buffer::Layout::Binary, Column_buffer::layout(Type::String));
+  EXPECT_EQ(Column_buffer::Layout::Binary, Column_buffer::layout(Type::Null));
+}
+
+TEST(Column_buffer, fetch_columns) {
+  constexpr int64_t k_rows = 1000;
+  Mutable_result result{k_types};
+  add_rows(&result, k_rows);
+
+  const auto columns = fetch_columns(&result);
+
+  ASSERT_EQ(k_types.size(), columns.size());
+
+  for (size_t c = 0; c < columns.size(); ++c) {
+    SCOPED_TRACE(c);
+
+    const auto &column = columns[c];
+
+    EXPECT_EQ(k_types[c], column.type());
+    EXPECT_EQ(k_rows, column.size());
+    EXPECT_EQ((k_rows + 7) / 8, column.validity().size());
+    EXPECT_EQ(Type::Null == k_types[c] ? k_rows : (k_rows + 2) / 3,
+              column.null_count());
+
+    if (Column_buffer::Layout::Binary == column.layout()) {
+      EXPECT_EQ(k_rows + 1, column.offsets().size());
+      EXPECT_EQ(column.data_size(),
+                static_cast<size_t>(column.offsets().back()));
+    } else {
+      EXPECT_TRUE(column.offsets().empty());
+      EXPECT_EQ(k_rows * sizeof(uint64_t), column.data_size());
+    }
+  }
+
+  for (int64_t i = 0; i < k_rows; ++i) {
+    SCOPED_TRACE(i);
+
+    for (const auto &column : columns) {
+      EXPECT_EQ(0 == i % 3 || Type::Null == column.type(), column.is_null(i));
+    }
+
+    if (0 == i % 3) {
+      EXPECT_EQ(0, columns[0].get_int(i));
+      EXPECT_EQ(0, columns[3].get_double(i));
+      EXPECT_EQ("", columns[4].get_string(i));
+      continue;
+    }
+
+    EXPECT_EQ(-i, columns[0].get_int(i));
+    EXPECT_EQ(static_cast<uint64_t>(i), columns[1].get_uint(i));
+    EXPECT_EQ(static_cast<double>(static_cast<float>(i) / 4),
+              columns[2].get_double(i));
+    EXPECT_EQ(static_cast<double>(i) / 8, columns[3].get_double(i));
+    EXPECT_EQ(std::string(i % 10, 'x'), columns[4].get_string(i));
+    EXPECT_EQ(std::string("\0\1", 2), columns[5].get_string(i));
+    EXPECT_EQ(std::to_string(i) + ".5", columns[6].get_string(i));
+    EXPECT_EQ("{\"a\": " + std::to_string(i) + "}", columns[7].get_string(i));
+    EXPECT_EQ("2024-01-01", columns[8].get_string(i));
+    EXPECT_EQ("", columns[9].get_string(i));
+  }
+
+  // fixed size values are stored contiguously
+  std::vector<int64_t> values(k_rows);
+  memcpy(values.data(), columns[0].data(), columns[0].data_size());
+
+  for (int64_t i = 0; i < k_rows; ++i) {
+    EXPECT_EQ(i % 3 ? -i : 0, values[i]);
+  }
+}
+
+TEST(Column_buffer, fetch_batches) {
+  constexpr int64_t k_rows = 25;
+  Mutable_result result{k_types};
+  add_rows(&result, k_rows);
+
+  for (int64_t batch = 0; batch < 3; ++batch) {
+    SCOPED_TRACE(batch);
+
+    const auto columns = fetch_columns(&result, 10);
+
+    ASSERT_EQ(k_types.size(), columns.size());
+    EXPECT_EQ(batch < 2 ? 10 : 5, columns[0].size());
+
+    for (size_t i = 0; i < columns[0].size(); ++i) {
+      const int64_t row = batch * 10 + static_cast<int64_t>(i);
+      EXPECT_EQ(row % 3 ? -row : 0, columns[0].get_int(i));
+    }
+  }
+
+  // result is exhausted, buffers are still created for all the columns
+  const auto columns = fetch_columns(&result, 10);
+
+  ASSERT_EQ(k_types.size(), columns.size());
+
+  for (const auto &column : columns) {
+    EXPECT_TRUE(column.empty());
+    EXPECT_TRUE(column.validity().empty());
+  }
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
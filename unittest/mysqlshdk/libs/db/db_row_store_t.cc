@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/db/row_store.h"
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+const std::vector<Type> k_types = {
+    Type::Integer, Type::UInteger, Type::Float,  Type::Double,
+    Type::String,  Type::Bytes,    Type::Decimal, Type::Json,
+    Type::Date,    Type::Bit,      Type::String,  Type::Null,
+};
+
+std::unique_ptr<Mutable_row> make_row(int64_t i) {
+  auto row = std::make_unique<Mutable_row>(k_types);
+
+  row->set_field(0, static_cast<int64_t>(-i));
+  row->set_field(1, static_cast<uint64_t>(i));
+  row->set_field(2, static_cast<float>(i) / 4);
+  row->set_field(3, static_cast<double>(i) / 8);
+  row->set_field(4, std::string(i % 100, 'x'));
+  row->set_field(5, std::string("\0\1\2", 3));
+  row->set_field(6, std::to_string(i) + ".5");
+  row->set_field(7, "{\"a\": " + std::to_string(i) + "}");
+  row->set_field(8, "2024-01-01");
+  row->set_field(9, "10110");
+
+  if (i % 3) {
+    row->set_field(10, "odd");
+  }
+
+  return row;
+}
+
+void expect_same(const IRow &expected, const IRow &actual) {
+  ASSERT_EQ(expected.num_fields(), actual.num_fields());
+
+  for (uint32_t f = 0; f < expected.num_fields(); ++f) {
+    SCOPED_TRACE(f);
+
+    EXPECT_EQ(expected.get_type(f), actual.get_type(f));
+    EXPECT_EQ(expected.is_null(f), actual.is_null(f));
+    EXPECT_EQ(expected.get_as_string(f), actual.get_as_string(f));
+
+    if (expected.is_null(f)) {
+      EXPECT_THROW(actual.get_string(f), std::invalid_argument);
+      continue;
+    }
+
+    const char *expected_data;
+    size_t expected_size;
+    const char *actual_data;
+    size_t actual_size;
+
+    expected.get_raw_data(f, &expected_data, &expected_size);
+    actual.get_raw_data(f, &actual_data, &actual_size);
+
+    EXPECT_EQ(std::string(expected_data, expected_size),
+              std::string(actual_data, actual_size));
+
+    switch (expected.get_type(f)) {
+      case Type::Integer:
+        EXPECT_EQ(expected.get_int(f), actual.get_int(f));
+        EXPECT_THROW(actual.get_string(f), std::invalid_argument);
+        break;
+
+      case Type::UInteger:
+        EXPECT_EQ(expected.get_uint(f), actual.get_uint(f));
+        EXPECT_EQ(expected.get_int(f), actual.get_int(f));
+        break;
+
+      case Type::Float:
+        EXPECT_EQ(expected.get_float(f), actual.get_float(f));
+        EXPECT_EQ(expected.get_double(f), actual.get_double(f));
+        break;
+
+      case Type::Double:
+        EXPECT_EQ(expected.get_double(f), actual.get_double(f));
+        break;
+
+      case Type::String:
+      case Type::Bytes:
+        EXPECT_EQ(std::string(expected.get_string_data(f).first,
+                              expected.get_string_data(f).second),
+                  std::string(actual.get_string_data(f).first,
+                              actual.get_string_data(f).second));
+        EXPECT_EQ(expected.get_string(f), actual.get_string(f));
+        break;
+
+      case Type::Decimal:
+        EXPECT_EQ(expected.get_double(f), actual.get_double(f));
+        EXPECT_THROW(actual.get_int(f), std::invalid_argument);
+        break;
+
+      case Type::Bit:
+        EXPECT_EQ(expected.get_bit(f), actual.get_bit(f));
+        break;
+
+      default:
+        EXPECT_EQ(expected.get_string(f), actual.get_string(f));
+        break;
+    }
+  }
+
+  EXPECT_THROW(actual.is_null(expected.num_fields()), std::invalid_argument);
+}
+
+}  // namespace
+
+TEST(Row_store, same_as_row_copy) {
+  constexpr int64_t k_rows = 5000;
+  Row_store store;
+
+  EXPECT_TRUE(store.empty());
+
+  for (int64_t i = 0; i < k_rows; ++i) {
+    store.emplace_back(*make_row(i));
+  }
+
+  ASSERT_EQ(k_rows, store.size());
+
+  for (int64_t i = 0; i < k_rows; ++i) {
+    SCOPED_TRACE(i);
+    expect_same(Row_copy(*make_row(i)), store[i]);
+  }
+
+  // rows are consumed one by one, memory is released in the meantime
+  for (int64_t i = 0; i < k_rows; ++i) {
+    SCOPED_TRACE(i);
+    expect_same(Row_copy(*make_row(i)), store.front());
+    store.pop_front();
+  }
+
+  EXPECT_TRUE(store.empty());
+
+  // store can be reused after it was emptied
+  store.emplace_back(*make_row(7));
+  ASSERT_EQ(1, store.size());
+  expect_same(Row_copy(*make_row(7)), store.front());
+
+  store.clear();
+  EXPECT_TRUE(store.empty());
+
+  // different fields can be stored once the store is cleared
+  Mutable_row row{{Type::String}, "single"};
+  store.emplace_back(row);
+  expect_same(row, store.front());
+
+  EXPECT_THROW(store.emplace_back(*make_row(1)), std::logic_error);
+}
+
+TEST(Row_store, large_fields) {
+  Row_store store;
+  const std::string large(1024 * 1024, 'y');
+
+  for (int i = 0; i < 3; ++i) {
+    Mutable_row row{{Type::Integer, Type::Bytes}, i, large + std::to_string(i)};
+    store.emplace_back(row);
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(i, store[i].get_int(0));
+    EXPECT_EQ(large + std::to_string(i), store[i].get_string(1));
+  }
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
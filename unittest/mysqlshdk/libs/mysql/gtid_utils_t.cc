@@ -34,7 +34,17 @@ namespace mysqlshdk {
 namespace mysql {
 
 class Gtid_utils : public tests::Shell_test_env {
- public:
+ protected:
+  void SetUp() override {
+    tests::Shell_test_env::SetUp();
+    // results computed locally are compared with the ones from the server
+    Gtid_set::set_server_verification(true);
+  }
+
+  void TearDown() override {
+    Gtid_set::set_server_verification(false);
+    tests::Shell_test_env::TearDown();
+  }
 };
 
 TEST_F(Gtid_utils, gtid_set_basics) {
@@ -376,5 +386,163 @@ TEST_F(Gtid_utils, subtract_view_changes) {
       gtid_set.str());
 }
 
+TEST_F(Gtid_utils, server_verification) {
+  auto session = std::make_shared<testing::Mock_mysql_session>();
+  mysqlshdk::mysql::Instance server(session);
+
+  const auto set = Gtid_set::from_string(
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43");
+  const auto subset =
+      Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-5");
+
+  // results which differ from the ones computed by the server are errors
+  session
+      ->expect_query(
+          "SELECT gtid_subtract('8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43', "
+          "'8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-5')")
+      .then({""})
+      .add_row({"8b8dc2ba-8803-11eb-af3d-a1178d81dccc:7-43"});
+
+  auto result = set;
+  EXPECT_THROW(result.subtract(subset, server), std::logic_error);
+
+  session
+      ->expect_query(
+          "SELECT gtid_subtract('8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-5', "
+          "'8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43') = ''")
+      .then({""}, {db::Type::Integer})
+      .add_row({"0"});
+
+  EXPECT_THROW(set.contains(subset, server), std::logic_error);
+}
+
+TEST(Gtid_intervals, parse) {
+  const auto normalize = [](std::string_view gtid_set) {
+    return Gtid_intervals::parse(gtid_set).to_string();
+  };
+
+  EXPECT_EQ("", normalize(""));
+  EXPECT_EQ("", normalize(" \n "));
+  EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43",
+            normalize("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43"));
+  EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43",
+            normalize("8B8DC2BA-8803-11EB-AF3D-A1178D81DCCC:1-43"));
+  EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43",
+            normalize("{8b8dc2ba-8803-11eb-af3d-a1178d81dccc}:1-43"));
+  EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43",
+            normalize("8b8dc2ba880311ebaf3da1178d81dccc:1-43"));
+  EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-44:46",
+            normalize("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:46:1-43, "
+                      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:44:2-5:46"));
+  EXPECT_EQ(
+      "88888888-8803-11eb-af3d-a1178d81dccc:1-8,\n8b8dc2ba-8803-11eb-af3d-"
+      "a1178d81dccc:1-43",
+      normalize("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43,\n"
+                "88888888-8803-11eb-af3d-a1178d81dccc:1-8"));
+  EXPECT_EQ(
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-5:aa:1-3:bb:7,\n"
+      "9b8dc2ba-0000-11eb-af3d-a1178d81dccc:tag:4",
+      normalize("9b8dc2ba-0000-11eb-af3d-a1178d81dccc:TAG:4,"
+                "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:bb:7:aa:1-3,"
+                "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-5"));
+
+  for (const auto malformed : {
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dcc:1",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccx:1",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:0",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:5-3",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1a",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:-1",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:9223372036854775808",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1:",
+           "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:tag-1:1",
+       }) {
+    SCOPED_TRACE(malformed);
+    EXPECT_THROW(Gtid_intervals::parse(malformed), std::invalid_argument);
+  }
+}
+
+TEST(Gtid_intervals, operations) {
+  const std::string uuid = "8b8dc2ba-8803-11eb-af3d-a1178d81dccc";
+  const std::string other = "9b8dc2ba-0000-11eb-af3d-a1178d81dccc";
+  const auto set = [](const std::string &gtid_set) {
+    return Gtid_intervals::parse(gtid_set);
+  };
+
+  {
+    auto gtids = set(uuid + ":1-10:20-30:40-50");
+    gtids.subtract(set(uuid + ":5-25:45," + other + ":1-100"));
+    EXPECT_EQ(uuid + ":1-4:26-30:40-44:46-50", gtids.to_string());
+
+    gtids.subtract(set(uuid + ":1-100"));
+    EXPECT_TRUE(gtids.empty());
+    EXPECT_EQ("", gtids.to_string());
+  }
+
+  {
+    auto gtids = set(uuid + ":1-10:20-30:40-50," + other + ":1-5");
+    gtids.intersect(set(uuid + ":5-25:45-60:70"));
+    EXPECT_EQ(uuid + ":5-10:20-25:45-50", gtids.to_string());
+    EXPECT_EQ(18, gtids.count());
+  }
+
+  {
+    auto gtids = set(uuid + ":1-10:tag:1");
+    gtids.add(set(uuid + ":11-20:30," + other + ":tag:2"));
+    gtids.add(uuid, 21, 29);
+    EXPECT_EQ(uuid + ":1-30:tag:1,\n" + other + ":tag:2", gtids.to_string());
+
+    EXPECT_TRUE(gtids.contains(set(uuid + ":5-25")));
+    EXPECT_TRUE(gtids.contains(set(uuid + ":tag:1," + other + ":tag:2")));
+    EXPECT_TRUE(gtids.contains(Gtid_intervals()));
+    EXPECT_FALSE(gtids.contains(set(uuid + ":30-31")));
+    EXPECT_FALSE(gtids.contains(set(uuid + ":tag:2")));
+    EXPECT_FALSE(gtids.contains(set(other + ":2")));
+
+    std::vector<Gtid_range> ranges;
+    gtids.enumerate_ranges(
+        [&ranges](const Gtid_range &range) { ranges.emplace_back(range); });
+
+    ASSERT_EQ(3, ranges.size());
+    EXPECT_EQ(Gtid_range(uuid, 1, 30), ranges[0]);
+    EXPECT_EQ(Gtid_range(uuid + ":tag", 1, 1), ranges[1]);
+    EXPECT_EQ(Gtid_range(other + ":tag", 2, 2), ranges[2]);
+  }
+}
+
+TEST(Gtid_utils_local, gtid_set_ops) {
+  Gtid_set gs2_r(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", 1, 43});
+  Gtid_set gs3(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", 1, 5});
+  Gtid_set gs7(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", 10, 20});
+  Gtid_set gs8(Gtid_range{"88888888-8803-11eb-af3d-a1178d81dccc", 1, 8});
+
+  auto gs2 = gs2_r;
+  gs2.add(gs8);
+  EXPECT_THROW(gs2.count(), std::invalid_argument);
+  gs2.normalize();
+  EXPECT_EQ(
+      "88888888-8803-11eb-af3d-a1178d81dccc:1-8,\n8b8dc2ba-8803-11eb-af3d-"
+      "a1178d81dccc:1-43",
+      gs2.str());
+  EXPECT_EQ(51, gs2.count());
+
+  EXPECT_TRUE(gs2.contains(gs3));
+  EXPECT_FALSE(gs3.contains(gs2));
+
+  gs2.subtract(gs7);
+  EXPECT_EQ(
+      "88888888-8803-11eb-af3d-a1178d81dccc:1-8,\n8b8dc2ba-8803-11eb-af3d-"
+      "a1178d81dccc:1-9:21-43",
+      gs2.str());
+
+  gs2.intersect(gs2_r);
+  EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-9:21-43", gs2.str());
+
+  gs2.subtract(gs2);
+  EXPECT_TRUE(gs2.empty());
+  EXPECT_EQ(Gtid_set(), gs2);
+}
+
 }  // namespace mysql
 }  // namespace mysqlshdk
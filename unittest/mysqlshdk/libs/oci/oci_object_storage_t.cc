@@ -34,6 +34,22 @@ using mysqlshdk::storage::backend::object_storage::Directory;
 
 namespace testing {
 
+namespace {
+
+// multipart uploads are tested with parts uploaded synchronously and in the
+// background
+constexpr std::size_t k_parts_in_flight[] = {
+    0, mysqlshdk::oci::Oci_bucket_config::DEFAULT_MAX_PARTS_IN_FLIGHT};
+
+void expect_uploaded_parts(std::size_t expected, std::size_t parts_in_flight,
+                           std::size_t actual) {
+  // parts uploaded in the background may still be in flight
+  EXPECT_GE(expected, actual);
+  EXPECT_LE(expected - std::min(expected, parts_in_flight), actual);
+}
+
+}  // namespace
+
 TEST_F(Oci_os_tests, directory_list_files) {
   SKIP_IF_NO_OCI_CONFIGURATION;
 
@@ -186,45 +202,142 @@ TEST_F(Oci_os_tests, file_write_simple_upload) {
 TEST_F(Oci_os_tests, file_write_multipart_upload) {
   SKIP_IF_NO_OCI_CONFIGURATION;
 
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
+
+    auto config = get_config();
+    config->set_part_size(3);
+    config->set_max_parts_in_flight(parts_in_flight);
+    Oci_bucket bucket(config);
+    Directory root(config, "test");
+
+    auto file = root.file("sample\".txt");
+
+    std::string data = "0123456789ABCDE";
+    size_t offset = 0;
+
+    file->open(Mode::WRITE);
+    offset += file->write(data.data() + offset, 5);
+    offset += file->write(data.data() + offset, 5);
+    offset += file->write(data.data() + offset, 5);
+    EXPECT_EQ(offset, data.size());
+
+    auto uploads = bucket.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
+    auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
+    // Last part is still on the buffer
+    expect_uploaded_parts(4, parts_in_flight, parts.size());
+
+    file->close();
+    EXPECT_THROW_LIKE(bucket.list_multipart_uploaded_parts(uploads[0]),
+                      Response_error,
+                      "Failed to list uploaded parts for object "
+                      "'test/sample\".txt': No such upload");
+    uploads = bucket.list_multipart_uploads();
+    EXPECT_TRUE(uploads.empty());
+
+    file->open(Mode::READ);
+    char buffer[20];
+    size_t read = file->read(buffer, 20);
+    EXPECT_EQ(15, read);
+    std::string final_data(buffer, read);
+    EXPECT_STREQ("0123456789ABCDE", final_data.c_str());
+    file->close();
+
+    bucket.delete_object("test/sample\".txt");
+  }
+}
+
+TEST_F(Oci_os_tests, file_write_multipart_upload_in_background) {
+  SKIP_IF_NO_OCI_CONFIGURATION;
+
   auto config = get_config();
   config->set_part_size(3);
+  config->set_max_parts_in_flight(4);
   Oci_bucket bucket(config);
   Directory root(config, "test");
 
-  auto file = root.file("sample\".txt");
+  auto file = root.file("sample.txt");
 
-  std::string data = "0123456789ABCDE";
-  size_t offset = 0;
+  std::string data;
+
+  for (int i = 0; i < 10; ++i) {
+    data += "0123456789ABCDE";
+  }
 
   file->open(Mode::WRITE);
-  offset += file->write(data.data() + offset, 5);
-  offset += file->write(data.data() + offset, 5);
-  offset += file->write(data.data() + offset, 5);
-  EXPECT_EQ(offset, data.size());
 
-  auto uploads = bucket.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
-  auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(4, parts.size());  // Last part is still on the buffer
+  for (size_t offset = 0; offset < data.size(); offset += 5) {
+    EXPECT_EQ(5, file->write(data.data() + offset, 5));
+  }
+
+  EXPECT_EQ(data.size(), file->file_size());
 
   file->close();
-  EXPECT_THROW_LIKE(bucket.list_multipart_uploaded_parts(uploads[0]),
-                    Response_error,
-                    "Failed to list uploaded parts for object "
-                    "'test/sample\".txt': No such upload");
-  uploads = bucket.list_multipart_uploads();
-  EXPECT_TRUE(uploads.empty());
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
 
   file->open(Mode::READ);
-  char buffer[20];
-  size_t read = file->read(buffer, 20);
-  EXPECT_EQ(15, read);
-  std::string final_data(buffer, read);
-  EXPECT_STREQ("0123456789ABCDE", final_data.c_str());
+  std::string buffer;
+  buffer.resize(data.size() + 10);
+  size_t read = file->read(buffer.data(), buffer.size());
+  EXPECT_EQ(data.size(), read);
+  buffer.resize(read);
+  EXPECT_EQ(data, buffer);
   file->close();
 
-  bucket.delete_object("test/sample\".txt");
+  bucket.delete_object("test/sample.txt");
+}
+
+TEST_F(Oci_os_tests, file_read_ahead) {
+  SKIP_IF_NO_OCI_CONFIGURATION;
+
+  auto config = get_config();
+  config->set_read_ahead_block_size(7);
+  config->set_max_reads_in_flight(3);
+  Oci_bucket bucket(config);
+  Directory root(config, "test");
+
+  auto file = root.file("sample.txt");
+
+  std::string data;
+
+  for (int i = 0; i < 10; ++i) {
+    data += "0123456789ABCDE";
+  }
+
+  file->open(Mode::WRITE);
+  file->write(data.data(), data.size());
+  file->close();
+
+  file->open(Mode::READ);
+
+  // sequential reads
+  std::string buffer;
+  char chunk[5];
+  ssize_t read = 0;
+
+  while ((read = file->read(chunk, sizeof(chunk))) > 0) {
+    buffer.append(chunk, read);
+  }
+
+  EXPECT_EQ(data, buffer);
+
+  // random access restarts the read-ahead
+  file->seek(20);
+  EXPECT_EQ(5, file->read(chunk, sizeof(chunk)));
+  EXPECT_EQ(data.substr(20, 5), std::string(chunk, 5));
+  file->seek(3);
+  EXPECT_EQ(5, file->read(chunk, sizeof(chunk)));
+  EXPECT_EQ(data.substr(3, 5), std::string(chunk, 5));
+  EXPECT_EQ(5, file->read(chunk, sizeof(chunk)));
+  EXPECT_EQ(data.substr(8, 5), std::string(chunk, 5));
+  EXPECT_EQ(5, file->read(chunk, sizeof(chunk)));
+  EXPECT_EQ(data.substr(13, 5), std::string(chunk, 5));
+
+  file->close();
+
+  bucket.delete_object("test/sample.txt");
 }
 
 TEST_F(Oci_os_tests, file_append_new_file) {
@@ -258,55 +371,66 @@ TEST_F(Oci_os_tests, file_append_new_file) {
 TEST_F(Oci_os_tests, file_append_resume_interrupted_upload) {
   SKIP_IF_NO_OCI_CONFIGURATION;
 
-  auto config = get_config();
-  config->set_part_size(3);
-  Oci_bucket bucket(config);
-  Directory root(config);
-
-  auto initial_file = root.file("sample.txt");
-
-  std::string data = "0123456789ABCDE";
-  size_t offset = 0;
-
-  initial_file->open(Mode::WRITE);
-  offset += initial_file->write(data.data() + offset, 5);
-  offset += initial_file->write(data.data() + offset, 5);
-
-  // INTERRUPTION: We stop writing to initial_file as it got interrupted
-  // At this point the file is an active multipart upload:
-  // Sent Parts: 012, 345, 678
-  // Buffered (lost): 9
-
-  // RESUME THE UPLOAD
-  auto final_file = root.file("sample.txt");
-
-  final_file->open(Mode::APPEND);
-  offset = final_file->file_size();
-  offset += final_file->write(data.data() + offset, 5);
-  auto uploads = bucket.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("sample.txt", uploads[0].name.c_str());
-  auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(4, parts.size());
-
-  offset += final_file->write(data.data() + offset, data.size() - offset);
-
-  final_file->close();
-  EXPECT_THROW_LIKE(
-      bucket.list_multipart_uploaded_parts(uploads[0]), Response_error,
-      "Failed to list uploaded parts for object 'sample.txt': No such upload");
-  uploads = bucket.list_multipart_uploads();
-  EXPECT_TRUE(uploads.empty());
-
-  final_file->open(Mode::READ);
-  char buffer[20];
-  size_t read = final_file->read(buffer, 20);
-  EXPECT_EQ(15, read);
-  std::string final_data(buffer, read);
-  EXPECT_STREQ("0123456789ABCDE", final_data.c_str());
-  final_file->close();
-
-  bucket.delete_object("sample.txt");
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
+
+    // initial upload is synchronous, so that it's interrupted at a known point
+    auto initial_config = get_config();
+    initial_config->set_part_size(3);
+    initial_config->set_max_parts_in_flight(0);
+
+    auto config = get_config();
+    config->set_part_size(3);
+    config->set_max_parts_in_flight(parts_in_flight);
+    Oci_bucket bucket(config);
+    Directory root(config);
+
+    auto initial_file = Directory(initial_config).file("sample.txt");
+
+    std::string data = "0123456789ABCDE";
+    size_t offset = 0;
+
+    initial_file->open(Mode::WRITE);
+    offset += initial_file->write(data.data() + offset, 5);
+    offset += initial_file->write(data.data() + offset, 5);
+
+    // INTERRUPTION: We stop writing to initial_file as it got interrupted
+    // At this point the file is an active multipart upload:
+    // Sent Parts: 012, 345, 678
+    // Buffered (lost): 9
+
+    // RESUME THE UPLOAD
+    auto final_file = root.file("sample.txt");
+
+    final_file->open(Mode::APPEND);
+    offset = final_file->file_size();
+    offset += final_file->write(data.data() + offset, 5);
+    auto uploads = bucket.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("sample.txt", uploads[0].name.c_str());
+    auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
+    expect_uploaded_parts(4, parts_in_flight, parts.size());
+
+    offset += final_file->write(data.data() + offset, data.size() - offset);
+
+    final_file->close();
+    EXPECT_THROW_LIKE(bucket.list_multipart_uploaded_parts(uploads[0]),
+                      Response_error,
+                      "Failed to list uploaded parts for object 'sample.txt': "
+                      "No such upload");
+    uploads = bucket.list_multipart_uploads();
+    EXPECT_TRUE(uploads.empty());
+
+    final_file->open(Mode::READ);
+    char buffer[20];
+    size_t read = final_file->read(buffer, 20);
+    EXPECT_EQ(15, read);
+    std::string final_data(buffer, read);
+    EXPECT_STREQ("0123456789ABCDE", final_data.c_str());
+    final_file->close();
+
+    bucket.delete_object("sample.txt");
+  }
 }
 
 TEST_F(Oci_os_tests, file_append_existing_file) {
@@ -347,27 +471,38 @@ TEST_F(Oci_os_tests, file_append_existing_file) {
 TEST_F(Oci_os_tests, file_write_multipart_errors) {
   SKIP_IF_NO_OCI_CONFIGURATION;
 
-  output_handler.set_log_level(shcore::Logger::LOG_LEVEL::LOG_DEBUG2);
-
-  auto config = get_config();
-  config->set_part_size(3);
-  Oci_bucket bucket(config);
-  Directory root(config);
-  // Now APPEND should be allowed
-  auto mpo1 = bucket.create_multipart_upload("sample.txt");
-  auto file = root.file("sample.txt");
-
-  file->open(Mode::APPEND);
-
-  bucket.abort_multipart_upload(mpo1);
-
-  EXPECT_THROW_LIKE(
-      file->write("67890", 5), shcore::Exception,
-      "Failed to upload part 1 for object 'sample.txt': No such upload (404)");
-
-  // write has failed and file state has been reset, there's not going to be any
-  // more communication with the server
-  EXPECT_NO_THROW(file->close());
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
+
+    output_handler.set_log_level(shcore::Logger::LOG_LEVEL::LOG_DEBUG2);
+
+    auto config = get_config();
+    config->set_part_size(3);
+    config->set_max_parts_in_flight(parts_in_flight);
+    Oci_bucket bucket(config);
+    Directory root(config);
+    // Now APPEND should be allowed
+    auto mpo1 = bucket.create_multipart_upload("sample.txt");
+    auto file = root.file("sample.txt");
+
+    file->open(Mode::APPEND);
+
+    bucket.abort_multipart_upload(mpo1);
+
+    // parts uploaded in the background report errors with a delay
+    EXPECT_THROW_LIKE(
+        {
+          file->write("67890", 5);
+          file->close();
+        },
+        shcore::Exception,
+        "Failed to upload part 1 for object 'sample.txt': No such upload "
+        "(404)");
+
+    // upload has failed and file state has been reset, there's not going to be
+    // any more communication with the server
+    EXPECT_NO_THROW(file->close());
+  }
 }
 
 TEST_F(Oci_os_tests, file_writing) {
@@ -488,38 +623,44 @@ TEST_F(Oci_os_tests, file_rename) {
 TEST_F(Oci_os_tests, file_auto_cancel_multipart_upload) {
   SKIP_IF_NO_OCI_CONFIGURATION;
 
-  auto config = get_config();
-  config->set_part_size(3);
-  Oci_bucket bucket(config);
-  Directory root(config, "test");
+  for (const auto parts_in_flight : k_parts_in_flight) {
+    SCOPED_TRACE("parts in flight: " + std::to_string(parts_in_flight));
 
-  auto file = root.file("sample\".txt");
+    auto config = get_config();
+    config->set_part_size(3);
+    config->set_max_parts_in_flight(parts_in_flight);
+    Oci_bucket bucket(config);
+    Directory root(config, "test");
 
-  std::string data = "0123456789ABCDE";
-  size_t offset = 0;
+    auto file = root.file("sample\".txt");
 
-  file->open(Mode::WRITE);
-  offset += file->write(data.data() + offset, 5);
-  offset += file->write(data.data() + offset, 5);
-  offset += file->write(data.data() + offset, 5);
+    std::string data = "0123456789ABCDE";
+    size_t offset = 0;
 
-  const auto uploads = bucket.list_multipart_uploads();
-  EXPECT_EQ(1, uploads.size());
-  EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
+    file->open(Mode::WRITE);
+    offset += file->write(data.data() + offset, 5);
+    offset += file->write(data.data() + offset, 5);
+    offset += file->write(data.data() + offset, 5);
 
-  const auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
-  EXPECT_EQ(4, parts.size());  // Last part is still on the buffer
+    const auto uploads = bucket.list_multipart_uploads();
+    EXPECT_EQ(1, uploads.size());
+    EXPECT_STREQ("test/sample\".txt", uploads[0].name.c_str());
 
-  // release the file, simulating abnormal situation (close() was not called,
-  // destructor should clean up the upload)
-  file.reset();
+    const auto parts = bucket.list_multipart_uploaded_parts(uploads[0]);
+    // Last part is still on the buffer
+    expect_uploaded_parts(4, parts_in_flight, parts.size());
 
-  EXPECT_THROW_LIKE(bucket.list_multipart_uploaded_parts(uploads[0]),
-                    Response_error,
-                    "Failed to list uploaded parts for object "
-                    "'test/sample\".txt': No such upload");
+    // release the file, simulating abnormal situation (close() was not called,
+    // destructor should clean up the upload)
+    file.reset();
 
-  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+    EXPECT_THROW_LIKE(bucket.list_multipart_uploaded_parts(uploads[0]),
+                      Response_error,
+                      "Failed to list uploaded parts for object "
+                      "'test/sample\".txt': No such upload");
+
+    EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+  }
 }
 
 }  // namespace testing
@@ -32,6 +32,8 @@
 #include <utility>
 #include "mysqlshdk/libs/storage/backend/memory_file.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/compression/gz_file.h"
+#include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
 
 namespace mysqlshdk {
@@ -250,6 +252,14 @@ class Compression
         EXPECT_EQ(static_cast<std::string::value_type>(0xfd), header[3]);
         break;
 
+      case mysqlshdk::storage::Compression::LZ4:
+        // is lz4? (lz4 frame header startswith "\x04\x22\x4d\x18")
+        EXPECT_EQ(static_cast<std::string::value_type>(0x04), header[0]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x22), header[1]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x4d), header[2]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x18), header[3]);
+        break;
+
       case mysqlshdk::storage::Compression::NONE:
         break;
     }
@@ -394,9 +404,369 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, ""),
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "off"),
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "on"),
-        std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "required")),
+        std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "required"),
+        std::make_tuple(mysqlshdk::storage::Compression::LZ4, "")),
     fmt_compr);
 
+TEST(Compression_zstd, multithreaded) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+  using mysqlshdk::storage::compression::Zstd_thread_pool;
+
+  if (!Zstd_thread_pool::multithreading_supported()) {
+    SKIP_TEST("zstd library does not support multi-threading");
+  }
+
+  Generate_text g;
+  std::vector<std::string> inputs;
+
+  for (const auto length : {0, 1, 8313, 4 * 1024 * 1024, 16 * 1024 * 1024}) {
+    inputs.emplace_back(g.bytes(length));
+  }
+
+  Compression_options options;
+  options.threads = 2;
+  options.zstd_thread_pool = std::make_shared<Zstd_thread_pool>(3);
+
+  std::vector<std::unique_ptr<IFile>> files;
+  std::vector<Memory_file *> storages;
+
+  // files share the same pool and are written at the same time
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    auto storage = std::make_unique<Memory_file>("");
+    storages.emplace_back(storage.get());
+    files.emplace_back(
+        make_file(std::move(storage), storage::Compression::ZSTD, options));
+    files.back()->open(Mode::WRITE);
+  }
+
+  constexpr std::size_t k_step = 100000;
+
+  for (std::size_t offset = 0; offset < inputs.back().size();
+       offset += k_step) {
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+      if (offset < inputs[i].size()) {
+        const auto length = std::min(k_step, inputs[i].size() - offset);
+        EXPECT_EQ(static_cast<ssize_t>(length),
+                  files[i]->write(inputs[i].data() + offset, length));
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    SCOPED_TRACE(i);
+
+    files[i]->close();
+
+    // output is a regular zstd stream, which can be decompressed by a
+    // single-threaded reader
+    auto source = std::make_unique<Memory_file>("");
+    source->set_content(storages[i]->content());
+
+    const auto decompress =
+        make_file(std::move(source), storage::Compression::ZSTD);
+    decompress->open(Mode::READ);
+
+    std::string output;
+    byte buffer[BUFSIZE];
+
+    for (auto read_bytes = decompress->read(buffer, BUFSIZE); read_bytes > 0;
+         read_bytes = decompress->read(buffer, BUFSIZE)) {
+      output.append(buffer, read_bytes);
+    }
+
+    decompress->close();
+
+    EXPECT_EQ(inputs[i], output);
+  }
+}
+
+TEST(Compression_gzip, multithreaded) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+  using mysqlshdk::storage::compression::Gz_thread_pool;
+
+  Generate_text g;
+  std::vector<std::string> inputs;
+
+  for (const auto length : {0, 1, 8313, 1024 * 1024, 4 * 1024 * 1024 + 17}) {
+    inputs.emplace_back(g.bytes(length));
+  }
+
+  Compression_options options;
+  options.threads = 2;
+  options.gz_thread_pool = std::make_shared<Gz_thread_pool>(3);
+
+  std::vector<std::unique_ptr<IFile>> files;
+  std::vector<Memory_file *> storages;
+
+  // files share the same pool and are written at the same time
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    auto storage = std::make_unique<Memory_file>("");
+    storages.emplace_back(storage.get());
+    files.emplace_back(
+        make_file(std::move(storage), storage::Compression::GZIP, options));
+    files.back()->open(Mode::WRITE);
+  }
+
+  constexpr std::size_t k_step = 100000;
+
+  for (std::size_t offset = 0; offset < inputs.back().size();
+       offset += k_step) {
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+      if (offset < inputs[i].size()) {
+        const auto length = std::min(k_step, inputs[i].size() - offset);
+        EXPECT_EQ(static_cast<ssize_t>(length),
+                  files[i]->write(inputs[i].data() + offset, length));
+      }
+    }
+  }
+
+  const auto decompress = [](const std::string &content,
+                             const Compression_options &o) {
+    auto source = std::make_unique<Memory_file>("");
+    source->set_content(content);
+
+    const auto file =
+        make_file(std::move(source), storage::Compression::GZIP, o);
+    file->open(Mode::READ);
+
+    std::string output;
+    byte buffer[BUFSIZE];
+
+    for (auto read_bytes = file->read(buffer, BUFSIZE); read_bytes > 0;
+         read_bytes = file->read(buffer, BUFSIZE)) {
+      output.append(buffer, read_bytes);
+    }
+
+    EXPECT_EQ(static_cast<off64_t>(output.size()), file->tell());
+
+    file->close();
+
+    return output;
+  };
+
+  Compression_options read_options;
+  read_options.threads = 3;
+
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    SCOPED_TRACE(i);
+
+    files[i]->close();
+
+    const auto &content = storages[i]->content();
+
+    // output is a regular gzip stream, which can be decompressed by a
+    // single-threaded reader
+    EXPECT_EQ(inputs[i], decompress(content, {}));
+    EXPECT_EQ(inputs[i], decompress(content, read_options));
+
+    // members written by the workers followed by a member which was not
+    // written by a worker
+    std::string plain;
+
+    {
+      auto storage = std::make_unique<Memory_file>("");
+      const auto storage_ptr = storage.get();
+      const auto file =
+          make_file(std::move(storage), storage::Compression::GZIP);
+      file->open(Mode::WRITE);
+      file->write("plain member", 12);
+      file->close();
+
+      plain = storage_ptr->content();
+    }
+
+    EXPECT_EQ(inputs[i] + "plain member", decompress(content + plain, {}));
+    EXPECT_EQ(inputs[i] + "plain member",
+              decompress(content + plain, read_options));
+    EXPECT_EQ("plain member" + inputs[i], decompress(plain + content, {}));
+    EXPECT_EQ("plain member" + inputs[i],
+              decompress(plain + content, read_options));
+  }
+}
+
+TEST(Compression_zstd, seekable) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+
+  Generate_text g;
+  const auto input = g.bytes(3 * 1024 * 1024 + 17);
+
+  Compression_options options;
+  options.frame_size = 100000;
+
+  auto storage = std::make_unique<Memory_file>("");
+  const auto storage_ptr = storage.get();
+  const auto compress =
+      make_file(std::move(storage), storage::Compression::ZSTD, options);
+  compress->open(Mode::WRITE);
+
+  constexpr std::size_t k_step = 77777;
+
+  for (std::size_t offset = 0; offset < input.size(); offset += k_step) {
+    compress->write(input.data() + offset,
+                    std::min(k_step, input.size() - offset));
+  }
+
+  compress->close();
+
+  auto source = std::make_unique<Memory_file>("");
+  source->set_content(storage_ptr->content());
+
+  const auto decompress =
+      make_file(std::move(source), storage::Compression::ZSTD);
+  auto zstd = dynamic_cast<Compressed_file *>(decompress.get());
+  ASSERT_NE(nullptr, zstd);
+
+  decompress->open(Mode::READ);
+
+  const auto size = zstd->uncompressed_size();
+  ASSERT_TRUE(size.has_value());
+  EXPECT_EQ(input.size(), *size);
+
+  const auto read_at = [&decompress](std::size_t offset, std::size_t length) {
+    std::string output;
+    output.resize(length);
+
+    EXPECT_EQ(static_cast<off64_t>(offset), decompress->seek(offset));
+
+    std::size_t total = 0;
+
+    while (total < length) {
+      const auto bytes =
+          decompress->read(output.data() + total, length - total);
+
+      if (bytes <= 0) {
+        break;
+      }
+
+      total += bytes;
+    }
+
+    output.resize(total);
+    return output;
+  };
+
+  // random access
+  for (const auto &[offset, length] :
+       std::vector<std::pair<std::size_t, std::size_t>>{{0, 10},
+                                                        {2000000, 300000},
+                                                        {99999, 2},
+                                                        {100000, 1},
+                                                        {5, 250000},
+                                                        {input.size() - 5, 10},
+                                                        {input.size(), 10}}) {
+    SCOPED_TRACE(std::to_string(offset) + ", " + std::to_string(length));
+    EXPECT_EQ(input.substr(offset, length), read_at(offset, length));
+  }
+
+  // sequential reads which step back a little
+  std::string output;
+
+  for (std::size_t offset = 0; offset < input.size();) {
+    auto data = read_at(offset, BUFSIZE);
+    output.resize(offset);
+    output += data;
+    offset += data.size() > 2 ? data.size() - 2 : data.size();
+
+    if (data.size() < BUFSIZE) {
+      break;
+    }
+  }
+
+  EXPECT_EQ(input, output);
+
+  decompress->close();
+
+  // regular reader can decompress the file as well
+  source = std::make_unique<Memory_file>("");
+  source->set_content(storage_ptr->content());
+
+  const auto stream =
+      make_file(std::move(source), storage::Compression::ZSTD);
+  stream->open(Mode::READ);
+  output.clear();
+
+  byte buffer[BUFSIZE];
+
+  for (auto read_bytes = stream->read(buffer, BUFSIZE); read_bytes > 0;
+       read_bytes = stream->read(buffer, BUFSIZE)) {
+    output.append(buffer, read_bytes);
+  }
+
+  stream->close();
+
+  EXPECT_EQ(input, output);
+}
+
+TEST(Compression_lz4, invalid_input) {
+  using Memory_file = mysqlshdk::storage::backend::Memory_file;
+
+  const auto read_all = [](const std::string &content) {
+    auto source = std::make_unique<Memory_file>("");
+    source->set_content(content);
+
+    const auto decompress =
+        make_file(std::move(source), storage::Compression::LZ4);
+    decompress->open(Mode::READ);
+
+    std::string output;
+    byte buffer[BUFSIZE];
+
+    for (auto read_bytes = decompress->read(buffer, BUFSIZE); read_bytes > 0;
+         read_bytes = decompress->read(buffer, BUFSIZE)) {
+      output.append(buffer, read_bytes);
+    }
+
+    decompress->close();
+
+    return output;
+  };
+
+  Generate_text g;
+  const auto input = g.bytes(1024 * 1024);
+  std::string compressed;
+
+  {
+    auto storage = std::make_unique<Memory_file>("");
+    const auto target = storage.get();
+    const auto compress =
+        make_file(std::move(storage), storage::Compression::LZ4);
+    compress->open(Mode::WRITE);
+    compress->write(input.data(), input.size());
+    compress->close();
+    compressed = target->content();
+  }
+
+  EXPECT_EQ(input, read_all(compressed));
+
+  // empty file does not contain a frame
+  EXPECT_THROW(read_all(""), std::runtime_error);
+
+  // truncated frame header
+  EXPECT_THROW(read_all(compressed.substr(0, 3)), std::runtime_error);
+
+  // truncated data
+  EXPECT_THROW(read_all(compressed.substr(0, compressed.size() / 2)),
+               std::runtime_error);
+
+  // missing end mark and checksum
+  EXPECT_THROW(read_all(compressed.substr(0, compressed.size() - 4)),
+               std::runtime_error);
+
+  // invalid magic number
+  {
+    auto corrupted = compressed;
+    corrupted[0] ^= 0x01;
+    EXPECT_THROW(read_all(corrupted), std::runtime_error);
+  }
+
+  // corrupted data is detected by the content checksum
+  {
+    auto corrupted = compressed;
+    corrupted[corrupted.size() / 2] ^= 0x01;
+    EXPECT_THROW(read_all(corrupted), std::runtime_error);
+  }
+}
+
 }  // namespace tests
 }  // namespace storage
 }  // namespace mysqlshdk
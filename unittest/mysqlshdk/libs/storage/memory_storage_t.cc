@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+#include "unittest/gtest_clean.h"
+#include "unittest/test_utils/shell_test_env.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "mysqlshdk/libs/storage/backend/memory_storage.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+namespace tests {
+
+namespace {
+
+Memory_storage_ptr make_storage(std::size_t limit) {
+  return std::make_shared<Memory_storage>(limit, [](const std::string &name) {
+    return shcore::str_endswith(name, ".tsv");
+  });
+}
+
+void write(IFile *file, const std::string &data) {
+  file->open(Mode::WRITE);
+  EXPECT_EQ(static_cast<ssize_t>(data.size()),
+            file->write(data.data(), data.size()));
+  file->close();
+}
+
+std::string read(IFile *file) {
+  file->open(Mode::READ);
+
+  std::string data(file->file_size(), '\0');
+  EXPECT_EQ(static_cast<ssize_t>(data.size()),
+            file->read(data.data(), data.size()));
+
+  file->close();
+  return data;
+}
+
+}  // namespace
+
+TEST(Memory_storage, visible_after_close) {
+  const auto storage = make_storage(1024);
+  const auto dir = storage->directory();
+  const auto file = dir->file("a.tsv");
+
+  EXPECT_TRUE(dir->exists());
+  EXPECT_TRUE(dir->is_local());
+  EXPECT_TRUE(dir->list_files().empty());
+  EXPECT_FALSE(file->exists());
+
+  file->open(Mode::WRITE);
+  file->write("abc", 3);
+
+  EXPECT_FALSE(file->exists());
+  EXPECT_TRUE(dir->list_files().empty());
+  EXPECT_EQ(3, file->file_size());
+
+  file->close();
+
+  EXPECT_TRUE(file->exists());
+  EXPECT_EQ(3, file->file_size());
+
+  const auto files = dir->list_files();
+  ASSERT_EQ(1, files.size());
+  EXPECT_EQ("a.tsv", files.begin()->name());
+  EXPECT_EQ(3, files.begin()->size());
+
+  EXPECT_EQ(1, dir->filter_files("*.tsv").size());
+  EXPECT_EQ(0, dir->filter_files("*.json").size());
+}
+
+TEST(Memory_storage, rename) {
+  const auto storage = make_storage(1024);
+  const auto dir = storage->directory();
+
+  auto file = dir->file("a.tsv.dumping");
+  write(file.get(), "abc");
+  file->rename("a.tsv");
+
+  EXPECT_FALSE(dir->file("a.tsv.dumping")->exists());
+  EXPECT_EQ("abc", read(dir->file("a.tsv").get()));
+
+  // rename of an open file changes the name it's published with
+  file = dir->file("b.tsv.dumping");
+  file->open(Mode::WRITE);
+  file->write("de", 2);
+  file->rename("b.tsv");
+  file->close();
+
+  EXPECT_FALSE(dir->file("b.tsv.dumping")->exists());
+  EXPECT_EQ("de", read(dir->file("b.tsv").get()));
+
+  EXPECT_THROW(dir->file("c.tsv")->rename("d.tsv"), std::runtime_error);
+}
+
+TEST(Memory_storage, release_after_read) {
+  const auto storage = make_storage(1024);
+  const auto dir = storage->directory();
+
+  write(dir->file("a.tsv").get(), "abc");
+  write(dir->file("a.json").get(), "{}");
+
+  EXPECT_EQ(5, storage->memory_used());
+
+  // non-transient files can be read multiple times
+  EXPECT_EQ("{}", read(dir->file("a.json").get()));
+  EXPECT_EQ("{}", read(dir->file("a.json").get()));
+  EXPECT_EQ(5, storage->memory_used());
+
+  // transient files are released once read
+  EXPECT_EQ("abc", read(dir->file("a.tsv").get()));
+  EXPECT_EQ(2, storage->memory_used());
+  EXPECT_TRUE(dir->file("a.tsv")->exists());
+  EXPECT_THROW(dir->file("a.tsv")->open(Mode::READ), std::runtime_error);
+
+  EXPECT_THROW(dir->file("b.tsv")->open(Mode::READ), std::runtime_error);
+
+  dir->file("a.json")->remove();
+  EXPECT_EQ(0, storage->memory_used());
+}
+
+TEST(Memory_storage, seek) {
+  const auto storage = make_storage(1024);
+  const auto file = storage->directory()->file("a.tsv");
+
+  file->open(Mode::WRITE);
+  file->write("abcdef", 6);
+  EXPECT_EQ(6, file->seek(6));
+  EXPECT_THROW(file->seek(2), std::logic_error);
+  file->close();
+
+  file->open(Mode::READ);
+  EXPECT_EQ(4, file->seek(4));
+
+  char buffer[8];
+  EXPECT_EQ(2, file->read(buffer, sizeof(buffer)));
+  EXPECT_EQ("ef", std::string(buffer, 2));
+  EXPECT_EQ(6, file->tell());
+  EXPECT_EQ(0, file->read(buffer, sizeof(buffer)));
+  EXPECT_EQ(6, file->seek(100));
+
+  file->close();
+}
+
+TEST(Memory_storage, backpressure) {
+  const auto storage = make_storage(4);
+  const auto dir = storage->directory();
+
+  write(dir->file("x.tsv").get(), "xyz");
+  EXPECT_EQ(3, storage->memory_used());
+
+  std::atomic<bool> written{false};
+
+  // limit is enforced even if reader did not start yet
+  std::thread writer{[&]() {
+    write(dir->file("y.tsv").get(), "xyz");
+    written = true;
+  }};
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_FALSE(written);
+
+  // non-transient files never block
+  write(dir->file("a.json").get(), "{\"a\":1}");
+  EXPECT_FALSE(written);
+
+  EXPECT_EQ("xyz", read(dir->file("x.tsv").get()));
+
+  writer.join();
+
+  EXPECT_TRUE(written);
+  EXPECT_EQ(10, storage->memory_used());
+  EXPECT_EQ("xyz", read(dir->file("y.tsv").get()));
+  EXPECT_EQ(7, storage->memory_used());
+  EXPECT_EQ(3, storage->peak_transient_memory_used());
+}
+
+TEST(Memory_storage, exceed_limit) {
+  const auto storage = make_storage(4);
+  const auto dir = storage->directory();
+
+  const auto a = dir->file("a.tsv");
+  a->open(Mode::WRITE);
+  a->write("abc", 3);
+
+  // nothing can be read, a single file is allowed to exceed the limit
+  const auto b = dir->file("b.tsv");
+  b->open(Mode::WRITE);
+  b->write("def", 3);
+  EXPECT_EQ(6, storage->memory_used());
+
+  std::atomic<bool> written{false};
+
+  // files which are being written count towards the limit
+  std::thread writer{[&]() {
+    a->write("g", 1);
+    written = true;
+  }};
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_FALSE(written);
+
+  // file which exceeds the limit can be finished
+  b->write("h", 1);
+  b->close();
+
+  // once it's visible, other files wait for it to be read
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_FALSE(written);
+
+  EXPECT_EQ("defh", read(b.get()));
+
+  writer.join();
+
+  EXPECT_TRUE(written);
+  a->close();
+  EXPECT_EQ("abcg", read(a.get()));
+  EXPECT_EQ(0, storage->memory_used());
+  EXPECT_EQ(7, storage->peak_transient_memory_used());
+}
+
+TEST(Memory_storage, memory_limit) {
+  constexpr std::size_t k_limit = 16;
+  constexpr int k_files = 100;
+  const auto storage = make_storage(k_limit);
+  const auto dir = storage->directory();
+
+  std::thread writer{[&]() {
+    for (int i = 0; i < k_files; ++i) {
+      const auto file = dir->file(std::to_string(i) + ".tsv");
+      file->open(Mode::WRITE);
+
+      for (int j = 0; j < 3; ++j) {
+        file->write("abc", 3);
+      }
+
+      file->close();
+    }
+  }};
+
+  for (int i = 0; i < k_files; ++i) {
+    const auto name = std::to_string(i) + ".tsv";
+
+    ASSERT_TRUE(storage->wait_for(name));
+    EXPECT_EQ("abcabcabc", read(dir->file(name).get()));
+    EXPECT_GE(k_limit, storage->memory_used());
+  }
+
+  writer.join();
+
+  EXPECT_EQ(0, storage->memory_used());
+  EXPECT_GE(k_limit, storage->peak_transient_memory_used());
+  EXPECT_LT(0, storage->peak_transient_memory_used());
+}
+
+TEST(Memory_storage, interrupt) {
+  const auto storage = make_storage(2);
+  const auto dir = storage->directory();
+
+  write(dir->file("x.tsv").get(), "xyz");
+  read(dir->file("x.tsv").get());
+  write(dir->file("a.tsv").get(), "abc");
+
+  std::thread writer{[&]() {
+    EXPECT_THROW(write(dir->file("b.tsv").get(), "de"), std::runtime_error);
+  }};
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  storage->interrupt();
+
+  writer.join();
+
+  EXPECT_THROW(dir->file("a.tsv")->open(Mode::READ), std::runtime_error);
+  EXPECT_THROW(dir->list_files(), std::runtime_error);
+}
+
+TEST(Memory_storage, wait_for) {
+  const auto storage = make_storage(1024);
+  const auto dir = storage->directory();
+
+  std::thread writer{[&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    write(dir->file("a.json").get(), "{}");
+  }};
+
+  EXPECT_TRUE(storage->wait_for("a.json"));
+  EXPECT_TRUE(dir->file("a.json")->exists());
+
+  writer.join();
+
+  writer = std::thread{[&]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    storage->interrupt();
+  }};
+
+  EXPECT_FALSE(storage->wait_for("b.json"));
+
+  writer.join();
+}
+
+TEST(Memory_storage, config) {
+  const auto storage = make_storage(1024);
+  const auto config = std::make_shared<Memory_storage_config>(storage);
+
+  EXPECT_TRUE(config->valid());
+  EXPECT_EQ("in-memory storage", config->describe("/tmp/dump"));
+
+  write(make_file("/tmp/dump/a.tsv", config).get(), "abc");
+
+  const auto dir = make_directory("/tmp/dump", config);
+  ASSERT_EQ(1, dir->list_files().size());
+  EXPECT_EQ("abc", read(dir->file("a.tsv").get()));
+}
+
+}  // namespace tests
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
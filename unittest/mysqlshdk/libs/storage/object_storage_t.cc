@@ -0,0 +1,859 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+#include "unittest/gtest_clean.h"
+#include "unittest/test_utils/shell_test_env.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/rest/response.h"
+#include "mysqlshdk/libs/storage/backend/object_storage.h"
+#include "mysqlshdk/libs/storage/backend/object_storage_bucket.h"
+#include "mysqlshdk/libs/storage/backend/object_storage_config.h"
+#include "mysqlshdk/libs/storage/backend/object_storage_options.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace backend {
+namespace object_storage {
+namespace tests {
+
+namespace {
+
+constexpr std::size_t k_part_size = 16;
+
+/**
+ * In-memory contents of the fake object storage, shared by all containers
+ * (and thus by all threads) created from the same configuration.
+ */
+struct Fake_state {
+  struct Upload {
+    std::string name;
+    std::map<std::size_t, std::string> parts;
+  };
+
+  void hold_part(std::size_t part_num) {
+    std::lock_guard lock{mutex};
+    held_parts.emplace(part_num);
+  }
+
+  void release_part(std::size_t part_num) {
+    {
+      std::lock_guard lock{mutex};
+      held_parts.erase(part_num);
+    }
+
+    cv.notify_all();
+  }
+
+  void wait_for_part(std::size_t part_num) {
+    std::unique_lock lock{mutex};
+    cv.wait(lock, [&]() { return started_parts.count(part_num) > 0; });
+  }
+
+  void hold_read(std::size_t offset) {
+    std::lock_guard lock{mutex};
+    held_reads.emplace(offset);
+  }
+
+  void release_read(std::size_t offset) {
+    {
+      std::lock_guard lock{mutex};
+      held_reads.erase(offset);
+    }
+
+    cv.notify_all();
+  }
+
+  void wait_for_read(std::size_t offset) {
+    std::unique_lock lock{mutex};
+    cv.wait(lock, [&]() { return started_reads.count(offset) > 0; });
+  }
+
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  std::map<std::string, std::string> objects;
+  std::map<std::string, Upload> uploads;
+  std::size_t next_upload_id = 0;
+
+  // uploads of these parts fail
+  std::set<std::size_t> failing_parts;
+  // uploads of these parts are blocked until they are released
+  std::set<std::size_t> held_parts;
+  std::set<std::size_t> started_parts;
+  std::vector<std::size_t> uploaded_parts;
+  std::size_t parts_in_progress = 0;
+
+  std::size_t aborted_uploads = 0;
+  std::size_t parts_in_progress_when_aborted = 0;
+
+  // reads starting at these offsets fail once
+  std::set<std::size_t> failing_reads;
+  // reads starting at these offsets are blocked until they are released
+  std::set<std::size_t> held_reads;
+  std::set<std::size_t> started_reads;
+  // offset and size of each of the completed reads
+  std::vector<std::pair<std::size_t, std::size_t>> reads;
+  std::size_t reads_in_progress = 0;
+};
+
+using Fake_state_ptr = std::shared_ptr<Fake_state>;
+
+std::string etag(const std::string &data) {
+  return std::to_string(std::hash<std::string>{}(data));
+}
+
+[[noreturn]] void not_used() {
+  throw std::logic_error("Fake_container: REST requests are not used");
+}
+
+class Fake_container : public Container {
+ public:
+  Fake_container(const Config_ptr &config, const Fake_state_ptr &state)
+      : Container(config), m_state(state) {}
+
+  using Container::get_object;
+
+  std::vector<Object_details> list_objects(
+      const std::string &prefix, size_t limit, bool,
+      const Object_details::Fields_mask &,
+      std::unordered_set<std::string> *) override {
+    std::lock_guard lock{m_state->mutex};
+    std::vector<Object_details> result;
+
+    for (const auto &object : m_state->objects) {
+      if (0 == object.first.compare(0, prefix.length(), prefix)) {
+        result.emplace_back();
+        result.back().name = object.first;
+        result.back().size = object.second.size();
+
+        if (limit && result.size() >= limit) {
+          break;
+        }
+      }
+    }
+
+    return result;
+  }
+
+  size_t head_object(const std::string &object_name) override {
+    std::lock_guard lock{m_state->mutex};
+    return object(object_name).size();
+  }
+
+  void delete_object(const std::string &object_name) override {
+    std::lock_guard lock{m_state->mutex};
+    object(object_name);
+    m_state->objects.erase(object_name);
+  }
+
+  void rename_object(const std::string &src_name,
+                     const std::string &new_name) override {
+    std::lock_guard lock{m_state->mutex};
+    auto data = std::move(object(src_name));
+    m_state->objects.erase(src_name);
+    m_state->objects[new_name] = std::move(data);
+  }
+
+  void put_object(const std::string &object_name, const char *data,
+                  size_t size) override {
+    std::lock_guard lock{m_state->mutex};
+    m_state->objects[object_name] = std::string(data, size);
+  }
+
+  size_t get_object(const std::string &object_name,
+                    rest::Base_response_buffer *buffer,
+                    const std::optional<size_t> &from_byte,
+                    const std::optional<size_t> &to_byte) override {
+    std::unique_lock lock{m_state->mutex};
+    const auto &data = object(object_name);
+    const auto first = from_byte.value_or(0);
+    const auto last = std::min(to_byte.value_or(data.size()), data.size() - 1);
+
+    ++m_state->reads_in_progress;
+    m_state->started_reads.emplace(first);
+    m_state->cv.notify_all();
+
+    m_state->cv.wait(lock,
+                     [&]() { return 0 == m_state->held_reads.count(first); });
+
+    --m_state->reads_in_progress;
+
+    if (m_state->failing_reads.erase(first)) {
+      throw rest::Response_error(
+          rest::Response::Status_code::INTERNAL_SERVER_ERROR, "Read failed");
+    }
+
+    if (first > last) {
+      return 0;
+    }
+
+    m_state->reads.emplace_back(first, last - first + 1);
+
+    return buffer->append_data(data.data() + first, last - first + 1);
+  }
+
+  std::vector<Multipart_object> list_multipart_uploads(size_t) override {
+    std::lock_guard lock{m_state->mutex};
+    std::vector<Multipart_object> result;
+
+    for (const auto &upload : m_state->uploads) {
+      result.emplace_back(Multipart_object{upload.second.name, upload.first});
+    }
+
+    return result;
+  }
+
+  std::vector<Multipart_object_part> list_multipart_uploaded_parts(
+      const Multipart_object &object, size_t) override {
+    std::lock_guard lock{m_state->mutex};
+    std::vector<Multipart_object_part> result;
+
+    // order is not guaranteed
+    for (auto it = upload(object).parts.rbegin();
+         it != upload(object).parts.rend(); ++it) {
+      result.emplace_back(Multipart_object_part{it->first, etag(it->second),
+                                                it->second.size()});
+    }
+
+    return result;
+  }
+
+  Multipart_object create_multipart_upload(
+      const std::string &object_name) override {
+    std::lock_guard lock{m_state->mutex};
+    auto id = std::to_string(++m_state->next_upload_id);
+    m_state->uploads[id].name = object_name;
+    return {object_name, std::move(id)};
+  }
+
+  Multipart_object_part upload_part(const Multipart_object &object,
+                                    size_t part_num, const char *body,
+                                    size_t size) override {
+    std::unique_lock lock{m_state->mutex};
+
+    ++m_state->parts_in_progress;
+    m_state->started_parts.emplace(part_num);
+    m_state->cv.notify_all();
+
+    m_state->cv.wait(
+        lock, [&]() { return 0 == m_state->held_parts.count(part_num); });
+
+    --m_state->parts_in_progress;
+
+    if (m_state->failing_parts.count(part_num)) {
+      throw rest::Response_error(
+          rest::Response::Status_code::INTERNAL_SERVER_ERROR,
+          "Part upload failed");
+    }
+
+    std::string data{body, size};
+    auto part = Multipart_object_part{part_num, etag(data), size};
+
+    upload(object).parts[part_num] = std::move(data);
+    m_state->uploaded_parts.emplace_back(part_num);
+
+    return part;
+  }
+
+  void commit_multipart_upload(
+      const Multipart_object &object,
+      const std::vector<Multipart_object_part> &parts) override {
+    std::lock_guard lock{m_state->mutex};
+    const auto &uploaded = upload(object).parts;
+    std::string data;
+    std::size_t expected = 0;
+
+    for (const auto &part : parts) {
+      const auto it = uploaded.find(part.part_num);
+
+      if (++expected != part.part_num || uploaded.end() == it ||
+          etag(it->second) != part.etag) {
+        throw rest::Response_error(rest::Response::Status_code::BAD_REQUEST,
+                                   "Invalid part");
+      }
+
+      data += it->second;
+    }
+
+    m_state->objects[object.name] = std::move(data);
+    m_state->uploads.erase(object.upload_id);
+  }
+
+  void abort_multipart_upload(const Multipart_object &object) override {
+    std::lock_guard lock{m_state->mutex};
+    upload(object);
+    m_state->uploads.erase(object.upload_id);
+    ++m_state->aborted_uploads;
+    m_state->parts_in_progress_when_aborted = m_state->parts_in_progress;
+  }
+
+ private:
+  std::string &object(const std::string &name) {
+    const auto it = m_state->objects.find(name);
+
+    if (m_state->objects.end() == it) {
+      throw rest::Response_error(rest::Response::Status_code::NOT_FOUND);
+    }
+
+    return it->second;
+  }
+
+  Fake_state::Upload &upload(const Multipart_object &object) {
+    const auto it = m_state->uploads.find(object.upload_id);
+
+    if (m_state->uploads.end() == it) {
+      throw rest::Response_error(rest::Response::Status_code::NOT_FOUND);
+    }
+
+    return it->second;
+  }
+
+  rest::Signed_request list_objects_request(
+      const std::string &, size_t, bool, const Object_details::Fields_mask &,
+      const std::string &) override {
+    not_used();
+  }
+
+  std::vector<Object_details> parse_list_objects(
+      const rest::Base_response_buffer &, std::string *,
+      std::unordered_set<std::string> *) override {
+    not_used();
+  }
+
+  rest::Signed_request head_object_request(const std::string &) override {
+    not_used();
+  }
+
+  rest::Signed_request delete_object_request(const std::string &) override {
+    not_used();
+  }
+
+  rest::Signed_request put_object_request(const std::string &,
+                                          rest::Headers) override {
+    not_used();
+  }
+
+  rest::Signed_request get_object_request(const std::string &,
+                                          rest::Headers) override {
+    not_used();
+  }
+
+  void execute_rename_object(rest::Signed_rest_service *, const std::string &,
+                             const std::string &) override {
+    not_used();
+  }
+
+  rest::Signed_request list_multipart_uploads_request(size_t) override {
+    not_used();
+  }
+
+  std::vector<Multipart_object> parse_list_multipart_uploads(
+      const rest::Base_response_buffer &) override {
+    not_used();
+  }
+
+  rest::Signed_request list_multipart_uploaded_parts_request(
+      const Multipart_object &, size_t) override {
+    not_used();
+  }
+
+  std::vector<Multipart_object_part> parse_list_multipart_uploaded_parts(
+      const rest::Base_response_buffer &) override {
+    not_used();
+  }
+
+  rest::Signed_request create_multipart_upload_request(const std::string &,
+                                                       std::string *) override {
+    not_used();
+  }
+
+  std::string parse_create_multipart_upload(
+      const rest::String_response &) override {
+    not_used();
+  }
+
+  rest::Signed_request upload_part_request(const Multipart_object &, size_t,
+                                           size_t) override {
+    not_used();
+  }
+
+  rest::Signed_request commit_multipart_upload_request(
+      const Multipart_object &, const std::vector<Multipart_object_part> &,
+      std::string *) override {
+    not_used();
+  }
+
+  rest::Signed_request abort_multipart_upload_request(
+      const Multipart_object &) override {
+    not_used();
+  }
+
+  Fake_state_ptr m_state;
+};
+
+class Fake_options;
+
+class Fake_config : public Config {
+ public:
+  Fake_config(const Fake_options &options, const Fake_state_ptr &state);
+
+  const std::string &hash() const override { return m_hash; }
+
+  std::unique_ptr<Container> container() const override {
+    return std::make_unique<Fake_container>(shared_ptr<Fake_config>(),
+                                            m_state);
+  }
+
+  const std::string &service_endpoint() const override { return m_hash; }
+
+  const std::string &service_label() const override { return m_hash; }
+
+  std::unique_ptr<rest::Signer> signer() const override { return {}; }
+
+ private:
+  std::string describe_self() const override { return "fake object storage"; }
+
+  std::string m_hash = "fake";
+  Fake_state_ptr m_state;
+};
+
+class Fake_options : public Object_storage_options {
+ public:
+  explicit Fake_options(const Fake_state_ptr &state) : m_state(state) {
+    m_container_name = "container";
+  }
+
+  const char *get_main_option() const override { return "fakeContainer"; }
+
+  std::vector<const char *> get_secondary_options() const override {
+    return {};
+  }
+
+ private:
+  std::shared_ptr<Config> create_config() const override {
+    return std::make_shared<Fake_config>(*this, m_state);
+  }
+
+  bool has_value(const char *) const override { return false; }
+
+  Fake_state_ptr m_state;
+};
+
+Fake_config::Fake_config(const Fake_options &options,
+                         const Fake_state_ptr &state)
+    : Config(options, k_part_size), m_state(state) {}
+
+std::string part(char c) { return std::string(k_part_size, c); }
+
+}  // namespace
+
+class Object_storage_writer_test
+    : public ::testing::TestWithParam<std::size_t> {
+ protected:
+  void SetUp() override {
+    m_state = std::make_shared<Fake_state>();
+    m_config = Fake_options{m_state}.config();
+    m_config->set_max_parts_in_flight(GetParam());
+  }
+
+  std::unique_ptr<Object> object() const {
+    return std::make_unique<Object>(m_config, "sample.txt");
+  }
+
+  /**
+   * Writes the given number of parts, each filled with a different character,
+   * followed by a partial one.
+   */
+  std::string write_parts(Object *file, std::size_t parts) const {
+    std::string expected;
+
+    for (std::size_t i = 0; i < parts; ++i) {
+      expected += part('a' + i);
+      file->write(expected.data() + i * k_part_size, k_part_size);
+    }
+
+    expected += "tail";
+    file->write("tail", 4);
+
+    return expected;
+  }
+
+  Fake_state_ptr m_state;
+  std::shared_ptr<Config> m_config;
+};
+
+TEST_P(Object_storage_writer_test, multipart_upload) {
+  const auto file = object();
+
+  file->open(Mode::WRITE);
+  const auto expected = write_parts(file.get(), 10);
+  EXPECT_EQ(expected.size(), file->file_size());
+  file->close();
+
+  EXPECT_EQ(expected, m_state->objects["sample.txt"]);
+  EXPECT_TRUE(m_state->uploads.empty());
+  EXPECT_EQ(0, m_state->aborted_uploads);
+  EXPECT_EQ(11, m_state->uploaded_parts.size());
+}
+
+TEST_P(Object_storage_writer_test, failed_part) {
+  m_state->failing_parts.emplace(2);
+
+  const auto file = object();
+
+  file->open(Mode::WRITE);
+
+  // when parts are uploaded in the background, error is reported by one of
+  // the subsequent calls
+  EXPECT_THROW(
+      {
+        write_parts(file.get(), 10);
+        file->close();
+      },
+      std::exception);
+
+  // upload is cancelled, nothing is committed
+  EXPECT_TRUE(m_state->objects.empty());
+  EXPECT_TRUE(m_state->uploads.empty());
+  EXPECT_EQ(1, m_state->aborted_uploads);
+  EXPECT_EQ(0, m_state->parts_in_progress_when_aborted);
+
+  // subsequent parts are not uploaded
+  EXPECT_GE(1 + GetParam(), m_state->uploaded_parts.size());
+
+  EXPECT_NO_THROW(file->close());
+}
+
+TEST_P(Object_storage_writer_test, failed_last_part) {
+  const auto file = object();
+
+  file->open(Mode::WRITE);
+  write_parts(file.get(), 3);
+
+  // last part is uploaded when file is closed
+  m_state->failing_parts.emplace(4);
+
+  EXPECT_THROW(file->close(), std::exception);
+
+  EXPECT_TRUE(m_state->objects.empty());
+  EXPECT_TRUE(m_state->uploads.empty());
+  EXPECT_EQ(1, m_state->aborted_uploads);
+}
+
+TEST_P(Object_storage_writer_test, cancel) {
+  auto file = object();
+
+  file->open(Mode::WRITE);
+  write_parts(file.get(), 1);
+
+  if (GetParam()) {
+    // second part is uploaded in the background, but it's not finished
+    m_state->hold_part(2);
+    file->write(part('x').data(), k_part_size);
+    m_state->wait_for_part(2);
+
+    std::thread release{[this]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      m_state->release_part(2);
+    }};
+
+    // file is not closed, upload is cancelled once the in-flight part is
+    // finished
+    file.reset();
+
+    release.join();
+  } else {
+    file->write(part('x').data(), k_part_size);
+    file.reset();
+  }
+
+  EXPECT_TRUE(m_state->objects.empty());
+  EXPECT_TRUE(m_state->uploads.empty());
+  EXPECT_EQ(1, m_state->aborted_uploads);
+  EXPECT_EQ(0, m_state->parts_in_progress_when_aborted);
+}
+
+TEST_P(Object_storage_writer_test, resume_out_of_order_upload) {
+  // upload was interrupted, parts completed out of order
+  auto &upload = m_state->uploads["1"];
+  upload.name = "sample.txt";
+  upload.parts[1] = part('a');
+  upload.parts[2] = part('b');
+  upload.parts[4] = part('x');
+  m_state->next_upload_id = 1;
+
+  const auto file = object();
+
+  file->open(Mode::APPEND);
+
+  // only the contiguous parts are kept, part 4 is uploaded again
+  EXPECT_EQ(2 * k_part_size, file->file_size());
+
+  std::string expected = part('a') + part('b');
+
+  for (const auto c : {'c', 'd', 'e'}) {
+    expected += part(c);
+    file->write(expected.data() + expected.size() - k_part_size, k_part_size);
+  }
+
+  file->close();
+
+  EXPECT_EQ(expected, m_state->objects["sample.txt"]);
+  EXPECT_TRUE(m_state->uploads.empty());
+  EXPECT_EQ(0, m_state->aborted_uploads);
+}
+
+TEST_P(Object_storage_writer_test, resume_upload) {
+  auto &upload = m_state->uploads["1"];
+  upload.name = "sample.txt";
+  upload.parts[1] = part('a');
+  upload.parts[2] = part('b');
+  m_state->next_upload_id = 1;
+
+  const auto file = object();
+
+  file->open(Mode::APPEND);
+  EXPECT_EQ(2 * k_part_size, file->file_size());
+
+  file->write(part('c').data(), k_part_size);
+  file->write("tail", 4);
+  file->close();
+
+  EXPECT_EQ(part('a') + part('b') + part('c') + "tail",
+            m_state->objects["sample.txt"]);
+  EXPECT_TRUE(m_state->uploads.empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(Object_storage, Object_storage_writer_test,
+                         ::testing::Values(0, 2),
+                         [](const auto &info) {
+                           return 0 == info.param
+                                      ? std::string{"synchronous"}
+                                      : "parts_in_flight_" +
+                                            std::to_string(info.param);
+                         });
+
+class Object_storage_reader_test : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    m_state = std::make_shared<Fake_state>();
+    m_config = Fake_options{m_state}.config();
+    m_config->set_read_ahead_block_size(7);
+    m_config->set_max_reads_in_flight(3);
+
+    for (int i = 0; i < 10; ++i) {
+      m_data += "0123456789ABCDE";
+    }
+
+    m_state->objects["sample.txt"] = m_data;
+  }
+
+  std::unique_ptr<Object> object() const {
+    return std::make_unique<Object>(m_config, "sample.txt");
+  }
+
+  /**
+   * Reads the file sequentially, in small chunks, until its end.
+   */
+  static std::string read(Object *file) {
+    std::string buffer;
+    char chunk[5];
+    ssize_t read = 0;
+
+    while ((read = file->read(chunk, sizeof(chunk))) > 0) {
+      buffer.append(chunk, read);
+    }
+
+    return buffer;
+  }
+
+  std::vector<std::pair<std::size_t, std::size_t>> sorted_reads() const {
+    auto reads = m_state->reads;
+    std::sort(reads.begin(), reads.end());
+    return reads;
+  }
+
+  Fake_state_ptr m_state;
+  std::shared_ptr<Config> m_config;
+  std::string m_data;
+};
+
+TEST_F(Object_storage_reader_test, read_ahead) {
+  const auto file = object();
+
+  file->open(Mode::READ);
+  EXPECT_EQ(m_data, read(file.get()));
+  file->close();
+
+  // first read is synchronous, once reads are known to be sequential, the
+  // remaining data is fetched in blocks
+  const auto reads = sorted_reads();
+  ASSERT_EQ(1 + (m_data.size() - 5 + 6) / 7, reads.size());
+  EXPECT_EQ(std::make_pair(std::size_t{0}, std::size_t{5}), reads[0]);
+
+  for (std::size_t i = 1; i < reads.size(); ++i) {
+    EXPECT_EQ(5 + (i - 1) * 7, reads[i].first);
+    EXPECT_EQ(std::min<std::size_t>(7, m_data.size() - reads[i].first),
+              reads[i].second);
+  }
+}
+
+TEST_F(Object_storage_reader_test, read_ahead_disabled) {
+  m_config->set_max_reads_in_flight(0);
+
+  const auto file = object();
+
+  file->open(Mode::READ);
+  EXPECT_EQ(m_data, read(file.get()));
+  file->close();
+
+  // each read is synchronous
+  const auto reads = sorted_reads();
+  ASSERT_EQ(m_data.size() / 5, reads.size());
+
+  for (std::size_t i = 0; i < reads.size(); ++i) {
+    EXPECT_EQ(std::make_pair(i * 5, std::size_t{5}), reads[i]);
+  }
+}
+
+TEST_F(Object_storage_reader_test, error_while_prefetching) {
+  // one of the blocks fails to be fetched
+  m_state->failing_reads.emplace(19);
+
+  const auto file = object();
+  std::string buffer;
+  char chunk[5];
+  ssize_t read = 0;
+
+  file->open(Mode::READ);
+
+  EXPECT_THROW(
+      {
+        while ((read = file->read(chunk, sizeof(chunk))) > 0) {
+          buffer.append(chunk, read);
+        }
+      },
+      std::exception);
+
+  // data preceding the failed block was read
+  EXPECT_GT(19, buffer.size());
+  EXPECT_EQ(m_data.substr(0, buffer.size()), buffer);
+
+  // read can be retried, file is read from where it has failed
+  buffer += this->read(file.get());
+  EXPECT_EQ(m_data, buffer);
+
+  file->close();
+
+  EXPECT_EQ(0, m_state->reads_in_progress);
+}
+
+TEST_F(Object_storage_reader_test, seek_while_prefetching) {
+  m_state->hold_read(26);
+
+  const auto file = object();
+  std::string buffer;
+  char chunk[5];
+
+  file->open(Mode::READ);
+
+  // read-ahead starts and requests the held block
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(5, file->read(chunk, sizeof(chunk)));
+    buffer.append(chunk, 5);
+  }
+
+  EXPECT_EQ(m_data.substr(0, 20), buffer);
+
+  m_state->wait_for_read(26);
+
+  // random access, prefetched blocks are discarded, the held block is still
+  // being fetched
+  EXPECT_EQ(100, file->seek(100));
+  EXPECT_EQ(m_data.substr(100), read(file.get()));
+
+  m_state->release_read(26);
+
+  // going back, previously fetched data is not reused
+  EXPECT_EQ(20, file->seek(20));
+  EXPECT_EQ(m_data.substr(20), read(file.get()));
+
+  file->close();
+
+  EXPECT_EQ(0, m_state->reads_in_progress);
+}
+
+TEST_F(Object_storage_reader_test, close_while_prefetching) {
+  m_state->hold_read(26);
+
+  const auto file = object();
+  char chunk[5];
+
+  file->open(Mode::READ);
+
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(5, file->read(chunk, sizeof(chunk)));
+  }
+
+  m_state->wait_for_read(26);
+
+  std::thread release{[this]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    m_state->release_read(26);
+  }};
+
+  // file is closed while one of the blocks is still being fetched, close waits
+  // for it to finish
+  file->close();
+
+  EXPECT_EQ(0, m_state->reads_in_progress);
+
+  release.join();
+
+  // file can be read again
+  file->open(Mode::READ);
+  EXPECT_EQ(m_data, read(file.get()));
+  file->close();
+}
+
+}  // namespace tests
+}  // namespace object_storage
+}  // namespace backend
+}  // namespace storage
+}  // namespace mysqlshdk
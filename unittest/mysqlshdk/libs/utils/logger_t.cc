@@ -22,10 +22,13 @@
    51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA */
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/mocks/gmock_clean.h"
@@ -77,6 +80,8 @@ class Logger_test : public ::testing::Test {
 
   static bool get_log_file_contents(const char *filename,
                                     std::string *contents) {
+    // entries are written asynchronously
+    current_logger()->flush();
     return shcore::load_text_file(get_log_file(filename), *contents, false);
   }
 
@@ -254,6 +259,128 @@ TEST_F(Logger_test, log_format) {
   EXPECT_TRUE(tests.empty());
 }
 
+TEST_F(Logger_test, concurrent_logging) {
+  const auto name = get_log_file("mylog.txt");
+  shcore::on_leave_scope scope_leave([&name]() {
+    if (!shcore::is_folder(name)) {
+      shcore::delete_file(name);
+    }
+  });
+
+  mysqlsh::Scoped_logger logger(
+      Logger::create_instance(name.c_str(), false, Logger::LOG_DEBUG3));
+
+  constexpr int k_threads = 8;
+  constexpr int k_entries = 5000;
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < k_threads; ++t) {
+    threads.emplace_back(mysqlsh::spawn_scoped_thread([t]() {
+      for (int i = 0; i < k_entries; ++i) {
+        log_debug3("thread %d entry %d", t, i);
+      }
+    }));
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  // entry which does not fit in the buffer is written after the buffered ones
+  const std::string large(1024 * 1024, 'x');
+  log_debug("last %s", large.c_str());
+
+  std::string contents;
+  EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+
+  std::vector<int> next(k_threads, 0);
+  std::size_t lines = 0;
+
+  for (const auto &line : shcore::str_split(contents, "\n")) {
+    if (line.empty()) {
+      continue;
+    }
+
+    ++lines;
+
+    int t = -1;
+    int i = -1;
+
+    if (2 == sscanf(line.c_str() + 19, ": Debug3: thread %d entry %d", &t,
+                    &i)) {
+      ASSERT_LE(0, t);
+      ASSERT_GT(k_threads, t);
+      // entries of a single thread are written in order
+      EXPECT_EQ(next[t], i);
+      next[t] = i + 1;
+    } else {
+      EXPECT_EQ(k_threads * k_entries + 1, lines);
+      EXPECT_EQ(": Debug: last " + large, line.substr(19));
+    }
+  }
+
+  EXPECT_EQ(k_threads * k_entries + 1, lines);
+
+  for (int t = 0; t < k_threads; ++t) {
+    EXPECT_EQ(k_entries, next[t]);
+  }
+}
+
+TEST_F(Logger_test, sequential_logging) {
+  const auto name = get_log_file("mylog.txt");
+  shcore::on_leave_scope scope_leave([&name]() {
+    if (!shcore::is_folder(name)) {
+      shcore::delete_file(name);
+    }
+  });
+
+  mysqlsh::Scoped_logger logger(
+      Logger::create_instance(name.c_str(), false, Logger::LOG_DEBUG3));
+
+  constexpr int k_threads = 4;
+  constexpr int k_entries = 20000;
+  // some of the entries do not fit in the buffer and are written synchronously
+  const std::string large(100 * 1024, 'x');
+  std::atomic<int> turn{0};
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < k_threads; ++t) {
+    threads.emplace_back(mysqlsh::spawn_scoped_thread([&, t]() {
+      for (int i = t; i < k_entries; i += k_threads) {
+        while (turn.load() != i) {
+          std::this_thread::yield();
+        }
+
+        log_debug3("entry %d %s", i, 0 == i % 1000 ? large.c_str() : "");
+        turn.store(i + 1);
+      }
+    }));
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  std::string contents;
+  EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+
+  int next = 0;
+
+  for (const auto &line : shcore::str_split(contents, "\n")) {
+    if (line.empty()) {
+      continue;
+    }
+
+    int i = -1;
+    ASSERT_EQ(1, sscanf(line.c_str() + 19, ": Debug3: entry %d", &i));
+    // entries which were logged one after another are written in that order
+    ASSERT_EQ(next, i);
+    ++next;
+  }
+
+  EXPECT_EQ(k_entries, next);
+}
+
 #ifndef _WIN32
 // on Windows Logger is using OutputDebugString() instead of stderr
 
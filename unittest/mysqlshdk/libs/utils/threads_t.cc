@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/threads.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace utils {
+
+TEST(Threads, parallel_for) {
+  {
+    // nothing to do
+    parallel_for(0, 4, [](std::size_t) { FAIL(); });
+  }
+
+  {
+    constexpr std::size_t k_items = 100;
+    std::vector<std::size_t> results(k_items);
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+
+    parallel_for(k_items, 4, [&](std::size_t i) {
+      const auto current = ++running;
+      auto max = max_running.load();
+
+      while (current > max &&
+             !max_running.compare_exchange_weak(max, current)) {
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      results[i] = i * i;
+      --running;
+    });
+
+    for (std::size_t i = 0; i < k_items; ++i) {
+      EXPECT_EQ(i * i, results[i]);
+    }
+
+    EXPECT_LE(max_running, 4);
+    EXPECT_GE(max_running, 1);
+  }
+
+  {
+    // number of threads is at least one
+    std::vector<int> results(3);
+    parallel_for(results.size(), 0, [&](std::size_t i) { results[i] = 1; });
+    EXPECT_EQ(std::vector<int>({1, 1, 1}), results);
+  }
+
+  {
+    // exception thrown by the item with the lowest index is rethrown, even
+    // if other items have failed earlier
+    std::atomic<int> started{0};
+
+    EXPECT_THROW_MSG(
+        parallel_for(8, 8,
+                     [&started](std::size_t i) {
+                       ++started;
+
+                       while (started < 8) {
+                         std::this_thread::yield();
+                       }
+
+                       if (i >= 2) {
+                         std::this_thread::sleep_for(
+                             std::chrono::milliseconds(10 * (8 - i)));
+                         throw std::runtime_error("error " + std::to_string(i));
+                       }
+                     }),
+        std::runtime_error, "error 2");
+  }
+}
+
+}  // namespace utils
+}  // namespace mysqlshdk
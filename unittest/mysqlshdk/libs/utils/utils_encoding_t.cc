@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <random>
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/utils/utils_encoding.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace shcore {
+
+namespace {
+
+std::string random_data(std::size_t length) {
+  static std::mt19937 gen{2024};
+  std::uniform_int_distribution<int> dist{0, 255};
+  std::string result(length, '\0');
+
+  for (auto &c : result) {
+    c = static_cast<char>(dist(gen));
+  }
+
+  return result;
+}
+
+std::string base64(const std::string &data) {
+  // guard bytes check that nothing is written past the end
+  std::string result(base64_encoded_length(data.size()) + 4, '#');
+  const auto length = encode_base64(data.data(), data.size(), result.data());
+
+  EXPECT_EQ(base64_encoded_length(data.size()), length);
+  EXPECT_EQ("####", result.substr(length));
+
+  result.resize(length);
+  return result;
+}
+
+std::string hex(const std::string &data) {
+  std::string result(2 * data.size() + 4, '#');
+  const auto length = encode_hex(data.data(), data.size(), result.data());
+
+  EXPECT_EQ(2 * data.size(), length);
+  EXPECT_EQ("####", result.substr(length));
+
+  result.resize(length);
+  return result;
+}
+
+}  // namespace
+
+TEST(utils_encoding, encode_base64) {
+  EXPECT_EQ("", base64(""));
+  EXPECT_EQ("Zg==", base64("f"));
+  EXPECT_EQ("Zm8=", base64("fo"));
+  EXPECT_EQ("Zm9v", base64("foo"));
+  EXPECT_EQ("Zm9vYg==", base64("foob"));
+  EXPECT_EQ("Zm9vYmE=", base64("fooba"));
+  EXPECT_EQ("Zm9vYmFy", base64("foobar"));
+
+  // lengths handled by the vectorized and the scalar code
+  for (std::size_t length = 0; length < 300; ++length) {
+    SCOPED_TRACE(length);
+
+    const auto data = random_data(length);
+    std::string expected;
+
+    ASSERT_TRUE(encode_base64(reinterpret_cast<const unsigned char *>(
+                                  data.data()),
+                              static_cast<int>(data.size()), &expected));
+    EXPECT_EQ(expected, base64(data));
+  }
+
+  // all possible 6-bit values
+  std::string data;
+
+  for (int i = 0; i < 256; ++i) {
+    data += static_cast<char>(i);
+  }
+
+  std::string expected;
+  ASSERT_TRUE(encode_base64(
+      reinterpret_cast<const unsigned char *>(data.data()),
+      static_cast<int>(data.size()), &expected));
+
+  for (std::size_t offset = 0; offset < 3; ++offset) {
+    SCOPED_TRACE(offset);
+
+    std::string shifted;
+    ASSERT_TRUE(encode_base64(
+        reinterpret_cast<const unsigned char *>(data.data() + offset),
+        static_cast<int>(data.size() - offset), &shifted));
+    EXPECT_EQ(shifted, base64(data.substr(offset)));
+  }
+
+  EXPECT_EQ(expected, base64(data));
+}
+
+TEST(utils_encoding, encode_hex) {
+  EXPECT_EQ("", hex(""));
+  EXPECT_EQ("00FF7F80", hex(std::string("\x00\xFF\x7F\x80", 4)));
+  EXPECT_EQ("48656C6C6F", hex("Hello"));
+
+  for (std::size_t length = 0; length < 300; ++length) {
+    SCOPED_TRACE(length);
+
+    const auto data = random_data(length);
+
+    EXPECT_EQ(string_to_hex(data).substr(2), hex(data));
+  }
+
+  std::string data;
+
+  for (int i = 0; i < 256; ++i) {
+    data += static_cast<char>(i);
+  }
+
+  EXPECT_EQ(string_to_hex(data).substr(2), hex(data));
+}
+
+}  // namespace shcore
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+TEST(Work_stealing_queue, priorities) {
+  Work_stealing_queue<std::string> queue;
+
+  queue.push("medium 1");
+  queue.push("low", Queue_priority::LOW);
+  queue.push("high", Queue_priority::HIGH);
+  queue.push("medium 2", Queue_priority::MEDIUM);
+  queue.shutdown(1);
+
+  EXPECT_EQ(5, queue.size());
+
+  EXPECT_EQ("high", queue.pop());
+  EXPECT_EQ("medium 1", queue.pop());
+  EXPECT_EQ("medium 2", queue.pop());
+  EXPECT_EQ("low", queue.pop());
+  EXPECT_EQ("", queue.pop());
+
+  EXPECT_EQ(0, queue.size());
+  EXPECT_FALSE(queue.try_pop(std::chrono::milliseconds(1)));
+
+  // items pushed by a consumer go to its local queue
+  queue.push("local");
+  queue.push("local high", Queue_priority::HIGH);
+
+  EXPECT_EQ("local high", queue.pop());
+  EXPECT_EQ("local", queue.try_pop(std::chrono::milliseconds(1)).value());
+}
+
+TEST(Work_stealing_queue, workers) {
+  constexpr int k_threads = 8;
+  constexpr int k_tasks = 10000;
+  constexpr int k_subtasks = 3;
+
+  Work_stealing_queue<int> queue;
+  std::atomic<int> remaining{k_tasks * (k_subtasks + 1)};
+  std::vector<std::vector<int>> processed(k_threads);
+  std::vector<std::thread> workers;
+
+  for (int t = 0; t < k_threads; ++t) {
+    workers.emplace_back([&, t]() {
+      while (true) {
+        const auto task = queue.pop();
+
+        if (0 == task) {
+          break;
+        }
+
+        processed[t].emplace_back(task);
+
+        if (task > 0) {
+          // subtasks are pushed from the worker, to be stolen by the others
+          for (int i = 1; i <= k_subtasks; ++i) {
+            queue.push(-(task * k_subtasks + i), Queue_priority::HIGH);
+          }
+        }
+
+        if (0 == --remaining) {
+          queue.shutdown(k_threads);
+        }
+      }
+    });
+  }
+
+  for (int i = 1; i <= k_tasks; ++i) {
+    queue.push(i);
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  std::set<int> all;
+  std::size_t count = 0;
+
+  for (const auto &p : processed) {
+    all.insert(p.begin(), p.end());
+    count += p.size();
+  }
+
+  // each task was processed exactly once
+  EXPECT_EQ(k_tasks * (k_subtasks + 1), count);
+  EXPECT_EQ(count, all.size());
+  EXPECT_EQ(0, queue.size());
+}
+
+TEST(Work_stealing_queue, local_queues_are_reused) {
+  {
+    Work_stealing_queue<int> queue;
+
+    queue.push(0);
+    EXPECT_EQ(0, queue.pop());
+    EXPECT_EQ(1, queue.local_queues());
+
+    // more threads than the maximum number of local queues, one at a time
+    for (int i = 1; i <= 300; ++i) {
+      std::thread consumer{[&queue, i]() {
+        queue.push(i);
+        EXPECT_EQ(i, queue.pop());
+        // item is left in the local queue of a thread which exits
+        queue.push(-i);
+      }};
+      consumer.join();
+
+      EXPECT_EQ(2, queue.local_queues());
+      EXPECT_EQ(-i, queue.pop());
+    }
+
+    EXPECT_EQ(0, queue.size());
+  }
+
+  // registration of a queue which no longer exists is not used
+  Work_stealing_queue<int> queue;
+
+  queue.push(1);
+  EXPECT_EQ(1, queue.pop());
+  EXPECT_EQ(1, queue.local_queues());
+}
+
+}  // namespace shcore
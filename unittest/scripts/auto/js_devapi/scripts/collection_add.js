@@ -139,6 +139,32 @@ var result = collection.add({ "_id": "1E9C92FDA74ED311944E00059A3C7A49", "name":
 EXPECT_EQ(2, result.affectedItemCount);
 EXPECT_EQ(2, result.affectedItemsCount);
 
+//@<> Collection.add execution, Placeholders {VER(>=8.0.11)}
+var crud = collection.add({ name: mysqlx.expr(':name'), passed: 'bound', count: mysqlx.expr(':count') });
+EXPECT_ARRAY_NOT_CONTAINS('bind', dir(collection.add({ name: 'unbound' })));
+EXPECT_ARRAY_CONTAINS('bind', dir(crud));
+EXPECT_THROWS(function () { crud.execute(); }, "CollectionAdd.execute: Missing value bindings for the following placeholders: name, count");
+
+// second and further executions use a prepared statement
+for (var i = 0; i < 3; ++i) {
+  var result = crud.bind('name', 'bound' + i).bind('count', i).execute();
+  EXPECT_EQ(1, result.affectedItemsCount);
+}
+
+var records = collection.find('passed = "bound"').sort('count').execute().fetchAll();
+EXPECT_EQ(3, records.length);
+
+for (var i = 0; i < 3; ++i) {
+  EXPECT_EQ('bound' + i, records[i].name);
+  EXPECT_EQ(i, records[i].count);
+}
+
+// adding a document changes the statement
+crud.add({ name: 'unbound', passed: 'bound', count: 3 });
+var result = crud.bind('name', 'bound4').bind('count', 4).execute();
+EXPECT_EQ(2, result.affectedItemsCount);
+EXPECT_EQ(5, collection.find('passed = "bound"').execute().fetchAll().length);
+
 // Cleanup
 mySession.dropSchema('js_shell_test');
 mySession.close();
@@ -17,6 +17,12 @@ crud.help('add');
 //@ Help on add, \? [USE:Help on add]
 \? CollectionAdd.add
 
+//@ Help on bind
+crud.help('bind');
+
+//@ Help on bind, \? [USE:Help on bind]
+\? CollectionAdd.bind
+
 //@ Help on execute
 crud.help('execute');
 
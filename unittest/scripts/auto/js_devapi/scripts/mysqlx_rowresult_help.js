@@ -63,6 +63,18 @@ result.help('fetchAll');
 //@ Help on fetchAll, \? [USE:Help on fetchAll]
 \? RowResult.fetchAll
 
+//@ Help on fetchBatch
+result.help('fetchBatch');
+
+//@ Help on fetchBatch, \? [USE:Help on fetchBatch]
+\? RowResult.fetchBatch
+
+//@ Help on fetchColumns
+result.help('fetchColumns');
+
+//@ Help on fetchColumns, \? [USE:Help on fetchColumns]
+\? RowResult.fetchColumns
+
 //@ Help on fetchOne
 result.help('fetchOne');
 
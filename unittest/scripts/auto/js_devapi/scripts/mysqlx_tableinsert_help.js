@@ -10,6 +10,12 @@ crud.help();
 //@ TableInsert help, \? [USE:TableInsert help]
 \? TableInsert
 
+//@ Help on bind
+crud.help('bind');
+
+//@ Help on bind, \? [USE:Help on bind]
+\? TableInsert.bind
+
 //@ Help on execute
 crud.help('execute');
 
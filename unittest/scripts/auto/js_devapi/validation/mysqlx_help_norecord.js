@@ -682,6 +682,14 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetchBatch(size)
+            Returns a list of ColumnBuffer objects holding the values of up to
+            size unread rows, one for each of the columns of the result.
+
+      fetchColumns()
+            Returns a list of ColumnBuffer objects holding the values of every
+            unread row, one for each of the columns of the result.
+
       fetchOne()
             Retrieves the next Row on the RowResult.
 
@@ -862,6 +870,10 @@ FUNCTIONS
       dropSchema(name)
             Drops the schema with the specified name.
 
+      executeBatch(statements)
+            Executes the given statements using a single round trip to the
+            server.
+
       getCurrentSchema()
             Retrieves the active schema on the session.
 
@@ -42,6 +42,14 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetchBatch(size)
+            Returns a list of ColumnBuffer objects holding the values of up to
+            size unread rows, one for each of the columns of the result.
+
+      fetchColumns()
+            Returns a list of ColumnBuffer objects holding the values of every
+            unread row, one for each of the columns of the result.
+
       fetchOne()
             Retrieves the next Row on the RowResult.
 
@@ -150,6 +158,43 @@ SYNTAX
 RETURNS
       A List of DbDoc objects.
 
+//@<OUT> Help on fetchBatch
+NAME
+      fetchBatch - Returns a list of ColumnBuffer objects holding the values of
+                   up to size unread rows, one for each of the columns of the
+                   result.
+
+SYNTAX
+      <RowResult>.fetchBatch(size)
+
+WHERE
+      size: The maximum number of rows to be fetched.
+
+RETURNS
+      A List of ColumnBuffer objects or null if there are no more rows.
+
+DESCRIPTION
+      This function can be used to process a big result in fixed size chunks,
+      see fetchColumns() for more details.
+
+//@<OUT> Help on fetchColumns
+NAME
+      fetchColumns - Returns a list of ColumnBuffer objects holding the values
+                     of every unread row, one for each of the columns of the
+                     result.
+
+SYNTAX
+      <RowResult>.fetchColumns()
+
+RETURNS
+      A List of ColumnBuffer objects.
+
+DESCRIPTION
+      The values are decoded directly into a buffer per column, without creating
+      a Row object for each of the records, which is considerably faster for big
+      results. In Python, the buffers can be accessed without copying them using
+      memoryview().
+
 //@<OUT> Help on fetchOne
 NAME
       fetchOne - Retrieves the next Row on the RowResult.
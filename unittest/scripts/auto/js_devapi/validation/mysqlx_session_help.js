@@ -45,6 +45,10 @@ FUNCTIONS
       dropSchema(name)
             Drops the schema with the specified name.
 
+      executeBatch(statements)
+            Executes the given statements using a single round trip to the
+            server.
+
       getCurrentSchema()
             Retrieves the active schema on the session.
 
@@ -53,6 +53,14 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetchBatch(size)
+            Returns a list of ColumnBuffer objects holding the values of up to
+            size unread rows, one for each of the columns of the result.
+
+      fetchColumns()
+            Returns a list of ColumnBuffer objects holding the values of every
+            unread row, one for each of the columns of the result.
+
       fetchOne()
             Retrieves the next Row on the RowResult.
 
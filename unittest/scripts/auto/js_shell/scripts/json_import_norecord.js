@@ -534,6 +534,34 @@ EXPECT_STDOUT_CONTAINS(
     '" to collection `wl10606`.`2MB_less________` in MySQL Server at');
 EXPECT_STDOUT_CONTAINS("Total successfully imported documents 1 ");
 
+//@<> Import documents using multiple threads
+for (const file of ['sample.json', 'sample_pretty.json']) {
+  const name = file.split('.')[0];
+  util.importJson(__import_data_path + '/' + file, {
+    schema : target_schema,
+    collection: name + "_serial"
+  });
+  util.importJson(__import_data_path + '/' + file, {
+    schema : target_schema,
+    collection: name + "_threads",
+    threads: 4
+  });
+  EXPECT_EQ(
+    session.runSql("SELECT COUNT(*) FROM !.!", [target_schema, name + "_serial"]).fetchOne()[0],
+    session.runSql("SELECT COUNT(*) FROM !.!", [target_schema, name + "_threads"]).fetchOne()[0]);
+  EXPECT_EQ(
+    session.runSql("SELECT COUNT(*) FROM !.! JOIN !.! USING (_id)", [target_schema, name + "_serial", target_schema, name + "_threads"]).fetchOne()[0],
+    session.runSql("SELECT COUNT(*) FROM !.!", [target_schema, name + "_threads"]).fetchOne()[0]);
+}
+
+EXPECT_THROWS(function() {
+  util.importJson(__import_data_path + '/sample.json', {
+    schema : target_schema,
+    collection: "sample_threads",
+    threads: 0
+  });
+}, "The value of 'threads' option must be greater than 0.");
+
 //@<> Import document using invalid options
 EXPECT_THROWS(function() {
   util.importJson(__import_data_path + '/2MB_doc.json', {
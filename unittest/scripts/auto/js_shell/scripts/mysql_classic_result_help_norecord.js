@@ -80,6 +80,18 @@ result.help('fetchAll')
 //@ Help on fetchAll, \? [USE:Help on fetchAll]
 \? classicresult.fetchAll
 
+//@ Help on fetchBatch
+result.help('fetchBatch')
+
+//@ Help on fetchBatch, \? [USE:Help on fetchBatch]
+\? classicresult.fetchBatch
+
+//@ Help on fetchColumns
+result.help('fetchColumns')
+
+//@ Help on fetchColumns, \? [USE:Help on fetchColumns]
+\? classicresult.fetchColumns
+
 //@ Help on fetchOne
 result.help('fetchOne')
 
@@ -69,6 +69,16 @@ The following operations are available at 'util':
       Performs series of tests on specified MySQL server to check if the
       upgrade process will succeed.
 
+   copy-instance
+      Copies a source instance to the target instance.
+
+   copy-schemas
+      Copies schemas from the source instance to the target instance.
+
+   copy-tables
+      Copies tables and views from schema in the source instance to the target
+      instance.
+
    dump-instance
       Dumps the whole database to files in the output directory.
 
@@ -202,6 +212,12 @@ OPTIONS
 --configPath=<str>
             Full path to MySQL server configuration file.
 
+--threads=<uint>
+            Number of threads and sessions used to execute the checks
+            (default=1). If greater than 1, the checks and the 'CHECK TABLE x
+            FOR UPGRADE' commands are executed in parallel, output is printed
+            once all of them finish.
+
 //@<OUT> CLI util dump-instance --help
 NAME
       dump-instance - Dumps the whole database to files in the output
@@ -224,7 +240,7 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "zstd".
+            "gzip", "lz4", "zstd". Default: "zstd".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -270,6 +286,11 @@ OPTIONS
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--compressionThreads=<uint>
+            Use N threads to compress the data dump files, shared by all dump
+            threads. If set to 0, data is compressed by the dump threads. Can
+            only be used with "zstd" or "gzip" compression. Default: 0.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -455,7 +476,7 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "zstd".
+            "gzip", "lz4", "zstd". Default: "zstd".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -501,6 +522,11 @@ OPTIONS
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--compressionThreads=<uint>
+            Use N threads to compress the data dump files, shared by all dump
+            threads. If set to 0, data is compressed by the dump threads. Can
+            only be used with "zstd" or "gzip" compression. Default: 0.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -667,7 +693,7 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "zstd".
+            "gzip", "lz4", "zstd". Default: "zstd".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -713,6 +739,11 @@ OPTIONS
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--compressionThreads=<uint>
+            Use N threads to compress the data dump files, shared by all dump
+            threads. If set to 0, data is compressed by the dump threads. Can
+            only be used with "zstd" or "gzip" compression. Default: 0.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -848,7 +879,7 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Default: "none".
+            "gzip", "lz4", "zstd". Default: "none".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -369,8 +369,9 @@ FUNCTIONS
             Loads the specified JavaScript module.
 
 CLASSES
- - Column Represents the metadata for a column in a result.
- - Row    Represents the a Row in a Result.
+ - Column       Represents the metadata for a column in a result.
+ - ColumnBuffer Holds the values of a column of a result.
+ - Row          Represents the a Row in a Result.
 
 MODULES
  - mysql Encloses the functions and classes available to interact with a MySQL
@@ -56,6 +56,16 @@ FUNCTIONS
             Returns a list of Row objects which contains an element for every
             record left on the result.
 
+      fetchBatch(size)
+            Returns a list of ColumnBuffer objects holding the values of up to
+            size records left on the result, one for each of the columns of the
+            result.
+
+      fetchColumns()
+            Returns a list of ColumnBuffer objects holding the values of every
+            record left on the result, one for each of the columns of the
+            result.
+
       fetchOne()
             Retrieves the next Row on the ClassicResult.
 
@@ -227,6 +237,43 @@ DESCRIPTION
       If fetchOne is called before this function, when this function is called
       it will return a Row for each of the remaining records on the resultset.
 
+//@<OUT> Help on fetchBatch
+NAME
+      fetchBatch - Returns a list of ColumnBuffer objects holding the values of
+                   up to size records left on the result, one for each of the
+                   columns of the result.
+
+SYNTAX
+      <ClassicResult>.fetchBatch(size)
+
+WHERE
+      size: The maximum number of records to be fetched.
+
+RETURNS
+      A List of ColumnBuffer objects or null if there are no more records.
+
+DESCRIPTION
+      This function can be used to process a big result in fixed size chunks,
+      see fetchColumns() for more details.
+
+//@<OUT> Help on fetchColumns
+NAME
+      fetchColumns - Returns a list of ColumnBuffer objects holding the values
+                     of every record left on the result, one for each of the
+                     columns of the result.
+
+SYNTAX
+      <ClassicResult>.fetchColumns()
+
+RETURNS
+      A List of ColumnBuffer objects.
+
+DESCRIPTION
+      The values are decoded directly into a buffer per column, without creating
+      a Row object for each of the records, which is considerably faster for big
+      results. In Python, the buffers can be accessed without copying them using
+      memoryview().
+
 //@<OUT> Help on fetchOne
 NAME
       fetchOne - Retrieves the next Row on the ClassicResult.
@@ -22,6 +22,15 @@ colladd.help('add')
 #@ global help for add[USE:colladd.add]
 \help CollectionAdd.add
 
+#@ colladd.bind
+colladd.help('bind')
+
+#@ global ? for bind[USE:colladd.bind]
+\? CollectionAdd.bind
+
+#@ global help for bind[USE:colladd.bind]
+\help CollectionAdd.bind
+
 #@ colladd.execute
 colladd.help('execute')
 
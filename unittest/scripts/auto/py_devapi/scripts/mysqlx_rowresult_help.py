@@ -65,6 +65,24 @@ rowresult.help('fetch_all')
 #@ global help for fetch_all[USE:rowresult.fetch_all]
 \help RowResult.fetch_all
 
+#@ rowresult.fetch_batch
+rowresult.help('fetch_batch')
+
+#@ global ? for fetch_batch[USE:rowresult.fetch_batch]
+\? RowResult.fetch_batch
+
+#@ global help for fetch_batch[USE:rowresult.fetch_batch]
+\help RowResult.fetch_batch
+
+#@ rowresult.fetch_columns
+rowresult.help('fetch_columns')
+
+#@ global ? for fetch_columns[USE:rowresult.fetch_columns]
+\? RowResult.fetch_columns
+
+#@ global help for fetch_columns[USE:rowresult.fetch_columns]
+\help RowResult.fetch_columns
+
 #@ rowresult.fetch_one
 rowresult.help('fetch_one')
 
@@ -11,6 +11,15 @@ tableinsert.help()
 #@ global help for TableInsert[USE:tableinsert]
 \help TableInsert
 
+#@ tableinsert.bind
+tableinsert.help('bind')
+
+#@ global ? for bind[USE:tableinsert.bind]
+\? TableInsert.bind
+
+#@ global help for bind[USE:tableinsert.bind]
+\help TableInsert.bind
+
 #@ tableinsert.help
 tableinsert.help('help')
 
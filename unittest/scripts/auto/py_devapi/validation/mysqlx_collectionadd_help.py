@@ -14,6 +14,10 @@ FUNCTIONS
       add(...)
             Stores documents to be added into a collection.
 
+      bind(name, value)
+            Binds a value to a specific placeholder used on this CollectionAdd
+            object.
+
       execute()
             Executes the add operation, the documents are added to the target
             collection.
@@ -70,6 +74,33 @@ EXAMPLES
       collection.add(mysqlx.expr('{"name":"John", "age":25}'))
             Inserts a document created from a JSON String.
 
+#@<OUT> colladd.bind
+NAME
+      bind - Binds a value to a specific placeholder used on this CollectionAdd
+             object.
+
+SYNTAX
+      <CollectionAdd>.bind(name, value)
+
+WHERE
+      name: The name of the placeholder to which the value will be bound.
+      value: The value to be bound on the placeholder.
+
+RETURNS
+      This CollectionAdd object.
+
+DESCRIPTION
+      Binds the given value to the placeholder with the specified name.
+
+      An error will be raised if the placeholder indicated by name does not
+      exist.
+
+      This function must be called once for each used placeholder or an error
+      will be raised when the execute() method is called.
+
+      This function is available only if any of the added documents uses a
+      placeholder, i.e. mysqlx.expr(":name").
+
 #@<OUT> colladd.execute
 NAME
       execute - Executes the add operation, the documents are added to the
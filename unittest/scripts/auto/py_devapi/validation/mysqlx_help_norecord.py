@@ -842,6 +842,14 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetch_batch(size)
+            Returns a list of ColumnBuffer objects holding the values of up to
+            size unread rows, one for each of the columns of the result.
+
+      fetch_columns()
+            Returns a list of ColumnBuffer objects holding the values of every
+            unread row, one for each of the columns of the result.
+
       fetch_one()
             Retrieves the next Row on the RowResult.
 
@@ -1022,6 +1030,10 @@ FUNCTIONS
       drop_schema(name)
             Drops the schema with the specified name.
 
+      execute_batch(statements)
+            Executes the given statements using a single round trip to the
+            server.
+
       get_current_schema()
             Retrieves the active schema on the session.
 
@@ -42,6 +42,14 @@ FUNCTIONS
             Returns a list of DbDoc objects which contains an element for every
             unread document.
 
+      fetch_batch(size)
+            Returns a list of ColumnBuffer objects holding the values of up to
+            size unread rows, one for each of the columns of the result.
+
+      fetch_columns()
+            Returns a list of ColumnBuffer objects holding the values of every
+            unread row, one for each of the columns of the result.
+
       fetch_one()
             Retrieves the next Row on the RowResult.
 
@@ -125,6 +133,43 @@ SYNTAX
 RETURNS
       A List of DbDoc objects.
 
+#@<OUT> rowresult.fetch_batch
+NAME
+      fetch_batch - Returns a list of ColumnBuffer objects holding the values of
+                    up to size unread rows, one for each of the columns of the
+                    result.
+
+SYNTAX
+      <RowResult>.fetch_batch(size)
+
+WHERE
+      size: The maximum number of rows to be fetched.
+
+RETURNS
+      A List of ColumnBuffer objects or null if there are no more rows.
+
+DESCRIPTION
+      This function can be used to process a big result in fixed size chunks,
+      see fetch_columns() for more details.
+
+#@<OUT> rowresult.fetch_columns
+NAME
+      fetch_columns - Returns a list of ColumnBuffer objects holding the values
+                      of every unread row, one for each of the columns of the
+                      result.
+
+SYNTAX
+      <RowResult>.fetch_columns()
+
+RETURNS
+      A List of ColumnBuffer objects.
+
+DESCRIPTION
+      The values are decoded directly into a buffer per column, without creating
+      a Row object for each of the records, which is considerably faster for big
+      results. In Python, the buffers can be accessed without copying them using
+      memoryview().
+
 #@<OUT> rowresult.fetch_one
 NAME
       fetch_one - Retrieves the next Row on the RowResult.
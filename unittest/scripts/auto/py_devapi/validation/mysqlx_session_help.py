@@ -45,6 +45,10 @@ FUNCTIONS
       drop_schema(name)
             Drops the schema with the specified name.
 
+      execute_batch(statements)
+            Executes the given statements using a single round trip to the
+            server.
+
       get_current_schema()
             Retrieves the active schema on the session.
 
@@ -10,6 +10,10 @@ DESCRIPTION
       class.
 
 FUNCTIONS
+      bind(name, value)
+            Binds a value to a specific placeholder used on this TableInsert
+            object.
+
       execute()
             Executes the insert operation.
 
@@ -22,6 +26,33 @@ FUNCTIONS
       values(value[, value, ...])
             Adds a new row to the insert operation with the given values.
 
+#@<OUT> tableinsert.bind
+NAME
+      bind - Binds a value to a specific placeholder used on this TableInsert
+             object.
+
+SYNTAX
+      <TableInsert>.bind(name, value)
+
+WHERE
+      name: The name of the placeholder to which the value will be bound.
+      value: The value to be bound on the placeholder.
+
+RETURNS
+      This TableInsert object.
+
+DESCRIPTION
+      Binds the given value to the placeholder with the specified name.
+
+      An error will be raised if the placeholder indicated by name does not
+      exist.
+
+      This function must be called once for each used placeholder or an error
+      will be raised when the execute() method is called.
+
+      This function is available only if any of the inserted values uses a
+      placeholder, i.e. mysqlx.expr(":name").
+
 #@<OUT> tableinsert.help
 NAME
       help - Provides help about this class and it's members
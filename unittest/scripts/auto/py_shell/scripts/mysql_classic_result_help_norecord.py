@@ -83,6 +83,24 @@ classicresult.help('fetch_all')
 #@ global help for fetch_all[USE:classicresult.fetch_all]
 \help ClassicResult.fetch_all
 
+#@ classicresult.fetch_batch
+classicresult.help('fetch_batch')
+
+#@ global ? for fetch_batch[USE:classicresult.fetch_batch]
+\? ClassicResult.fetch_batch
+
+#@ global help for fetch_batch[USE:classicresult.fetch_batch]
+\help ClassicResult.fetch_batch
+
+#@ classicresult.fetch_columns
+classicresult.help('fetch_columns')
+
+#@ global ? for fetch_columns[USE:classicresult.fetch_columns]
+\? ClassicResult.fetch_columns
+
+#@ global help for fetch_columns[USE:classicresult.fetch_columns]
+\help ClassicResult.fetch_columns
+
 #@ classicresult.fetch_one
 classicresult.help('fetch_one')
 
@@ -0,0 +1,145 @@
+# Integration tests of copyInstance, copySchemas and copyTables
+
+#@<> INCLUDE dump_utils.inc
+
+#@<> Setup
+def prepare(sbport):
+    testutil.deploy_sandbox(sbport, "root", {
+        "local_infile": "1"
+    })
+
+
+prepare(__mysql_sandbox_port1)
+session1 = mysql.get_session(__sandbox_uri1)
+session1.run_sql("set names utf8mb4")
+session1.run_sql("create schema world")
+testutil.import_data(__sandbox_uri1, __data_path+"/sql/world.sql", "world")
+testutil.import_data(__sandbox_uri1, __data_path+"/sql/misc_features.sql")
+session1.run_sql("create schema tests")
+session1.run_sql("create table tests.data (id int primary key auto_increment, v varchar(255))")
+session1.run_sql("insert into tests.data (v) values " + ",".join([f"(repeat('{i % 10}', 200))" for i in range(1000)]))
+session1.run_sql("insert into tests.data (v) select v from tests.data")
+session1.run_sql("insert into tests.data (v) select v from tests.data")
+
+prepare(__mysql_sandbox_port2)
+session2 = mysql.get_session(__sandbox_uri2)
+session2.run_sql("set names utf8mb4")
+
+shell.connect(__sandbox_uri1)
+
+#@<> copy_instance
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.copy_instance(__sandbox_uri2, {"excludeUsers": ["root"], "showProgress": False}), "copy_instance")
+EXPECT_STDOUT_CONTAINS("Loading DDL, Data and Users from in-memory storage")
+
+compare_servers(session1, session2, check_rows=True, check_users=False)
+
+#@<> copy_instance - data is throttled when target is slower than source
+wipeout_server(session2)
+
+# small chunks, only a few of them can be held in memory at once
+WIPE_SHELL_LOG()
+EXPECT_NO_THROWS(lambda: util.copy_instance(__sandbox_uri2, {"excludeUsers": ["root"], "bytesPerChunk": "128k", "threads": 2, "showProgress": False}), "copy_instance")
+
+compare_servers(session1, session2, check_rows=True, check_users=False)
+
+# memory used by the data files does not exceed threads * bytesPerChunk * 2
+with open(testutil.get_shell_log_path(), "r", encoding="utf-8") as f:
+    memory = re.search(r"Peak memory used by the data files: (\d+) bytes, limit: (\d+) bytes", f.read())
+
+EXPECT_NE(None, memory)
+EXPECT_EQ(2 * 128 * 1024 * 2, int(memory.group(2)))
+EXPECT_LE(int(memory.group(1)), int(memory.group(2)))
+EXPECT_LT(0, int(memory.group(1)))
+
+#@<> copy_instance - tables are split into multiple files even if chunking is disabled
+wipeout_server(session2)
+
+WIPE_SHELL_LOG()
+EXPECT_NO_THROWS(lambda: util.copy_instance(__sandbox_uri2, {"excludeUsers": ["root"], "chunking": False, "bytesPerChunk": "128k", "threads": 2, "showProgress": False}), "copy_instance")
+
+compare_servers(session1, session2, check_rows=True, check_users=False)
+
+# tests.data does not fit within the limit, yet it's not held in memory as a whole
+with open(testutil.get_shell_log_path(), "r", encoding="utf-8") as f:
+    memory = re.search(r"Peak memory used by the data files: (\d+) bytes, limit: (\d+) bytes", f.read())
+
+EXPECT_NE(None, memory)
+EXPECT_EQ(2 * 128 * 1024 * 2, int(memory.group(2)))
+EXPECT_LE(int(memory.group(1)), int(memory.group(2)))
+EXPECT_LT(0, int(memory.group(1)))
+EXPECT_SHELL_LOG_CONTAINS("Data dump for table `tests`.`data` will be written to multiple files")
+
+#@<> copy_instance - compression
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.copy_instance(__sandbox_uri2, {"excludeUsers": ["root"], "compression": "zstd", "showProgress": False}), "copy_instance")
+
+compare_servers(session1, session2, check_rows=True, check_users=False)
+
+#@<> copy_schemas
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.copy_schemas(["world", "tests"], __sandbox_uri2, {"showProgress": False}), "copy_schemas")
+
+compare_schema(session1, session2, "world")
+compare_schema(session1, session2, "tests")
+EXPECT_EQ(0, session2.run_sql("select count(*) from information_schema.schemata where schema_name = 'sakila'").fetch_one()[0])
+
+#@<> copy_schemas - target schema
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.copy_schemas(["world"], __sandbox_uri2, {"schema": "copied", "showProgress": False}), "copy_schemas")
+
+compare_query_results(session1, session2, "select count(*) from world.city")
+EXPECT_EQ(session1.run_sql("select count(*) from world.city").fetch_one()[0], session2.run_sql("select count(*) from copied.city").fetch_one()[0])
+
+#@<> copy_tables
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.copy_tables("world", ["city", "country"], __sandbox_uri2, {"showProgress": False}), "copy_tables")
+
+EXPECT_EQ(session1.run_sql("checksum table world.city").fetch_one()[1], session2.run_sql("checksum table world.city").fetch_one()[1])
+EXPECT_EQ(session1.run_sql("checksum table world.country").fetch_one()[1], session2.run_sql("checksum table world.country").fetch_one()[1])
+EXPECT_EQ(0, session2.run_sql("select count(*) from information_schema.tables where table_schema = 'world' and table_name = 'countrylanguage'").fetch_one()[0])
+
+#@<> copy_tables - DDL only
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.copy_tables("tests", ["data"], __sandbox_uri2, {"ddlOnly": True, "showProgress": False}), "copy_tables")
+
+EXPECT_EQ(0, session2.run_sql("select count(*) from tests.data").fetch_one()[0])
+
+#@<> copy - dry run does not modify the target instance
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.copy_schemas(["world"], __sandbox_uri2, {"dryRun": True, "showProgress": False}), "copy_schemas")
+EXPECT_STDOUT_CONTAINS("dryRun enabled, no changes will be made.")
+
+EXPECT_EQ(0, session2.run_sql("select count(*) from information_schema.schemata where schema_name = 'world'").fetch_one()[0])
+
+#@<> copy - existing objects
+wipeout_server(session2)
+
+EXPECT_NO_THROWS(lambda: util.copy_tables("world", ["city"], __sandbox_uri2, {"showProgress": False}), "copy_tables")
+EXPECT_THROWS(lambda: util.copy_tables("world", ["city"], __sandbox_uri2, {"showProgress": False}), "Duplicate objects found in destination database")
+
+# dry run checks the target instance
+EXPECT_THROWS(lambda: util.copy_tables("world", ["city"], __sandbox_uri2, {"dryRun": True, "showProgress": False}), "Duplicate objects found in destination database")
+
+#@<> copy - storage options are not supported
+EXPECT_THROWS(lambda: util.copy_instance(__sandbox_uri2, {"osBucketName": "bucket"}), "The storage options cannot be used when copying data between instances.")
+EXPECT_THROWS(lambda: util.copy_schemas(["world"], __sandbox_uri2, {"s3BucketName": "bucket"}), "The storage options cannot be used when copying data between instances.")
+
+#@<> copy - invalid load options
+EXPECT_THROWS(lambda: util.copy_tables("world", ["city"], __sandbox_uri2, {"analyzeTables": "invalid"}), "Invalid value 'invalid' for analyzeTables option")
+
+#@<> copy - requires a global session
+shell.disconnect()
+
+EXPECT_THROWS(lambda: util.copy_instance(__sandbox_uri2), "An open session is required to perform this operation.")
+
+#@<> Cleanup
+testutil.destroy_sandbox(__mysql_sandbox_port1)
+testutil.destroy_sandbox(__mysql_sandbox_port2)
@@ -1084,6 +1084,34 @@ ERROR: Dump is using capabilities which are not supported by this version of MyS
 The minimum required version of MySQL Shell to load this dump is: 8.0.29.
 """)
 
+#@<> multi-member gzip files are recorded as a capability, so that older loaders reject such dumps
+wipe_dir(dump_dir)
+shell.connect(__sandbox_uri1)
+EXPECT_NO_THROWS(lambda: util.dump_tables(schema_name, [ no_partitions_table_name ], dump_dir, { "compression": "gzip", "compressionThreads": 2, "showProgress": False }), "Dumping the data should not fail")
+EXPECT_CAPABILITIES(metadata_file, [ multi_member_gzip_capability ])
+
+checksum = compute_checksum(schema_name, no_partitions_table_name)
+shell.connect(__sandbox_uri2)
+wipeout_server(session)
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "showProgress": False }), "Loading the dump should not fail")
+EXPECT_EQ(checksum, compute_checksum(schema_name, no_partitions_table_name))
+
+# single-threaded gzip compression does not use this capability
+wipe_dir(dump_dir)
+shell.connect(__sandbox_uri1)
+EXPECT_NO_THROWS(lambda: util.dump_tables(schema_name, [ no_partitions_table_name ], dump_dir, { "compression": "gzip", "showProgress": False }), "Dumping the data should not fail")
+EXPECT_NO_CAPABILITIES(metadata_file, [ multi_member_gzip_capability ])
+
+#@<> lz4 compression is recorded as a capability, so that older loaders reject such dumps
+wipe_dir(dump_dir)
+shell.connect(__sandbox_uri1)
+EXPECT_NO_THROWS(lambda: util.dump_tables(schema_name, [ no_partitions_table_name ], dump_dir, { "compression": "lz4", "showProgress": False }), "Dumping the data should not fail")
+EXPECT_CAPABILITIES(metadata_file, [ lz4_compression_capability ])
+
+wipe_dir(dump_dir)
+EXPECT_NO_THROWS(lambda: util.dump_tables(schema_name, [ no_partitions_table_name ], dump_dir, { "compression": "zstd", "showProgress": False }), "Dumping the data should not fail")
+EXPECT_NO_CAPABILITIES(metadata_file, [ lz4_compression_capability ])
+
 #@<> WL14632-TSFR_3_1
 exported_file = os.path.join(outdir, "part.tsv")
 
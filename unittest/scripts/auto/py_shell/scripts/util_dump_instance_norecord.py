@@ -706,6 +706,39 @@ EXPECT_FAIL("ValueError", "Argument #2: The value of 'bytesPerChunk' option must
 EXPECT_FAIL("ValueError", "Argument #2: The value of 'bytesPerChunk' option must be greater than or equal to 128k.", test_output_relative, { "bytesPerChunk": "0" })
 EXPECT_FAIL("ValueError", 'Argument #2: Input number "-1" cannot be negative', test_output_relative, { "bytesPerChunk": "-1" })
 
+#@<> adaptiveChunking option
+TEST_BOOL_OPTION("adaptiveChunking")
+
+EXPECT_FAIL("ValueError", "Argument #2: The option 'adaptiveChunking' cannot be used if the 'chunking' option is set to false.", test_output_relative, { "adaptiveChunking": True, "chunking": False })
+EXPECT_FAIL("ValueError", "Argument #2: The option 'adaptiveChunking' cannot be used if the 'chunking' option is set to false.", test_output_relative, { "chunking": False, "adaptiveChunking": True })
+
+# chunks are split while being dumped, all of them are loaded
+TEST_DUMP_AND_LOAD([ test_schema ], { "adaptiveChunking": True, "bytesPerChunk": "128k", "threads": 8, "showProgress": False })
+EXPECT_TRUE(has_file_with_basename(test_output_absolute, encode_table_basename(test_schema, test_table_primary) + "@@"))
+
+#@<> metadataCache option
+TEST_STRING_OPTION("metadataCache")
+
+metadata_cache = os.path.join(__tmp_dir, "metadata_cache.bin")
+testutil.rmfile(metadata_cache)
+
+# cache is created by the first dump
+TEST_DUMP_AND_LOAD([ test_schema ], { "metadataCache": metadata_cache, "showProgress": False })
+EXPECT_TRUE(os.path.isfile(metadata_cache))
+
+# table altered between the dumps is dumped using its current definition
+session.run_sql("ALTER TABLE !.! ADD COLUMN metadata_cache_column INT DEFAULT 5", [ test_schema, test_table_primary ])
+session.run_sql("UPDATE !.! SET metadata_cache_column = 7", [ test_schema, test_table_primary ])
+TEST_DUMP_AND_LOAD([ test_schema ], { "metadataCache": metadata_cache, "showProgress": False })
+session.run_sql("ALTER TABLE !.! DROP COLUMN metadata_cache_column", [ test_schema, test_table_primary ])
+
+# invalid cache is replaced
+testutil.create_file(metadata_cache, "invalid")
+EXPECT_SUCCESS([ test_schema ], test_output_absolute, { "metadataCache": metadata_cache, "ddlOnly": True, "showProgress": False })
+EXPECT_STDOUT_CONTAINS(f"WARNING: Failed to load the metadata cache '{metadata_cache}', it will be recreated: File is not a snapshot of the instance cache")
+
+testutil.rmfile(metadata_cache)
+
 #@<> WL13807-FR4.14 - The `options` dictionary may contain a `threads` key with an unsigned integer value, which specifies the number of threads to be used to perform the dump.
 # WL13807-TSFR_3_54
 TEST_UINT_OPTION("threads")
@@ -816,6 +849,7 @@ EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basen
 # * `"none"` - no compression is used,
 # * `"gzip"` - gzip compression is used.
 # * `"zstd"` - zstd compression is used.
+# * `"lz4"` - lz4 compression is used.
 # WL13807-TSFR_3_571_3
 EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "gzip", "chunking": False, "showProgress": False })
 EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.gz")))
@@ -826,6 +860,11 @@ EXPECT_FAIL("ValueError", "Argument #2: Unknown compression type: dummy", test_o
 EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "zstd", "chunking": False, "showProgress": False })
 EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.zst")))
 
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "lz4", "chunking": False, "showProgress": False })
+EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basename(types_schema, types_schema_tables[0]) + ".tsv.lz4")))
+
+TEST_DUMP_AND_LOAD([types_schema], { "compression": "lz4", "showProgress": False })
+
 #@<> WL13807: WL13804-FR5.3.2 - If the `compression` option is not given, a default value of `"none"` must be used instead.
 # WL13807-FR3 - Both new functions must accept the following options specified in WL#13804, FR5:
 # * The `compression` option specified in WL#13804, FR5.3, with the modification of FR5.3.2, the default value must be`"zstd"`.
@@ -941,6 +980,36 @@ EXPECT_FAIL("ValueError", "Argument #2: The 'json' dialect is not supported.", t
 TEST_DUMP_AND_LOAD([types_schema], { "fieldsTerminatedBy": "a", "fieldsEnclosedBy": "b", "fieldsEscapedBy": "c", "linesTerminatedBy": "d", "fieldsOptionallyEnclosed": True })
 EXPECT_TRUE(count_files_with_extension(test_output_relative, ".txt.zst") > 0)
 
+#@<> clientSideEncoding option
+TEST_BOOL_OPTION("clientSideEncoding")
+
+for dialect in [ "default", "csv", "tsv", "csv-unix" ]:
+    TEST_DUMP_AND_LOAD([types_schema], { "dialect": dialect, "clientSideEncoding": True })
+
+# encoded values need to be escaped
+TEST_DUMP_AND_LOAD([types_schema], { "fieldsTerminatedBy": "a", "fieldsEnclosedBy": "b", "fieldsEscapedBy": "c", "linesTerminatedBy": "d", "fieldsOptionallyEnclosed": True, "clientSideEncoding": True })
+
+#@<> clientSideEncoding writes the same data as the server-side encoding
+def read_data_files(directory):
+    files = {}
+    for f in os.listdir(directory):
+        if f.endswith(".tsv"):
+            with open(os.path.join(directory, f), "rb") as fh:
+                files[f] = fh.read()
+    return files
+
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "none", "chunking": False, "showProgress": False })
+server_side = read_data_files(test_output_absolute)
+
+EXPECT_SUCCESS([types_schema], test_output_absolute, { "compression": "none", "chunking": False, "showProgress": False, "clientSideEncoding": True })
+client_side = read_data_files(test_output_absolute)
+
+EXPECT_EQ(sorted(server_side.keys()), sorted(client_side.keys()))
+
+# includes BIT and GEOMETRY columns
+for name, data in server_side.items():
+    EXPECT_EQ(data, client_side.get(name), name)
+
 #@<> WL15311_TSFR_5_2, WL15311_TSFR_5_3, WL15311_TSFR_5_4, WL15311_TSFR_5_5, WL15311_TSFR_5_6 - more custom dialects
 custom_dialect_schema = "wl15311_tsfr_5"
 custom_dialect_table = "x"
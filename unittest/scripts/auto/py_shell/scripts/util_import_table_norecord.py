@@ -419,12 +419,12 @@ session.run_sql(f"CREATE TABLE {test_table_qualified} (k INT PRIMARY KEY, v TEXT
 for i in range(test_rows):
     session.run_sql(f"INSERT INTO {test_table_qualified} VALUES ({i}, REPEAT('a', 10000))")
 
-for compression, extension in { "none": "", "zstd": ".zst" }.items():
+for compression, extension in { "none": "", "zstd": ".zst", "lz4": ".lz4" }.items():
     util.export_table(test_table_qualified, os.path.join(output_dir, f"1.tsv{extension}"), { "fieldsEnclosedBy": "'", "linesTerminatedBy": "a", "compression": compression, "where": f"k < {test_rows / 2}", "showProgress": False })
     util.export_table(test_table_qualified, os.path.join(output_dir, f"2.tsv{extension}"), { "fieldsEnclosedBy": "'", "linesTerminatedBy": "a", "compression": compression, "where": f"k >= {test_rows / 2}", "showProgress": False })
 
 #@<> BUG#35018278 - tests
-for extension in [ "", ".zst" ]:
+for extension in [ "", ".zst", ".lz4" ]:
     for files in [ [ "1.tsv", "2.tsv" ], [ "*.tsv" ] ]:
         for skip in range(int(test_rows / 2) + 2):
             context = f"skip: {skip}"
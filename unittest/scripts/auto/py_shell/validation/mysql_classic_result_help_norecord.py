@@ -59,6 +59,16 @@ FUNCTIONS
             Returns a list of Row objects which contains an element for every
             record left on the result.
 
+      fetch_batch(size)
+            Returns a list of ColumnBuffer objects holding the values of up to
+            size records left on the result, one for each of the columns of the
+            result.
+
+      fetch_columns()
+            Returns a list of ColumnBuffer objects holding the values of every
+            record left on the result, one for each of the columns of the
+            result.
+
       fetch_one()
             Retrieves the next Row on the ClassicResult.
 
@@ -197,6 +207,43 @@ DESCRIPTION
       If fetchOne is called before this function, when this function is called
       it will return a Row for each of the remaining records on the resultset.
 
+#@<OUT> classicresult.fetch_batch
+NAME
+      fetch_batch - Returns a list of ColumnBuffer objects holding the values of
+                    up to size records left on the result, one for each of the
+                    columns of the result.
+
+SYNTAX
+      <ClassicResult>.fetch_batch(size)
+
+WHERE
+      size: The maximum number of records to be fetched.
+
+RETURNS
+      A List of ColumnBuffer objects or null if there are no more records.
+
+DESCRIPTION
+      This function can be used to process a big result in fixed size chunks,
+      see fetch_columns() for more details.
+
+#@<OUT> classicresult.fetch_columns
+NAME
+      fetch_columns - Returns a list of ColumnBuffer objects holding the values
+                      of every record left on the result, one for each of the
+                      columns of the result.
+
+SYNTAX
+      <ClassicResult>.fetch_columns()
+
+RETURNS
+      A List of ColumnBuffer objects.
+
+DESCRIPTION
+      The values are decoded directly into a buffer per column, without creating
+      a Row object for each of the records, which is considerably faster for big
+      results. In Python, the buffers can be accessed without copying them using
+      memoryview().
+
 #@<OUT> classicresult.fetch_one
 NAME
       fetch_one - Retrieves the next Row on the ClassicResult.
@@ -16,6 +16,16 @@ FUNCTIONS
             Performs series of tests on specified MySQL server to check if the
             upgrade process will succeed.
 
+      copy_instance(connectionData[, options])
+            Copies a source instance to the target instance.
+
+      copy_schemas(schemas, connectionData[, options])
+            Copies schemas from the source instance to the target instance.
+
+      copy_tables(schema, tables, connectionData[, options])
+            Copies tables and views from schema in the source instance to the
+            target instance.
+
       dump_instance(outputUrl[, options])
             Dumps the whole database to files in the output directory.
 
@@ -67,6 +77,10 @@ DESCRIPTION
       - targetVersion - version to which upgrade will be checked
         (default=<<<__mysh_version>>>)
       - password - password for connection.
+      - threads - number of threads and sessions used to execute the checks
+        (default=1). If greater than 1, the checks and the 'CHECK TABLE x FOR
+        UPGRADE' commands are executed in parallel, output is printed once all
+        of them finish.
 
       The connection data may be specified in the following formats:
 
@@ -246,11 +260,25 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything.
+      - metadataCache: string (default: not set) - Path to a local file used to
+        cache the metadata of the dumped tables and views between the dumps. If
+        this file exists, columns and indexes of the schemas which did not
+        change since it was written are not fetched from the server. The file is
+        updated once the metadata is fetched.
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust chunks of the tables
+        while they are being dumped, using the measured throughput. Chunks which
+        take too long to be dumped are split and handed over to the idle
+        threads. Requires chunking.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - clientSideEncoding: bool (default: false) - Fetch the values of columns
+        with data types which are not safe to be stored in text form (i.e. BLOB)
+        as is and encode them in the Shell, instead of on the server. Reduces
+        the load of the server and the amount of data transferred over the
+        network.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -277,7 +305,11 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "lz4", "zstd".
+      - compressionThreads: int (default: 0) - Use N threads to compress the
+        data dump files, shared by all dump threads. If set to 0, data is
+        compressed by the dump threads. Can only be used with "zstd" or "gzip"
+        compression.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -817,11 +849,25 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything.
+      - metadataCache: string (default: not set) - Path to a local file used to
+        cache the metadata of the dumped tables and views between the dumps. If
+        this file exists, columns and indexes of the schemas which did not
+        change since it was written are not fetched from the server. The file is
+        updated once the metadata is fetched.
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust chunks of the tables
+        while they are being dumped, using the measured throughput. Chunks which
+        take too long to be dumped are split and handed over to the idle
+        threads. Requires chunking.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - clientSideEncoding: bool (default: false) - Fetch the values of columns
+        with data types which are not safe to be stored in text form (i.e. BLOB)
+        as is and encode them in the Shell, instead of on the server. Reduces
+        the load of the server and the amount of data transferred over the
+        network.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -848,7 +894,11 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "lz4", "zstd".
+      - compressionThreads: int (default: 0) - Use N threads to compress the
+        data dump files, shared by all dump threads. If set to 0, data is
+        compressed by the dump threads. Can only be used with "zstd" or "gzip"
+        compression.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -1365,11 +1415,25 @@ DESCRIPTION
       - dataOnly: bool (default: false) - Only dump data from the database.
       - dryRun: bool (default: false) - Print information about what would be
         dumped, but do not dump anything.
+      - metadataCache: string (default: not set) - Path to a local file used to
+        cache the metadata of the dumped tables and views between the dumps. If
+        this file exists, columns and indexes of the schemas which did not
+        change since it was written are not fetched from the server. The file is
+        updated once the metadata is fetched.
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Adjust chunks of the tables
+        while they are being dumped, using the measured throughput. Chunks which
+        take too long to be dumped are split and handed over to the idle
+        threads. Requires chunking.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - clientSideEncoding: bool (default: false) - Fetch the values of columns
+        with data types which are not safe to be stored in text form (i.e. BLOB)
+        as is and encode them in the Shell, instead of on the server. Reduces
+        the load of the server and the amount of data transferred over the
+        network.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -1396,7 +1460,11 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "lz4", "zstd".
+      - compressionThreads: int (default: 0) - Use N threads to compress the
+        data dump files, shared by all dump threads. If set to 0, data is
+        compressed by the dump threads. Can only be used with "zstd" or "gzip"
+        compression.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -1913,7 +1981,7 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "none") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd".
+        the data dump files, one of: "none", "gzip", "lz4", "zstd".
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -2189,6 +2257,9 @@ DESCRIPTION
         conversion of the BSON ObjectId values.
       - extractOidTime: string (default: empty) - creates a new field based on
         the ObjectID timestamp. Only valid if convertBsonOid is enabled.
+      - threads: int (default: 1) - use that many threads and sessions to parse
+        and insert the documents. If greater than 1, documents are inserted in
+        parallel, in no particular order.
 
       The following options are valid only when convertBsonTypes is enabled.
       They are all boolean flags. ignoreRegexOptions is enabled by default,
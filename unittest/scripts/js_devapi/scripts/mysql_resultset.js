@@ -33,6 +33,8 @@ validateMembers(result, [
 'fetchOne',
 'fetchOneObject',
 'fetchAll',
+'fetchBatch',
+'fetchColumns',
 'hasData',
 'nextDataSet',
 'nextResult',
@@ -126,4 +128,28 @@ println(row[1])
 println(row[2])
 println(row[3])
 
+//@<> Resultset columnar fetch
+var query = "select 1 as i, 'one' as s, 0.5e0 as d union all select -2, NULL, 1.5e0 union all select 3, 'three', NULL";
+var result = mySession.runSql(query);
+var columns = result.fetchColumns();
+EXPECT_EQ(3, columns.length);
+EXPECT_EQ('i', columns[0].column.columnLabel);
+EXPECT_EQ(3, columns[0].length);
+EXPECT_EQ(0, columns[0].nullCount);
+EXPECT_EQ('q', columns[0].format);
+EXPECT_EQ(-2, columns[0][1]);
+EXPECT_EQ(1, columns[1].nullCount);
+EXPECT_EQ('B', columns[1].format);
+EXPECT_EQ('three', columns[1][2]);
+EXPECT_EQ(null, columns[1][1]);
+EXPECT_EQ(1.5, columns[2][1]);
+EXPECT_EQ(null, columns[2][2]);
+
+//@<> Resultset batch fetch
+var result = mySession.runSql(query);
+EXPECT_THROWS(function() { result.fetchBatch(0); }, "The batch size must be greater than 0.");
+EXPECT_EQ(2, result.fetchBatch(2)[0].length);
+EXPECT_EQ(3, result.fetchBatch(2)[0][0]);
+EXPECT_EQ(null, result.fetchBatch(2));
+
 mySession.close()
\ No newline at end of file
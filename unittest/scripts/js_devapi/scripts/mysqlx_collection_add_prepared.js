@@ -0,0 +1,30 @@
+shell.connect(__uripwd);
+session.dropSchema('prepared_stmt');
+var schema = session.createSchema('prepared_stmt');
+var collection = schema.createCollection('test_collection');
+
+//@ First execution is normal
+var crud = collection.add({_id: mysqlx.expr(':id'), name: mysqlx.expr(':name'), age: 18});
+crud.bind('id', '001').bind('name', 'george').execute();
+
+//@ Second execution prepares statement and executes it
+crud.bind('id', '002').bind('name', 'james').execute();
+
+//@ Third execution uses prepared statement
+crud.bind('id', '003').bind('name', 'luke').execute();
+
+//@ add() changes statement, back to normal execution
+crud.add({_id: mysqlx.expr(':id2'), name: 'mark', age: 20}).bind('id', '004').bind('name', 'john').bind('id2', '005').execute();
+
+//@ second execution after add(), prepares statement and executes it
+crud.bind('id', '006').bind('name', 'paul').bind('id2', '007').execute();
+
+//@ third execution after add(), uses prepared statement
+crud.bind('id', '008').bind('name', 'peter').bind('id2', '009').execute();
+
+//@ Added documents
+collection.find().sort('_id');
+
+//@<> Finalizing
+session.dropSchema('prepared_stmt');
+session.close();
@@ -29,6 +29,8 @@ validateMembers(result, [
     'fetchOne',
     'fetchOneObject',
     'fetchAll',
+    'fetchBatch',
+    'fetchColumns',
     'help',
     'hasData',
     'nextDataSet',
@@ -94,7 +96,9 @@ validateMembers(result, [
     'help',
     'fetchOne',
     'fetchOneObject',
-    'fetchAll'])
+    'fetchAll',
+    'fetchBatch',
+    'fetchColumns'])
 
 //@<> DocResult member validation
 var result = collection.find().execute();
@@ -10,6 +10,7 @@ validateMembers(mySession, [
     'commit',
     'createSchema',
     'dropSchema',
+    'executeBatch',
     'getCurrentSchema',
     'getDefaultSchema',
     'getSchema',
@@ -299,6 +300,43 @@ print(mySession.quoteName('`sample`'));
 print(mySession.quoteName('`sample'));
 print(mySession.quoteName('sample`'));
 
+//@<> Session: executeBatch
+ensure_schema_does_not_exist(mySession, 'batch_schema');
+var batchCollection = mySession.createSchema('batch_schema').createCollection('docs');
+
+var results = mySession.executeBatch([
+    batchCollection.add({_id: '1', name: 'one'}),
+    batchCollection.add({_id: '2', name: 'two'}),
+    batchCollection.modify('_id = :id').set('name', 'changed').bind('id', '2'),
+    batchCollection.find().sort('_id'),
+    mySession.sql('SELECT COUNT(*) FROM batch_schema.docs')]);
+
+EXPECT_EQ(5, results.length);
+EXPECT_EQ(1, results[0].affectedItemsCount);
+EXPECT_EQ(1, results[1].affectedItemsCount);
+EXPECT_EQ(1, results[2].affectedItemsCount);
+var docs = results[3].fetchAll();
+EXPECT_EQ(2, docs.length);
+EXPECT_EQ('changed', docs[1].name);
+EXPECT_EQ(2, results[4].fetchOne()[0]);
+
+//@<> Session: executeBatch stops at the first error
+EXPECT_THROWS(function() {
+  mySession.executeBatch([
+      batchCollection.add({_id: '3'}),
+      batchCollection.add({_id: '1'}),
+      batchCollection.add({_id: '4'})]);
+}, "Statement #2: ");
+EXPECT_EQ(3, batchCollection.count());
+
+//@<> Session: executeBatch invalid statements
+EXPECT_EQ(0, mySession.executeBatch([]).length);
+EXPECT_THROWS(function() {
+  mySession.executeBatch([batchCollection.find(), 1]);
+}, "Statement #2 is expected to be a CRUD operation or a SqlExecute object");
+
+mySession.dropSchema('batch_schema');
+
 //@# Session: bad params
 mysqlx.getSession()
 mysqlx.getSession(42)
@@ -109,6 +109,32 @@ var view = schema.getTable('view1');
 var result = view.insert({ 'my_age': 15, 'my_name': 'jhonny', 'my_gender': 'male' }).execute();
 print("Affected Rows Through View:", result.affectedItemsCount, "\n");
 
+//@<> Table.insert execution, Placeholders
+var crud = table.insert('name', 'age', 'gender').values(mysqlx.expr(':name'), mysqlx.expr(':age'), 'bound');
+EXPECT_ARRAY_NOT_CONTAINS('bind', dir(table.insert('name').values('unbound')));
+EXPECT_ARRAY_CONTAINS('bind', dir(crud));
+EXPECT_THROWS(function () { crud.execute(); }, "TableInsert.execute: Missing value bindings for the following placeholders: name, age");
+
+// second and further executions use a prepared statement
+for (var i = 0; i < 3; ++i) {
+  var result = crud.bind('name', 'bound' + i).bind('age', i).execute();
+  EXPECT_EQ(1, result.affectedItemsCount);
+}
+
+var records = table.select('name', 'age').where('gender = "bound"').orderBy('age').execute().fetchAll();
+EXPECT_EQ(3, records.length);
+
+for (var i = 0; i < 3; ++i) {
+  EXPECT_EQ('bound' + i, records[i].name);
+  EXPECT_EQ(i, records[i].age);
+}
+
+// adding a row changes the statement
+crud.values('unbound', 3, 'bound');
+var result = crud.bind('name', 'bound4').bind('age', 4).execute();
+EXPECT_EQ(2, result.affectedItemsCount);
+EXPECT_EQ(5, table.select().where('gender = "bound"').execute().fetchAll().length);
+
 // Cleanup
 mySession.dropSchema('js_shell_test');
 mySession.close();
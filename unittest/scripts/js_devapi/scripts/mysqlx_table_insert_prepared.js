@@ -0,0 +1,32 @@
+shell.connect(__uripwd);
+session.dropSchema('prepared_stmt');
+var schema = session.createSchema('prepared_stmt');
+session.sql("use prepared_stmt");
+session.sql("create table test_table (id integer, name varchar(20), age integer)");
+var table = schema.getTable('test_table');
+
+//@ First execution is normal
+var crud = table.insert('id', 'name', 'age').values(mysqlx.expr(':id'), mysqlx.expr(':name'), 18);
+crud.bind('id', 1).bind('name', 'george').execute();
+
+//@ Second execution prepares statement and executes it
+crud.bind('id', 2).bind('name', 'james').execute();
+
+//@ Third execution uses prepared statement
+crud.bind('id', 3).bind('name', 'luke').execute();
+
+//@ values() changes statement, back to normal execution
+crud.values(4, 'mark', 20).bind('id', 5).bind('name', 'john').execute();
+
+//@ second execution after values(), prepares statement and executes it
+crud.bind('id', 6).bind('name', 'paul').execute();
+
+//@ third execution after values(), uses prepared statement
+crud.bind('id', 7).bind('name', 'peter').execute();
+
+//@ Inserted rows
+table.select().orderBy('id');
+
+//@<> Finalizing
+session.dropSchema('prepared_stmt');
+session.close();
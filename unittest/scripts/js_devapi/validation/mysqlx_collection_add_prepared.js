@@ -0,0 +1,460 @@
+//@<PROTOCOL> First execution is normal
+>>>> SEND Mysqlx.Crud.Insert {
+  collection {
+    name: "test_collection"
+    schema: "prepared_stmt"
+  }
+  data_model: DOCUMENT
+  row {
+    field {
+      type: OBJECT
+      object {
+        fld {
+          key: "_id"
+          value {
+            type: PLACEHOLDER
+            position: 0
+          }
+        }
+        fld {
+          key: "age"
+          value {
+            type: LITERAL
+            literal {
+              type: V_SINT
+              v_signed_int: 18
+            }
+          }
+        }
+        fld {
+          key: "name"
+          value {
+            type: PLACEHOLDER
+            position: 1
+          }
+        }
+      }
+    }
+  }
+  args {
+    type: V_STRING
+    v_string {
+      value: "001"
+    }
+  }
+  args {
+    type: V_STRING
+    v_string {
+      value: "george"
+    }
+  }
+}
+
+//@<OUT> First execution is normal
+Query OK, 1 item affected ([[*]] sec)
+
+//@<PROTOCOL> Second execution prepares statement and executes it
+>>>> SEND Mysqlx.Prepare.Prepare {
+  stmt_id: 1
+  stmt {
+    type: INSERT
+    insert {
+      collection {
+        name: "test_collection"
+        schema: "prepared_stmt"
+      }
+      data_model: DOCUMENT
+      row {
+        field {
+          type: OBJECT
+          object {
+            fld {
+              key: "_id"
+              value {
+                type: PLACEHOLDER
+                position: 0
+              }
+            }
+            fld {
+              key: "age"
+              value {
+                type: LITERAL
+                literal {
+                  type: V_SINT
+                  v_signed_int: 18
+                }
+              }
+            }
+            fld {
+              key: "name"
+              value {
+                type: PLACEHOLDER
+                position: 1
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+<<<< RECEIVE Mysqlx.Ok {
+}
+
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 1
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "002"
+      }
+    }
+  }
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "james"
+      }
+    }
+  }
+}
+
+//@<OUT> Second execution prepares statement and executes it
+Query OK, 1 item affected ([[*]] sec)
+
+//@<PROTOCOL> Third execution uses prepared statement
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 1
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "003"
+      }
+    }
+  }
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "luke"
+      }
+    }
+  }
+}
+
+//@<OUT> Third execution uses prepared statement
+Query OK, 1 item affected ([[*]] sec)
+
+//@<PROTOCOL> add() changes statement, back to normal execution
+>>>> SEND Mysqlx.Prepare.Deallocate {
+  stmt_id: 1
+}
+
+<<<< RECEIVE Mysqlx.Ok {
+}
+
+>>>> SEND Mysqlx.Crud.Insert {
+  collection {
+    name: "test_collection"
+    schema: "prepared_stmt"
+  }
+  data_model: DOCUMENT
+  row {
+    field {
+      type: OBJECT
+      object {
+        fld {
+          key: "_id"
+          value {
+            type: PLACEHOLDER
+            position: 0
+          }
+        }
+        fld {
+          key: "age"
+          value {
+            type: LITERAL
+            literal {
+              type: V_SINT
+              v_signed_int: 18
+            }
+          }
+        }
+        fld {
+          key: "name"
+          value {
+            type: PLACEHOLDER
+            position: 1
+          }
+        }
+      }
+    }
+  }
+  row {
+    field {
+      type: OBJECT
+      object {
+        fld {
+          key: "_id"
+          value {
+            type: PLACEHOLDER
+            position: 2
+          }
+        }
+        fld {
+          key: "age"
+          value {
+            type: LITERAL
+            literal {
+              type: V_SINT
+              v_signed_int: 20
+            }
+          }
+        }
+        fld {
+          key: "name"
+          value {
+            type: LITERAL
+            literal {
+              type: V_STRING
+              v_string {
+                value: "mark"
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  args {
+    type: V_STRING
+    v_string {
+      value: "004"
+    }
+  }
+  args {
+    type: V_STRING
+    v_string {
+      value: "john"
+    }
+  }
+  args {
+    type: V_STRING
+    v_string {
+      value: "005"
+    }
+  }
+}
+
+//@<OUT> add() changes statement, back to normal execution
+Query OK, 2 items affected ([[*]] sec)
+
+//@<PROTOCOL> second execution after add(), prepares statement and executes it
+>>>> SEND Mysqlx.Prepare.Prepare {
+  stmt_id: 2
+  stmt {
+    type: INSERT
+    insert {
+      collection {
+        name: "test_collection"
+        schema: "prepared_stmt"
+      }
+      data_model: DOCUMENT
+      row {
+        field {
+          type: OBJECT
+          object {
+            fld {
+              key: "_id"
+              value {
+                type: PLACEHOLDER
+                position: 0
+              }
+            }
+            fld {
+              key: "age"
+              value {
+                type: LITERAL
+                literal {
+                  type: V_SINT
+                  v_signed_int: 18
+                }
+              }
+            }
+            fld {
+              key: "name"
+              value {
+                type: PLACEHOLDER
+                position: 1
+              }
+            }
+          }
+        }
+      }
+      row {
+        field {
+          type: OBJECT
+          object {
+            fld {
+              key: "_id"
+              value {
+                type: PLACEHOLDER
+                position: 2
+              }
+            }
+            fld {
+              key: "age"
+              value {
+                type: LITERAL
+                literal {
+                  type: V_SINT
+                  v_signed_int: 20
+                }
+              }
+            }
+            fld {
+              key: "name"
+              value {
+                type: LITERAL
+                literal {
+                  type: V_STRING
+                  v_string {
+                    value: "mark"
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+<<<< RECEIVE Mysqlx.Ok {
+}
+
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 2
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "006"
+      }
+    }
+  }
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "paul"
+      }
+    }
+  }
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "007"
+      }
+    }
+  }
+}
+
+//@<OUT> second execution after add(), prepares statement and executes it
+Query OK, 2 items affected ([[*]] sec)
+
+//@<PROTOCOL> third execution after add(), uses prepared statement
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 2
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "008"
+      }
+    }
+  }
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "peter"
+      }
+    }
+  }
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "009"
+      }
+    }
+  }
+}
+
+//@<OUT> third execution after add(), uses prepared statement
+Query OK, 2 items affected ([[*]] sec)
+
+//@<OUT> Added documents
+{
+    "_id": "001",
+    "age": 18,
+    "name": "george"
+}
+{
+    "_id": "002",
+    "age": 18,
+    "name": "james"
+}
+{
+    "_id": "003",
+    "age": 18,
+    "name": "luke"
+}
+{
+    "_id": "004",
+    "age": 18,
+    "name": "john"
+}
+{
+    "_id": "005",
+    "age": 20,
+    "name": "mark"
+}
+{
+    "_id": "006",
+    "age": 18,
+    "name": "paul"
+}
+{
+    "_id": "007",
+    "age": 20,
+    "name": "mark"
+}
+{
+    "_id": "008",
+    "age": 18,
+    "name": "peter"
+}
+{
+    "_id": "009",
+    "age": 20,
+    "name": "mark"
+}
+9 documents in set ([[*]] sec)
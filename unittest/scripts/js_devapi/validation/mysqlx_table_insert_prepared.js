@@ -0,0 +1,350 @@
+//@<PROTOCOL> First execution is normal
+>>>> SEND Mysqlx.Crud.Insert {
+  collection {
+    name: "test_table"
+    schema: "prepared_stmt"
+  }
+  data_model: TABLE
+  projection {
+    name: "id"
+  }
+  projection {
+    name: "name"
+  }
+  projection {
+    name: "age"
+  }
+  row {
+    field {
+      type: PLACEHOLDER
+      position: 0
+    }
+    field {
+      type: PLACEHOLDER
+      position: 1
+    }
+    field {
+      type: LITERAL
+      literal {
+        type: V_SINT
+        v_signed_int: 18
+      }
+    }
+  }
+  args {
+    type: V_SINT
+    v_signed_int: 1
+  }
+  args {
+    type: V_STRING
+    v_string {
+      value: "george"
+    }
+  }
+}
+
+//@<OUT> First execution is normal
+Query OK, 1 item affected ([[*]] sec)
+
+//@<PROTOCOL> Second execution prepares statement and executes it
+>>>> SEND Mysqlx.Prepare.Prepare {
+  stmt_id: 1
+  stmt {
+    type: INSERT
+    insert {
+      collection {
+        name: "test_table"
+        schema: "prepared_stmt"
+      }
+      data_model: TABLE
+      projection {
+        name: "id"
+      }
+      projection {
+        name: "name"
+      }
+      projection {
+        name: "age"
+      }
+      row {
+        field {
+          type: PLACEHOLDER
+          position: 0
+        }
+        field {
+          type: PLACEHOLDER
+          position: 1
+        }
+        field {
+          type: LITERAL
+          literal {
+            type: V_SINT
+            v_signed_int: 18
+          }
+        }
+      }
+    }
+  }
+}
+
+<<<< RECEIVE Mysqlx.Ok {
+}
+
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 1
+  args {
+    type: SCALAR
+    scalar {
+      type: V_SINT
+      v_signed_int: 2
+    }
+  }
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "james"
+      }
+    }
+  }
+}
+
+//@<OUT> Second execution prepares statement and executes it
+Query OK, 1 item affected ([[*]] sec)
+
+//@<PROTOCOL> Third execution uses prepared statement
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 1
+  args {
+    type: SCALAR
+    scalar {
+      type: V_SINT
+      v_signed_int: 3
+    }
+  }
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "luke"
+      }
+    }
+  }
+}
+
+//@<OUT> Third execution uses prepared statement
+Query OK, 1 item affected ([[*]] sec)
+
+//@<PROTOCOL> values() changes statement, back to normal execution
+>>>> SEND Mysqlx.Prepare.Deallocate {
+  stmt_id: 1
+}
+
+<<<< RECEIVE Mysqlx.Ok {
+}
+
+>>>> SEND Mysqlx.Crud.Insert {
+  collection {
+    name: "test_table"
+    schema: "prepared_stmt"
+  }
+  data_model: TABLE
+  projection {
+    name: "id"
+  }
+  projection {
+    name: "name"
+  }
+  projection {
+    name: "age"
+  }
+  row {
+    field {
+      type: PLACEHOLDER
+      position: 0
+    }
+    field {
+      type: PLACEHOLDER
+      position: 1
+    }
+    field {
+      type: LITERAL
+      literal {
+        type: V_SINT
+        v_signed_int: 18
+      }
+    }
+  }
+  row {
+    field {
+      type: LITERAL
+      literal {
+        type: V_SINT
+        v_signed_int: 4
+      }
+    }
+    field {
+      type: LITERAL
+      literal {
+        type: V_STRING
+        v_string {
+          value: "mark"
+        }
+      }
+    }
+    field {
+      type: LITERAL
+      literal {
+        type: V_SINT
+        v_signed_int: 20
+      }
+    }
+  }
+  args {
+    type: V_SINT
+    v_signed_int: 5
+  }
+  args {
+    type: V_STRING
+    v_string {
+      value: "john"
+    }
+  }
+}
+
+//@<OUT> values() changes statement, back to normal execution
+Query OK, 2 items affected ([[*]] sec)
+
+//@<PROTOCOL> second execution after values(), prepares statement and executes it
+>>>> SEND Mysqlx.Prepare.Prepare {
+  stmt_id: 2
+  stmt {
+    type: INSERT
+    insert {
+      collection {
+        name: "test_table"
+        schema: "prepared_stmt"
+      }
+      data_model: TABLE
+      projection {
+        name: "id"
+      }
+      projection {
+        name: "name"
+      }
+      projection {
+        name: "age"
+      }
+      row {
+        field {
+          type: PLACEHOLDER
+          position: 0
+        }
+        field {
+          type: PLACEHOLDER
+          position: 1
+        }
+        field {
+          type: LITERAL
+          literal {
+            type: V_SINT
+            v_signed_int: 18
+          }
+        }
+      }
+      row {
+        field {
+          type: LITERAL
+          literal {
+            type: V_SINT
+            v_signed_int: 4
+          }
+        }
+        field {
+          type: LITERAL
+          literal {
+            type: V_STRING
+            v_string {
+              value: "mark"
+            }
+          }
+        }
+        field {
+          type: LITERAL
+          literal {
+            type: V_SINT
+            v_signed_int: 20
+          }
+        }
+      }
+    }
+  }
+}
+
+<<<< RECEIVE Mysqlx.Ok {
+}
+
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 2
+  args {
+    type: SCALAR
+    scalar {
+      type: V_SINT
+      v_signed_int: 6
+    }
+  }
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "paul"
+      }
+    }
+  }
+}
+
+//@<OUT> second execution after values(), prepares statement and executes it
+Query OK, 2 items affected ([[*]] sec)
+
+//@<PROTOCOL> third execution after values(), uses prepared statement
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 2
+  args {
+    type: SCALAR
+    scalar {
+      type: V_SINT
+      v_signed_int: 7
+    }
+  }
+  args {
+    type: SCALAR
+    scalar {
+      type: V_STRING
+      v_string {
+        value: "peter"
+      }
+    }
+  }
+}
+
+//@<OUT> third execution after values(), uses prepared statement
+Query OK, 2 items affected ([[*]] sec)
+
+//@<OUT> Inserted rows
++----+--------+-----+
+| id | name   | age |
++----+--------+-----+
+|  1 | george |  18 |
+|  2 | james  |  18 |
+|  3 | luke   |  18 |
+|  4 | mark   |  20 |
+|  4 | mark   |  20 |
+|  4 | mark   |  20 |
+|  5 | john   |  18 |
+|  6 | paul   |  18 |
+|  7 | peter  |  18 |
++----+--------+-----+
+9 rows in set ([[*]] sec)
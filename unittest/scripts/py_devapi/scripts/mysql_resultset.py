@@ -34,6 +34,8 @@ validate_members(result, [
   'fetch_one',
   'fetch_one_object',
   'fetch_all',
+  'fetch_batch',
+  'fetch_columns',
   'has_data',
   'next_data_set',
   'next_result',
@@ -29,6 +29,8 @@ validate_members(result, [
   'fetch_one',
   'fetch_one_object',
   'fetch_all',
+  'fetch_batch',
+  'fetch_columns',
   'has_data',
   'help',
   'next_data_set',
@@ -116,7 +118,9 @@ validate_members(result, [
   'get_column_names',
   'get_columns',
   'fetch_one',
-  'fetch_all'])
+  'fetch_all',
+  'fetch_batch',
+  'fetch_columns'])
 
 #@<> DocResult member validation
 result = collection.find().execute()
@@ -305,5 +309,39 @@ result = mySession.run_sql("select NULL")
 print([c.column_label for c in result.columns])
 print(result.column_names)
 
+#@<> Resultset columnar fetch
+query = "select 1 as i, 'one' as s, 0.5e0 as d union all select -2, NULL, 1.5e0 union all select 3, 'three', NULL"
+result = mySession.sql(query).execute()
+columns = result.fetch_columns()
+EXPECT_EQ(['i', 's', 'd'], [c.column.column_label for c in columns])
+EXPECT_EQ([3, 3, 3], [c.length for c in columns])
+EXPECT_EQ([0, 1, 1], [c.null_count for c in columns])
+
+EXPECT_EQ('q', columns[0].format)
+EXPECT_EQ([1, -2, 3], memoryview(columns[0]).tolist())
+EXPECT_EQ(None, columns[0].offsets)
+EXPECT_EQ(b'\x07', columns[0].validity)
+
+EXPECT_EQ('B', columns[1].format)
+EXPECT_EQ(b'onethree', bytes(memoryview(columns[1])))
+EXPECT_EQ([0, 3, 3, 8], memoryview(columns[1].offsets).cast('q').tolist())
+EXPECT_EQ(b'\x05', columns[1].validity)
+EXPECT_EQ(['one', None, 'three'], [columns[1][i] for i in range(3)])
+
+EXPECT_EQ('d', columns[2].format)
+EXPECT_EQ([0.5, 1.5, 0.0], memoryview(columns[2]).tolist())
+EXPECT_EQ(None, columns[2][2])
+EXPECT_THROWS(lambda: memoryview(columns[2]).__setitem__(0, 1.0), "TypeError: cannot modify read-only memory")
+
+# result is exhausted, buffers are empty
+EXPECT_EQ([0, 0, 0], [c.length for c in result.fetch_columns()])
+
+#@<> Resultset batch fetch
+result = mySession.sql(query).execute()
+EXPECT_THROWS(lambda: result.fetch_batch(0), "The batch size must be greater than 0.")
+EXPECT_EQ([1, -2], memoryview(result.fetch_batch(2)[0]).tolist())
+EXPECT_EQ([3], memoryview(result.fetch_batch(2)[0]).tolist())
+EXPECT_EQ(None, result.fetch_batch(2))
+
 #@<> cleanup
 mySession.close()
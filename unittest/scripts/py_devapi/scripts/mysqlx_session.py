@@ -11,6 +11,7 @@ validate_members(mySession, [
   'commit',
   'create_schema',
   'drop_schema',
+  'execute_batch',
   'get_current_schema',
   'get_default_schema',
   'get_schema',
@@ -204,6 +204,13 @@ class Shell_js_mysqlx_prepared_tests : public Shell_js_mysqlx_tests {
   }
 };
 
+TEST_F(Shell_js_mysqlx_prepared_tests, collection_add) {
+  if (!supports_prepared_statements())
+    SKIP_TEST("Prepared statements are not supported.");
+
+  validate_interactive("mysqlx_collection_add_prepared.js");
+}
+
 TEST_F(Shell_js_mysqlx_prepared_tests, collection_find) {
   if (!supports_prepared_statements())
     SKIP_TEST("Prepared statements are not supported.");
@@ -246,6 +253,13 @@ TEST_F(Shell_js_mysqlx_prepared_tests, table_delete) {
   validate_interactive("mysqlx_table_delete_prepared.js");
 }
 
+TEST_F(Shell_js_mysqlx_prepared_tests, table_insert) {
+  if (!supports_prepared_statements())
+    SKIP_TEST("Prepared statements are not supported.");
+
+  validate_interactive("mysqlx_table_insert_prepared.js");
+}
+
 TEST_F(Shell_js_mysqlx_prepared_tests, session_sql) {
   if (!supports_prepared_statements())
     SKIP_TEST("Prepared statements are not supported.");
@@ -1145,6 +1145,8 @@ str Testutils::get_shell_log_path();
 #endif
 ///@}
 std::string Testutils::get_shell_log_path() {
+  // log entries are written asynchronously, callers are going to read the file
+  shcore::current_logger()->flush();
   return shcore::current_logger()->logfile_name();
 }
 
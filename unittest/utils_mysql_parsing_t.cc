@@ -1465,6 +1465,39 @@ TEST_P(Statement_splitter, line_numbering) {
   // clang-format on
 }
 
+TEST_P(Statement_splitter, long_statements) {
+  // long runs of characters which do not change the context of the splitter
+  // are skipped in bulk, check that special characters are found at every
+  // offset
+  for (size_t i = 0; i < 40; ++i) {
+    SCOPED_TRACE(i);
+
+    const std::string padding(i, 'x');
+    const std::string row =
+        "(1, " + padding + ", 'a\\'" + padding + "''b;', \"" + padding +
+        "\", `" + padding + "`, /*" + padding + "*/ " + padding + "-1)";
+    const std::string insert = "INSERT INTO t VALUES " + row + "," + row;
+
+    EXPECT_EQ(strv({insert + ";", "select 2;"}),
+              split_batch(insert + "; select 2;"));
+
+    EXPECT_EQ(strv({insert + padding + ";", "-- " + padding, "select 3;"}),
+              split_batch(insert + padding + ";\n-- " + padding +
+                          "\nselect 3;"));
+
+    EXPECT_EQ(strv({"select '" + padding + "\\\\';"}),
+              split_batch("select '" + padding + "\\\\';"));
+
+    EXPECT_EQ(strv({"select '" + padding + "\\';"}),
+              split_batch("select '" + padding + "\\';", false, true));
+
+    delimiter = "$$";
+    EXPECT_EQ(strv({insert + "$$", "select 4$$"}),
+              split_batch(insert + "$$ select 4$$"));
+    delimiter = ";";
+  }
+}
+
 namespace {
 
 const auto g_format_parameter = [](const auto &info) {